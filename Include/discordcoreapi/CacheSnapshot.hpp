@@ -0,0 +1,187 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// CacheSnapshot.hpp - Header for the memory-mapped snapshot of the caches, for warm restarts.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file CacheSnapshot.hpp
+#pragma once
+
+#include <discordcoreapi/FoundationEntities.hpp>
+#include <discordcoreapi/Utilities/MappedFile.hpp>
+#include <discordcoreapi/Utilities/UniquePtr.hpp>
+#include <shared_mutex>
+#include <optional>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/**
+		 * \addtogroup discord_core_internal
+		 * @{
+		 */
+
+		/// @brief The sections of a snapshot, one per cache.
+		enum class snapshot_section : uint32_t { guilds = 0, channels = 1, roles = 2, users = 3, guild_members = 4 };
+
+		static constexpr uint64_t snapshotSectionCount{ 5 };
+		static constexpr uint64_t snapshotMagic{ 0x3150414e53414344ULL };///< "DCASNAP1", which also fails to match if the file was written with the other byte order.
+		static constexpr uint32_t snapshotVersion{ 2 };///< Bumped whenever the layout of the file or of any record changes - mismatched snapshots are ignored.
+
+		/// @brief The start of a snapshot file, followed by snapshotSectionCount snapshot_section_headers. Every offset in the file is relative to its start, so it can
+		/// be mapped at any address.
+		struct snapshot_header {
+			uint64_t magic{};
+			uint32_t version{};
+			uint32_t sectionCount{};
+		};
+
+		/// @brief Locates a section's record index, and the encoded records that it points into.
+		struct snapshot_section_header {
+			uint64_t recordCount{};
+			uint64_t indexOffset{};
+			uint64_t dataOffset{};
+			uint64_t dataSize{};
+		};
+
+		/// @brief An entry in a section's record index, which is sorted by idOne and then idTwo so that it can be binary-searched in place.
+		struct snapshot_record {
+			uint64_t idOne{};///< The object's id - or its guild's id, for guild_members.
+			uint64_t idTwo{};///< The user id, for guild_members - otherwise 0.
+			uint64_t offset{};///< The offset of the encoded object, from the section's data.
+			uint64_t size{};///< The size of the encoded object.
+		};
+
+		template<typename value_type> inline constexpr snapshot_section snapshotSectionFor{};
+		template<> inline constexpr snapshot_section snapshotSectionFor<guild_cache_data>{ snapshot_section::guilds };
+		template<> inline constexpr snapshot_section snapshotSectionFor<channel_cache_data>{ snapshot_section::channels };
+		template<> inline constexpr snapshot_section snapshotSectionFor<role_cache_data>{ snapshot_section::roles };
+		template<> inline constexpr snapshot_section snapshotSectionFor<user_cache_data>{ snapshot_section::users };
+		template<> inline constexpr snapshot_section snapshotSectionFor<guild_member_cache_data>{ snapshot_section::guild_members };
+
+		/**@}*/
+
+	}
+
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// @brief A snapshot of the caches from a previous run, which is mapped into memory and decoded one object at a time, as the caches miss on them - so that lookups
+	/// can be answered as soon as the process starts, rather than once the gateway or the rest api have refilled the caches.
+	class cache_snapshot_writer;
+
+	class DiscordCoreAPI_Dll cache_snapshot {
+	  public:
+		/// @brief Maps a snapshot in, if one exists and was written by a compatible version of the library.
+		/// @param filePath the path of the snapshot.
+		/// @return true if the snapshot was mapped.
+		static bool open(jsonifier::string_view filePath);
+
+		/// @brief Unmaps the snapshot.
+		static void close();
+
+		/// @brief Decodes an object from the snapshot - each object is only ever handed out once, after which the cache is its source of truth.
+		/// @tparam value_type the cache_data type of the object.
+		/// @param idOne the object's id, or its guild's id for guild_members.
+		/// @param idTwo the user id, for guild_members.
+		/// @return the object, if the snapshot holds it and it hasn't already been taken or discarded.
+		template<typename value_type> static std::optional<value_type> take(snowflake idOne, snowflake idTwo = snowflake{});
+
+		/// @brief Marks an object in the snapshot as stale - which the caches do whenever they insert or remove it, so that it can't later be restored over newer data.
+		/// @tparam value_type the cache_data type of the object.
+		/// @param idOne the object's id, or its guild's id for guild_members.
+		/// @param idTwo the user id, for guild_members.
+		template<typename value_type> inline static void discard(snowflake idOne, snowflake idTwo = snowflake{}) {
+			if (isItOpen.load(std::memory_order_acquire)) {
+				findAndConsume(discord_core_internal::snapshotSectionFor<value_type>, idOne.operator const uint64_t&(), idTwo.operator const uint64_t&());
+			}
+		}
+
+		/// @brief Adds every record that was neither taken nor discarded to a writer, still encoded - so that the objects that this run never touched carry over
+		/// into the next snapshot, rather than being dropped along with the one that they're in.
+		/// @param writer the writer to add them to, after the caches' own contents.
+		static void carryForward(cache_snapshot_writer& writer);
+
+	  protected:
+		/// @brief The state of a mapped section.
+		struct section_state {
+			const discord_core_internal::snapshot_record* records{};
+			unique_ptr<std::atomic_uint8_t[]> consumed{};
+			jsonifier::string_view data{};
+			uint64_t recordCount{};
+		};
+
+		static std::array<section_state, discord_core_internal::snapshotSectionCount> sections;
+		static std::shared_mutex snapshotMutex;
+		static std::atomic_bool isItOpen;
+		static mapped_file file;
+
+		/// @brief Finds an object's record, and marks it as consumed.
+		/// @return the object's encoded bytes, or an empty view if it isn't there or was already consumed.
+		static jsonifier::string_view findAndConsume(discord_core_internal::snapshot_section section, uint64_t idOne, uint64_t idTwo);
+	};
+
+	/// @brief Collects the contents of the caches, and writes them out as a snapshot.
+	class DiscordCoreAPI_Dll cache_snapshot_writer {
+	  public:
+		friend class cache_snapshot;
+
+		cache_snapshot_writer() = default;
+
+		void add(const guild_member_cache_data& guildMember);
+
+		void add(const channel_cache_data& channel);
+
+		void add(const guild_cache_data& guild);
+
+		void add(const role_cache_data& role);
+
+		void add(const user_cache_data& user);
+
+		/// @brief Writes the snapshot, replacing any previous one - the file is written under a temporary name first, so that an interrupted write can't leave a torn
+		/// snapshot behind. if an object was added more than once, the first copy of it is kept.
+		/// @param filePath the path of the snapshot.
+		/// @return true if the snapshot was written.
+		bool write(jsonifier::string_view filePath);
+
+	  protected:
+		/// @brief A section that is being collected.
+		struct pending_section {
+			std::vector<discord_core_internal::snapshot_record> records{};
+			jsonifier::string data{};
+		};
+
+		std::array<pending_section, discord_core_internal::snapshotSectionCount> sections{};
+
+		/// @brief Adds an object that is already encoded.
+		void addEncoded(discord_core_internal::snapshot_section section, uint64_t idOne, uint64_t idTwo, jsonifier::string_view encodedData);
+	};
+
+	/**@}*/
+
+}
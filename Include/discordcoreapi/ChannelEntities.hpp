@@ -30,7 +30,9 @@
 #pragma once
 
 #include <discordcoreapi/FoundationEntities.hpp>
+#include <discordcoreapi/CacheSnapshot.hpp>
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
+#include <discordcoreapi/Utilities/SecondaryIndex.hpp>
 
 namespace discord_core_api {
 
@@ -174,6 +176,11 @@ namespace discord_core_api {
 		/// @return a co_routine containing a channel.
 		static channel_cache_data getCachedChannel(const get_channel_data dataPackage);
 
+		/// @brief Collects a read-only view of a channel in the library's cache, without copying it.
+		/// @param dataPackage a get_channel_data structure.
+		/// @return cache_view<channel_cache_data> a view of the cached object, which is empty if it isn't cached.
+		static cache_view<channel_cache_data> getCachedChannelView(const get_channel_data dataPackage);
+
 		/// @brief Modifies a channel's properties.
 		/// @param dataPackage a modify_channel_data structure.
 		/// @return a co_routine containing a channel.
@@ -243,19 +250,30 @@ namespace discord_core_api {
 				if (channel.id == 0) {
 					throw dca_exception{ "Sorry, but there was no id set for that channel." };
 				}
-				cache.emplace(std::forward<channel_type>(channel));
-				if (cache.count() % 1000 == 0) {
-					std::cout << "current channel count: " << cache.count() << std::endl;
+				if (channel.guildId != 0) {
+					guildChannelIndex.insert(channel.guildId, channel.id);
 				}
+				cache_snapshot::discard<channel_cache_data>(channel.id);
+				cache.emplace(std::forward<channel_type>(channel));
 			}
 		}
 
 		static void removeChannel(const channel_cache_data& channelId);
 
+		/// @brief Removes every cached channel of a guild.
+		/// @param guildId the id of the guild.
+		static void removeChannels(snowflake guildId);
+
+		/// @brief Collects the ids of every cached channel of a guild.
+		/// @param guildId the id of the guild.
+		/// @return jsonifier::vector<snowflake> the ids of the channels.
+		static jsonifier::vector<snowflake> getCachedChannelIds(snowflake guildId);
+
 		static bool doWeCacheChannels();
 
 	  protected:
 		static object_cache<channel_cache_data> cache;
+		static secondary_index<snowflake> guildChannelIndex;///< Guild id, to the ids of its cached channels.
 		static discord_core_internal::https_client* httpsClient;
 		static bool doWeCacheChannelsBool;
 	};
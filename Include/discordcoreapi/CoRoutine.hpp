@@ -461,6 +461,52 @@ namespace discord_core_api {
 		inline static discord_core_internal::co_routine_thread_pool threadPool{};
 	};
 
+	/// @brief A fire-and-forget coroutine, for work that nobody joins - it starts on the thread pool, and frees its own frame, along with its by-value parameters, as
+	/// soon as it finishes.
+	class detached_task {
+	  public:
+		class promise_type {
+		  public:
+			/// @brief Submits the coroutine to the thread pool, rather than running its body on the caller's thread.
+			struct pool_awaiter {
+				inline bool await_ready() const noexcept {
+					return false;
+				}
+
+				inline void await_suspend(std::coroutine_handle<promise_type> coroHandleNew) const {
+					new_thread_awaiter_base::threadPool.submitTask(coroHandleNew, true);
+				}
+
+				inline void await_resume() const noexcept {
+				}
+			};
+
+			inline detached_task get_return_object() noexcept {
+				return {};
+			}
+
+			inline pool_awaiter initial_suspend() const noexcept {
+				return {};
+			}
+
+			inline std::suspend_never final_suspend() const noexcept {
+				return {};
+			}
+
+			inline void return_void() const noexcept {
+			}
+
+			inline void unhandled_exception() const noexcept {
+				try {
+					std::rethrow_exception(std::current_exception());
+				} catch (const std::exception& error) {
+					message_printer::printError<print_message_type::general>(error.what());
+				} catch (...) {
+				}
+			}
+		};
+	};
+
 	/// @brief An awaitable that can be used to launch the co_routine onto a new thread - as well as return the handle for stoppping its execution.
 	/// \tparam return_type the type of value returned by the containing co_routine.
 	template<typename return_type, bool timeOut> class new_thread_awaiter : public new_thread_awaiter_base {
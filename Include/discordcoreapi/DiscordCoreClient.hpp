@@ -43,6 +43,7 @@
 #include <discordcoreapi/InteractionEntities.hpp>
 #include <discordcoreapi/JsonSpecializations.hpp>
 #include <discordcoreapi/MessageEntities.hpp>
+#include <discordcoreapi/PermissionEngine.hpp>
 #include <discordcoreapi/ReactionEntities.hpp>
 #include <discordcoreapi/RoleEntities.hpp>
 #include <discordcoreapi/SongAPI.hpp>
@@ -52,7 +53,9 @@
 #include <discordcoreapi/ThreadEntities.hpp>
 #include <discordcoreapi/UserEntities.hpp>
 #include <discordcoreapi/Utilities/EventEntities.hpp>
+#include <discordcoreapi/Utilities/EventQueue.hpp>
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
+#include <discordcoreapi/Utilities/Metrics.hpp>
 #include <discordcoreapi/Utilities/TCPConnection.hpp>
 #include <discordcoreapi/Utilities/WebSocketClient.hpp>
 #include <discordcoreapi/VoiceConnection.hpp>
@@ -197,6 +200,10 @@ namespace discord_core_api {
 		/// @brief Executes the library, and waits for completion.
 		void runBot();
 
+		/// @brief Writes the contents of the caches out to cache_options::snapshotPath, if it is set - which is done automatically on shutdown.
+		/// @return true if a snapshot was written.
+		static bool writeCacheSnapshot();
+
 		~discord_core_client();
 
 	  protected:
@@ -222,6 +229,7 @@ namespace discord_core_api {
 		milliseconds startupTimeSinceEpoch{};
 		config_manager configManager{};
 		event_manager eventManager{};///< An event-manager, for hooking into discord-api-events sent over the websockets.
+		discord_core_internal::ordered_event_queue eventQueue{};///< Per-guild ordered queues, that the dispatched events and their cache updates run on.
 
 		bool areWeFullyConnected();
 
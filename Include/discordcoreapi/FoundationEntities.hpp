@@ -30,6 +30,7 @@
 #pragma once
 
 #include <discordcoreapi/Utilities.hpp>
+#include <discordcoreapi/Utilities/CacheProjection.hpp>
 
 namespace discord_core_api {
 
@@ -293,6 +294,7 @@ namespace discord_core_api {
 			https_workload_class workloadClass{};
 			jsonifier::string relativePath{};
 			jsonifier::string callStack{};
+			multipart_body multipartContent{};
 			jsonifier::string baseUrl{};
 			jsonifier::string content{};
 
@@ -326,6 +328,18 @@ namespace discord_core_api {
 			int64_t s{};
 		};
 
+		/// @brief The top-level ids of a dispatched event's payload, for choosing the ordered queue that the event runs on.
+		struct event_routing_data {
+			snowflake channelId{};
+			snowflake guildId{};
+			snowflake id{};
+
+			/// @brief Collects the key of the event's queue - its guild's id, or else its channel's id, or else its own id.
+			inline uint64_t getQueueKey() const {
+				return guildId != 0 ? guildId.operator const uint64_t&() : channelId != 0 ? channelId.operator const uint64_t&() : id.operator const uint64_t&();
+			}
+		};
+
 		template<typename value_type> struct websocket_message_data {
 			unordered_set<jsonifier::string> jsonifierExcludedKeys{};
 			jsonifier::string t{};
@@ -722,6 +736,7 @@ namespace discord_core_api {
 	struct file {
 		jsonifier::string fileName{};///< The name of the file.
 		jsonifier::string data{};///< The data of the file.
+		jsonifier::string filePath{};///< A path to the file, to be memory-mapped and streamed at upload time, in place of data.
 	};
 
 	/// @brief The sorting order, for guild forum channels.
@@ -2517,15 +2532,15 @@ namespace discord_core_api {
 	  public:
 	};
 
-	/// @brief Data structure representing a single guild, for the purposes of populating the cache.
+	/// @brief Data structure representing a single guild, for the purposes of populating the cache. its members aren't listed here, as they're indexed by
+	/// guild_members::getCachedGuildMemberIds() instead - so that a member joining or leaving doesn't copy the guild.
 	class DiscordCoreAPI_Dll guild_cache_data : public flag_entity<guild_cache_data>,
 												public get_guild_image_url<guild_cache_data>,
 												public connect_to_voice<guild_cache_data, discord_core_client, guild_members> {
 	  public:
-		jsonifier::vector<snowflake> channels{};///< Array of guild channels.
-		jsonifier::vector<snowflake> members{};///< Array of guild_members.
-		jsonifier::vector<snowflake> emoji{};///< Array of guild channels.
-		jsonifier::vector<snowflake> roles{};///< Array of guild roles.
+		copy_on_write_vector<snowflake> channels{};///< Array of guild channels.
+		copy_on_write_vector<snowflake> emoji{};///< Array of guild channels.
+		copy_on_write_vector<snowflake> roles{};///< Array of guild roles.
 		voice_connection* voiceConnection{};///< A pointer to the voice_connection, if present.
 		icon_hash discoverySplash{};///< Url to the guild's icon.
 		jsonifier::string name{};///< The guild's name.
@@ -30,12 +30,14 @@
 #pragma once
 
 #include <discordcoreapi/FoundationEntities.hpp>
+#include <discordcoreapi/CacheSnapshot.hpp>
 #include <discordcoreapi/VoiceConnection.hpp>
 #include <discordcoreapi/RoleEntities.hpp>
 #include <discordcoreapi/ChannelEntities.hpp>
 #include <discordcoreapi/StickerEntities.hpp>
 #include <discordcoreapi/GuildScheduledEventEntities.hpp>
 #include <discordcoreapi/StageInstanceEntities.hpp>
+#include <discordcoreapi/Paginator.hpp>
 
 namespace discord_core_api {
 
@@ -328,6 +330,11 @@ namespace discord_core_api {
 		/// @return A co_routine containing a guild.
 		static guild_cache_data getCachedGuild(const get_guild_data dataPackage);
 
+		/// @brief Collects a read-only view of a guild in the library's cache, without copying it.
+		/// @param dataPackage a get_guild_data structure.
+		/// @return cache_view<guild_cache_data> a view of the cached object, which is empty if it isn't cached.
+		static cache_view<guild_cache_data> getCachedGuildView(const get_guild_data dataPackage);
+
 		/// @brief Acquires the preview data of a chosen guild.
 		/// @param dataPackage a get_guild_preview_data structure.
 		/// @return A co_routine containing a guild_preview_data.
@@ -348,6 +355,12 @@ namespace discord_core_api {
 		/// @return A co_routine containing a ban_data_vector.
 		static co_routine<jsonifier::vector<ban_data>> getGuildBansAsync(const get_guild_bans_data dataPackage);
 
+		/// @brief Walks the bans of a chosen guild page by page, collecting each page while the previous ones are being consumed.
+		/// @param dataPackage a get_guild_bans_data structure - before picks a descending walk, and a limit of 0 selects the largest page size.
+		/// @param prefetchWindow the maximum number of pages to collect ahead of the consumer.
+		/// @return A paginator over pages of ban_data.
+		static paginator<jsonifier::vector<ban_data>, get_guild_bans_data> getGuildBansPaginated(get_guild_bans_data dataPackage, uint64_t prefetchWindow = 2);
+
 		/// @brief Collects a single ban from a chosen guild.
 		/// @param dataPackage a get_guild_ban_data structure.
 		/// @return A co_routine containing a ban_data.
@@ -488,10 +501,8 @@ namespace discord_core_api {
 				if (guild.id == 0) {
 					throw dca_exception{ "Sorry, but there was no id set for that guild." };
 				}
+				cache_snapshot::discard<guild_cache_data>(guild.id);
 				cache.emplace(std::forward<guild_type>(guild));
-				if (cache.count() % 1000 == 0) {
-					std::cout << "guild count: " << cache.count() << ", after: " << stopWatchNew.totalTimeElapsed().count() << std::endl;
-				}
 			}
 		}
 
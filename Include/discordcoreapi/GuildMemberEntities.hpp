@@ -32,8 +32,12 @@
 
 #include <discordcoreapi/JsonSpecializations.hpp>
 #include <discordcoreapi/FoundationEntities.hpp>
+#include <discordcoreapi/CacheSnapshot.hpp>
 #include <discordcoreapi/UserEntities.hpp>
+#include <discordcoreapi/Utilities/GuildMemberStore.hpp>
+#include <discordcoreapi/Utilities/SecondaryIndex.hpp>
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
+#include <discordcoreapi/Paginator.hpp>
 
 namespace discord_core_api {
 
@@ -137,11 +141,24 @@ namespace discord_core_api {
 		/// @return a co_routine containing a guild_member.
 		static guild_member_cache_data getCachedGuildMember(const get_guild_member_data dataPackage);
 
+		/// @brief Collects a read-only view of a guild_member in the library's cache, without copying it.
+		/// @param dataPackage a get_guild_member_data structure.
+		/// @return cache_view<guild_member_cache_data> a view of the cached object, which is empty if it isn't cached - or if the compact store is in use, as its members
+		/// only exist as copies.
+		static cache_view<guild_member_cache_data> getCachedGuildMemberView(const get_guild_member_data dataPackage);
+
 		/// @brief Lists all of the guild_members of a chosen guild.
 		/// @param dataPackage a list_guild_members_data structure.
 		/// @return a co_routine containing a vector<guild_members>.
 		static co_routine<jsonifier::vector<guild_member_data>> listGuildMembersAsync(const list_guild_members_data dataPackage);
 
+		/// @brief Walks all of the guild_members of a chosen guild page by page, collecting each page while the previous ones are being consumed.
+		/// @param dataPackage a list_guild_members_data structure - a limit of 0 selects the largest page size.
+		/// @param prefetchWindow the maximum number of pages to collect ahead of the consumer.
+		/// @return a paginator over pages of vector<guild_members>.
+		static paginator<jsonifier::vector<guild_member_data>, list_guild_members_data> listGuildMembersPaginated(list_guild_members_data dataPackage,
+			uint64_t prefetchWindow = 2);
+
 		/// @brief Searches for a list of guild_members of a chosen guild.
 		/// @param dataPackage a search_guild_members_data structure.
 		/// @return a co_routine containing a vector<guild_members>.
@@ -177,7 +194,9 @@ namespace discord_core_api {
 				if (voiceState.userId == 0) {
 					throw dca_exception{ "Sorry, but there was no id set for that voice state." };
 				}
-				vsCache.emplace(std::forward<voice_state_type>(voiceState));
+				voice_state_data_light voiceStateNew{ std::forward<voice_state_type>(voiceState) };
+				indexVoiceState(voiceStateNew);
+				vsCache.emplace(std::move(voiceStateNew));
 			}
 		}
 
@@ -186,7 +205,14 @@ namespace discord_core_api {
 				if (guildMember.guildId == 0 || guildMember.user.id == 0) {
 					throw dca_exception{ "Sorry, but there was no id set for that guildmember." };
 				}
-				cache.emplace(static_cast<guild_member_cache_data>(std::forward<guild_member_type>(guildMember)));
+				guild_member_cache_data guildMemberNew{ static_cast<guild_member_cache_data>(std::forward<guild_member_type>(guildMember)) };
+				indexGuildMember(guildMemberNew);
+				cache_snapshot::discard<guild_member_cache_data>(guildMemberNew.guildId, guildMemberNew.user.id);
+				if (doWeUseCompactGuildMembersBool) {
+					compactCache.emplace(guildMemberNew);
+				} else {
+					cache.emplace(std::move(guildMemberNew));
+				}
 			}
 		}
 
@@ -199,16 +225,57 @@ namespace discord_core_api {
 
 		static void removeVoiceState(const two_id_key& voiceState);
 
+		/// @brief Removes every cached guild_member of a guild.
+		/// @param guildId the id of the guild.
+		static void removeGuildMembers(snowflake guildId);
+
+		/// @brief Removes every cached voice state of a guild.
+		/// @param guildId the id of the guild.
+		static void removeVoiceStates(snowflake guildId);
+
+		/// @brief Collects the ids of every cached guild_member of a guild.
+		/// @param guildId the id of the guild.
+		/// @return jsonifier::vector<snowflake> the user ids of the guild_members.
+		static jsonifier::vector<snowflake> getCachedGuildMemberIds(snowflake guildId);
+
+		/// @brief Collects the ids of every cached guild_member of a guild that has a given role.
+		/// @param guildId the id of the guild.
+		/// @param roleId the id of the role.
+		/// @return jsonifier::vector<snowflake> the user ids of the guild_members.
+		static jsonifier::vector<snowflake> getCachedGuildMemberIdsWithRole(snowflake guildId, snowflake roleId);
+
+		/// @brief Collects the ids of every user that is currently connected to a given voice channel.
+		/// @param guildId the id of the guild.
+		/// @param channelId the id of the voice channel.
+		/// @return jsonifier::vector<snowflake> the user ids of the connected users.
+		static jsonifier::vector<snowflake> getVoiceChannelOccupantIds(snowflake guildId, snowflake channelId);
+
 		static bool doWeCacheGuildMembers();
 
 		static bool doWeCacheVoiceStates();
 
+		/// @brief Collects the approximate number of bytes occupied by each cached guild_member, when the compact store is in use.
+		/// @return uint64_t the bytes per member, or 0 if the compact store is empty or not in use.
+		static uint64_t getCompactBytesPerMember();
+
 	  protected:
 		static discord_core_internal::https_client* httpsClient;
 		static object_cache<voice_state_data_light> vsCache;
 		static object_cache<guild_member_cache_data> cache;
+		static guild_member_store<> compactCache;
+		static secondary_index<two_id_key> channelVoiceStateIndex;///< Guild and channel id, to the ids of the users connected to it.
+		static secondary_index<two_id_key> roleMemberIndex;///< Guild and role id, to the ids of the guild_members with that role.
+		static secondary_index<snowflake> guildVoiceStateIndex;///< Guild id, to the ids of the users with a cached voice state in it.
+		static secondary_index<snowflake> guildMemberIndex;///< Guild id, to the ids of its cached guild_members.
+		static bool doWeUseCompactGuildMembersBool;
 		static bool doWeCacheGuildMembersBool;
 		static bool doWeCacheVoiceStatesBool;
+
+		static void indexGuildMember(const guild_member_cache_data& guildMember);
+
+		static void indexVoiceState(const voice_state_data_light& voiceState);
+
+		static jsonifier::vector<snowflake> getCachedRoleIds(const two_id_key& key);
 	};
 	/**@}*/
 };
@@ -121,6 +121,11 @@ namespace jsonifier {
 		static constexpr auto parseValue = createObject("op", &value_type::op, "s", &value_type::s, "t", &value_type::t);
 	};
 
+	template<> struct core<discord_core_api::discord_core_internal::event_routing_data> {
+		using value_type				 = discord_core_api::discord_core_internal::event_routing_data;
+		static constexpr auto parseValue = createObject("channel_id", &value_type::channelId, "guild_id", &value_type::guildId, "id", &value_type::id);
+	};
+
 	template<typename oty2> struct core<discord_core_api::discord_core_internal::websocket_message_data<oty2>> {
 		using value_type				 = discord_core_api::discord_core_internal::websocket_message_data<oty2>;
 		static constexpr auto parseValue = createObject("d", &value_type::d, "op", &value_type::op, "s", &value_type::s);
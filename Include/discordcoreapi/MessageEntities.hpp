@@ -32,6 +32,7 @@
 #include <discordcoreapi/FoundationEntities.hpp>
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
 #include <discordcoreapi/CoRoutine.hpp>
+#include <discordcoreapi/Paginator.hpp>
 
 namespace discord_core_api {
 
@@ -51,7 +52,7 @@ namespace discord_core_api {
 			jsonifier::vector<value_type> objects{};///< A vector of collected objects.
 		};
 
-		static unordered_map<jsonifier::string, unbounded_message_block<value_type>*> objectsBuffersMap;
+		static dense_map<jsonifier::string, unbounded_message_block<value_type>*> objectsBuffersMap;
 
 		object_collector();
 
@@ -208,6 +209,12 @@ namespace discord_core_api {
 		/// @return A co_routine containing a jsonifier::vector<message_data>.
 		static co_routine<jsonifier::vector<message_data>> getMessagesAsync(const get_messages_data dataPackage);
 
+		/// @brief Walks the messages of a channel page by page, collecting each page while the previous ones are being consumed.
+		/// @param dataPackage a get_messages_data structure - beforeThisId or afterThisId picks the direction, and a limit of 0 selects the largest page size.
+		/// @param prefetchWindow the maximum number of pages to collect ahead of the consumer.
+		/// @return A paginator over pages of jsonifier::vector<message_data>.
+		static paginator<jsonifier::vector<message_data>, get_messages_data> getMessagesPaginated(get_messages_data dataPackage, uint64_t prefetchWindow = 2);
+
 		/// @brief Collects a message from the discord servers.
 		/// @param dataPackage a get_message_data structure.
 		/// @return A co_routine containing a message.
@@ -0,0 +1,212 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// Paginator.hpp - Header for the prefetching paginator class.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file Paginator.hpp
+#pragma once
+
+#include <discordcoreapi/CoRoutine.hpp>
+#include <condition_variable>
+#include <deque>
+
+namespace discord_core_api {
+
+	/**
+	* \addtogroup utilities
+	* @{
+	*/
+
+	/// @brief A range over the pages of a paginated list endpoint. a background co_routine walks the cursor chain - deriving each request from the page before
+	/// it - and keeps up to prefetchWindow pages ready ahead of the consumer. only one request per paginator is ever in flight, so the pages queue up behind
+	/// the endpoint's rate-limit bucket instead of competing for it.
+	/// \tparam page_type the type returned by the endpoint for a single page.
+	/// \tparam data_package_type the request type, which carries the cursor.
+	template<typename page_type, typename data_package_type> class paginator {
+	  public:
+		/// @brief Collects a single page.
+		using fetch_function = std::function<co_routine<page_type>(const data_package_type)>;
+		/// @brief Moves the request's cursor past a page - returning false if the page was the last one.
+		using advance_function = std::function<bool(data_package_type&, const page_type&)>;
+
+		/// @brief An input iterator over the pages of a paginator.
+		class iterator {
+		  public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type		= page_type;
+			using difference_type	= std::ptrdiff_t;
+			using pointer			= page_type*;
+			using reference			= page_type&;
+
+			inline iterator() = default;
+
+			inline iterator(paginator* parentNew) : parent{ parentNew } {
+				advance();
+			}
+
+			inline reference operator*() {
+				return currentPage;
+			}
+
+			inline pointer operator->() {
+				return &currentPage;
+			}
+
+			inline iterator& operator++() {
+				advance();
+				return *this;
+			}
+
+			inline bool operator==(const iterator& other) const {
+				return parent == other.parent;
+			}
+
+		  protected:
+			paginator* parent{};
+			page_type currentPage{};
+
+			inline void advance() {
+				if (parent && !parent->getNextPage(currentPage)) {
+					parent = nullptr;
+				}
+			}
+		};
+
+		/// @brief Starts fetching pages in the background.
+		/// @param dataPackage the request for the first page.
+		/// @param fetchFunctionNew the function collecting a single page.
+		/// @param advanceFunctionNew the function moving the cursor past a page.
+		/// @param prefetchWindowNew the maximum number of pages to hold ahead of the consumer.
+		inline paginator(const data_package_type& dataPackage, fetch_function fetchFunctionNew, advance_function advanceFunctionNew, uint64_t prefetchWindowNew = 2)
+			: advanceFunction{ std::move(advanceFunctionNew) }, fetchFunction{ std::move(fetchFunctionNew) }, prefetchWindow{ prefetchWindowNew > 0 ? prefetchWindowNew : 1 },
+			  producer{ producePages(dataPackage) } {
+		}
+
+		inline paginator& operator=(paginator&&) = delete;
+		inline paginator(paginator&&)			 = delete;
+
+		/// @brief Collects the next page, waiting for it if it hasn't arrived yet.
+		/// @param page the page to fill.
+		/// @return true if a page was collected, false if the range is exhausted.
+		inline bool getNextPage(page_type& page) {
+			std::unique_lock lock{ accessMutex };
+			pageCondition.wait(lock, [&] {
+				return pages.size() > 0 || areWeDone || error;
+			});
+			if (pages.size() > 0) {
+				page = std::move(pages.front());
+				pages.pop_front();
+				pageCondition.notify_all();
+				return true;
+			}
+			if (error) {
+				std::rethrow_exception(std::exchange(error, nullptr));
+			}
+			return false;
+		}
+
+		inline iterator begin() {
+			return iterator{ this };
+		}
+
+		inline iterator end() {
+			return iterator{};
+		}
+
+		inline ~paginator() {
+			{
+				std::unique_lock lock{ accessMutex };
+				doWeStop = true;
+			}
+			pageCondition.notify_all();
+			producer.cancelAndWait();
+		}
+
+	  protected:
+		std::condition_variable pageCondition{};
+		advance_function advanceFunction{};
+		fetch_function fetchFunction{};
+		std::deque<page_type> pages{};
+		std::exception_ptr error{};
+		uint64_t prefetchWindow{};
+		std::mutex accessMutex{};
+		bool areWeDone{};
+		bool doWeStop{};
+		co_routine<void, false> producer{};///< Declared last, as it starts running against the other members as soon as it is constructed.
+
+		inline co_routine<void, false> producePages(data_package_type dataPackage) {
+			auto threadHandle = co_await newThreadAwaitable<void, false>();
+			while (!threadHandle.promise().stopRequested()) {
+				{
+					std::unique_lock lock{ accessMutex };
+					pageCondition.wait(lock, [&] {
+						return pages.size() < prefetchWindow || doWeStop;
+					});
+					if (doWeStop) {
+						co_return;
+					}
+				}
+				page_type page{};
+				bool isItTheLast{};
+				try {
+					page		= fetchFunction(dataPackage).get();
+					isItTheLast = !advanceFunction(dataPackage, page);
+				} catch (...) {
+					std::unique_lock lock{ accessMutex };
+					error	  = std::current_exception();
+					areWeDone = true;
+					pageCondition.notify_all();
+					co_return;
+				}
+				std::unique_lock lock{ accessMutex };
+				pages.emplace_back(std::move(page));
+				areWeDone = isItTheLast;
+				pageCondition.notify_all();
+				if (areWeDone) {
+					co_return;
+				}
+			}
+			co_return;
+		}
+	};
+
+	/// @brief Moves a snowflake cursor to the furthest id in a page, in the direction that the pages are being walked in.
+	/// @param cursor the cursor to move.
+	/// @param page the page that was just collected.
+	/// @param getId a function collecting the id of an element of the page.
+	/// @param doWeAscend are we walking towards newer ids (after), or older ones (before)?
+	template<typename page_type, typename function_type> inline void advanceSnowflakeCursor(snowflake& cursor, const page_type& page, function_type&& getId, bool doWeAscend) {
+		uint64_t newCursor{ doWeAscend ? 0 : std::numeric_limits<uint64_t>::max() };
+		for (auto& value: page) {
+			uint64_t id{ getId(value).operator const uint64_t&() };
+			newCursor = doWeAscend ? std::max(newCursor, id) : std::min(newCursor, id);
+		}
+		cursor = newCursor;
+	}
+
+	/**@}*/
+
+}
@@ -0,0 +1,175 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// PermissionEngine.hpp - Header for the incrementally maintained permission tables.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file PermissionEngine.hpp
+#pragma once
+
+#include <discordcoreapi/FoundationEntities.hpp>
+#include <shared_mutex>
+#include <optional>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/**
+		 * \addtogroup discord_core_internal
+		 * @{
+		 */
+
+		/// @brief A role or member overwrite, as raw permission bits.
+		struct permission_overwrite_entry {
+			uint64_t allow{};
+			uint64_t deny{};
+			uint64_t id{};
+		};
+
+		/// @brief A channel's overwrites, with the @everyone overwrite pulled out, since every check applies it.
+		struct channel_permission_table {
+			std::vector<permission_overwrite_entry> memberOverwrites{};
+			std::vector<permission_overwrite_entry> roleOverwrites{};
+			uint64_t everyoneAllow{};
+			uint64_t everyoneDeny{};
+		};
+
+		/// @brief The permission-relevant state of a single guild.
+		struct guild_permission_table {
+			unordered_map<uint64_t, channel_permission_table> channels{};///< Overwrite tables, by channel id.
+			unordered_map<uint64_t, std::vector<uint64_t>> memberRoles{};///< Role ids, by user id.
+			unordered_map<uint64_t, uint64_t> rolePermissions{};///< Permission bits, by role id - @everyone's id is the guild's id.
+			uint64_t ownerId{};
+		};
+
+		/**@}*/
+
+	}
+
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// @brief The permissions of a batch of guild_members in a single channel, as parallel arrays.
+	struct permission_batch {
+		std::vector<uint64_t> permissions{};///< Permission bits, in the same order as the user ids.
+		std::vector<uint64_t> userIds{};
+	};
+
+	/// @brief Per-guild tables of role permissions, channel overwrites and member roles, kept up to date from gateway events - so that permission checks are answered
+	/// from raw bits, without copying anything out of the caches, allocating, or falling back to the rest api.
+	class DiscordCoreAPI_Dll permission_engine {
+	  public:
+		static constexpr uint64_t allPermissions{ (1ull << 46) - 1 };
+
+		static void initialize(config_manager* configManagerNew);
+
+		/// @brief Replaces a guild's tables with the contents of a guild_data - as received with the guild create event.
+		static void insertGuild(const guild_data& guild);
+
+		/// @brief Applies a guild update, which carries the guild's owner and, usually, its roles.
+		static void updateGuild(const guild_data& guild);
+
+		static void removeGuild(snowflake guildId);
+
+		static void insertRole(snowflake guildId, const role_data& role);
+
+		static void removeRole(snowflake guildId, snowflake roleId);
+
+		static void insertChannel(snowflake guildId, const channel_data& channel);
+
+		static void removeChannel(snowflake guildId, snowflake channelId);
+
+		static void insertGuildMember(snowflake guildId, const guild_member_data& guildMember);
+
+		static void removeGuildMember(snowflake guildId, snowflake userId);
+
+		/// @brief Computes a guild_member's guild-wide permissions, from the roles that they carry.
+		/// @param guildMember the guild_member.
+		/// @return the permission bits, or std::nullopt if the guild isn't tracked.
+		static std::optional<uint64_t> computeBase(const guild_member_data& guildMember);
+
+		/// @brief Computes a guild_member's permissions in a tracked channel, from the roles that they carry.
+		/// @param guildMember the guild_member.
+		/// @param channelId the id of the channel.
+		/// @return the permission bits, or std::nullopt if the guild or the channel isn't tracked.
+		static std::optional<uint64_t> compute(const guild_member_data& guildMember, snowflake channelId);
+
+		/// @brief Computes a tracked guild_member's permissions in a tracked channel.
+		/// @param guildId the id of the guild.
+		/// @param userId the id of the guild_member.
+		/// @param channelId the id of the channel.
+		/// @return the permission bits, or std::nullopt if the guild, the member or the channel isn't tracked.
+		static std::optional<uint64_t> compute(snowflake guildId, snowflake userId, snowflake channelId);
+
+		/// @brief Computes the permissions of many tracked guild_members in a tracked channel at once, by OR-reducing per-member role bitmaps with the widest simd
+		/// registers available - for audits and bulk moderation, where checking members one at a time is far too slow.
+		/// @param guildId the id of the guild.
+		/// @param channelId the id of the channel.
+		/// @param userIds the ids of the guild_members to evaluate, or empty for all of the guild's tracked guild_members - untracked ids are left out of the result.
+		/// @return the permissions, or std::nullopt if the guild or the channel isn't tracked.
+		static std::optional<permission_batch> computeBatch(snowflake guildId, snowflake channelId, const jsonifier::vector<snowflake>& userIds = {});
+
+		/// @brief Checks whether a tracked guild_member holds a permission in a tracked channel.
+		/// @return true if they hold it - false if they don't, or if the answer isn't known.
+		static bool has(snowflake guildId, snowflake userId, snowflake channelId, permission permissionNew);
+
+		/// @brief Applies a channel's overwrites to a guild_member's guild-wide permissions.
+		/// @param basePermissions the guild-wide permission bits.
+		/// @param guildMember the guild_member.
+		/// @param overwrites the channel's overwrites.
+		/// @return the permission bits in the channel.
+		static uint64_t applyOverwrites(uint64_t basePermissions, const guild_member_data& guildMember, const jsonifier::vector<over_write_data>& overwrites);
+
+		static bool doWeTrackPermissions();
+
+	  protected:
+		/// @brief A shard of the tables, padded out to its own cache line.
+		struct alignas(64) permission_shard {
+			unordered_map<uint64_t, unique_ptr<discord_core_internal::guild_permission_table>> guilds{};
+			mutable std::shared_mutex shardMutex{};
+		};
+
+		static constexpr uint64_t shardCount{ 32 };
+
+		static std::array<permission_shard, shardCount> shards;
+		static bool doWeTrackPermissionsBool;
+
+		static permission_shard& getShard(uint64_t guildId);
+
+		template<typename role_ids_type>
+		static uint64_t computeBase(const discord_core_internal::guild_permission_table& guild, uint64_t guildId, uint64_t userId, const role_ids_type& roleIds);
+
+		template<typename role_ids_type> static uint64_t applyOverwrites(uint64_t basePermissions, const discord_core_internal::channel_permission_table& channel, uint64_t userId,
+			const role_ids_type& roleIds);
+
+		static discord_core_internal::channel_permission_table buildChannelTable(uint64_t guildId, const jsonifier::vector<over_write_data>& overwrites);
+	};
+
+	/**@}*/
+
+}
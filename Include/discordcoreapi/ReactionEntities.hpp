@@ -170,6 +170,12 @@ namespace discord_core_api {
 		/// @return a co_routine containing a jsonifier::vector<user_data>.
 		static co_routine<jsonifier::vector<user_data>> getReactionsAsync(const get_reactions_data dataPackage);
 
+		/// @brief Walks the users that reacted with this emoji page by page, collecting each page while the previous ones are being consumed.
+		/// @param dataPackage a get_reactions_data structure - a limit of 0 selects the largest page size.
+		/// @param prefetchWindow the maximum number of pages to collect ahead of the consumer.
+		/// @return a paginator over pages of jsonifier::vector<user_data>.
+		static paginator<jsonifier::vector<user_data>, get_reactions_data> getReactionsPaginated(get_reactions_data dataPackage, uint64_t prefetchWindow = 2);
+
 		/// @brief Deletes all of the reactions from a given message_data.
 		/// @param dataPackage a delete_all_reactions_data structure.
 		/// @return a co_routine containing void.
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <discordcoreapi/FoundationEntities.hpp>
+#include <discordcoreapi/CacheSnapshot.hpp>
 #include <discordcoreapi/GuildMemberEntities.hpp>
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
 
@@ -195,15 +196,18 @@ namespace discord_core_api {
 		/// @return a co_routine containing a role_data.
 		static role_cache_data getCachedRole(const get_role_data dataPackage);
 
+		/// @brief Collects a read-only view of a role in the library's cache, without copying it.
+		/// @param dataPackage a get_role_data structure.
+		/// @return cache_view<role_cache_data> a view of the cached object, which is empty if it isn't cached.
+		static cache_view<role_cache_data> getCachedRoleView(const get_role_data dataPackage);
+
 		template<typename role_type> inline static void insertRole(role_type&& role) {
 			if (doWeCacheRolesBool) {
 				if (role.id == 0) {
 					throw dca_exception{ "Sorry, but there was no id set for that role." };
 				}
+				cache_snapshot::discard<role_cache_data>(role.id);
 				cache.emplace(static_cast<role_cache_data>(std::forward<role_type>(role)));
-				if (cache.count() % 1000 == 0) {
-					std::cout << "current role count: " << cache.count() << std::endl;
-				}
 			}
 		}
 
@@ -31,6 +31,7 @@
 
 #include <discordcoreapi/FoundationEntities.hpp>
 #include <discordcoreapi/CoRoutine.hpp>
+#include <discordcoreapi/Paginator.hpp>
 #include <discordcoreapi/ChannelEntities.hpp>
 
 namespace discord_core_api {
@@ -201,6 +202,13 @@ namespace discord_core_api {
 		/// @return a co_routine containing a archived_threads_data.
 		static co_routine<archived_threads_data> getPublicArchivedThreadsAsync(const get_public_archived_threads_data dataPackage);
 
+		/// @brief Walks the public archived threads of a given channel page by page, collecting each page while the previous ones are being consumed.
+		/// @param dataPackage a get_public_archived_threads_data structure.
+		/// @param prefetchWindow the maximum number of pages to collect ahead of the consumer.
+		/// @return a paginator over pages of archived_threads_data.
+		static paginator<archived_threads_data, get_public_archived_threads_data> getPublicArchivedThreadsPaginated(get_public_archived_threads_data dataPackage,
+			uint64_t prefetchWindow = 2);
+
 		/// @brief Collects a list of protected archived threads from a given channel.
 		/// @param dataPackage a get_private_archived_threads_data structure.
 		/// @return a co_routine containing a archived_threads_data.
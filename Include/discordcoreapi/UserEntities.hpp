@@ -30,6 +30,7 @@
 #pragma once
 
 #include <discordcoreapi/FoundationEntities.hpp>
+#include <discordcoreapi/CacheSnapshot.hpp>
 #include <discordcoreapi/Utilities/WebSocketClient.hpp>
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
 
@@ -127,6 +128,11 @@ namespace discord_core_api {
 		/// @return A co_routine containing a user.
 		static user_cache_data getCachedUser(const get_user_data dataPackage);
 
+		/// @brief Collects a read-only view of a user in the library's cache, without copying it.
+		/// @param dataPackage a get_user_data structure.
+		/// @return cache_view<user_cache_data> a view of the cached object, which is empty if it isn't cached.
+		static cache_view<user_cache_data> getCachedUserView(const get_user_data dataPackage);
+
 		/// @brief Collects a given user from the discord servers.
 		/// @param dataPackage a get_user_data structure.
 		/// @return A co_routine containing a user.
@@ -154,10 +160,8 @@ namespace discord_core_api {
 				if (user.id == 0) {
 					throw dca_exception{ "Sorry, but there was no id set for that user." };
 				}
+				cache_snapshot::discard<user_cache_data>(user.id);
 				cache.emplace(std::forward<user_type>(user));
-				if (cache.count() % 1000 == 0) {
-					std::cout << "current user count: " << cache.count() << std::endl;
-				}
 			}
 		}
 
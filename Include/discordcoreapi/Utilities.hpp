@@ -32,9 +32,11 @@
 #include <discordcoreapi/Utilities/Base.hpp>
 #include <discordcoreapi/Utilities/UnorderedSet.hpp>
 #include <discordcoreapi/Utilities/UnorderedMap.hpp>
+#include <discordcoreapi/Utilities/DenseMap.hpp>
 #include <discordcoreapi/Utilities/ObjectCache.hpp>
 #include <discordcoreapi/Utilities/UnboundedMessageBlock.hpp>
 #include <discordcoreapi/Utilities/Etf.hpp>
+#include <discordcoreapi/Utilities/MappedFile.hpp>
 #include <coroutine>
 
 namespace discord_core_api {
@@ -93,6 +95,8 @@ namespace discord_core_api {
 		class sound_cloud_api;
 		class you_tube_api;
 
+		enum class https_workload_type : uint8_t;
+
 	}// namespace discord_core_internal
 
 	struct on_voice_server_update_data;
@@ -118,6 +122,8 @@ namespace discord_core_api {
 
 	template<typename return_type, bool timeOut = true> class co_routine;
 
+	class detached_task;
+
 	/**@}*/
 
 	/**
@@ -231,6 +237,31 @@ namespace discord_core_api {
 		bool cacheGuilds{ true };///< Do we cache guilds?
 		bool cacheRoles{ true };///< Do we cache roles?
 		bool cacheUsers{ true };///< Do we cache users?
+		bool compactGuildMembers{};///< Do we hold cached guild_members in the compact, columnar store? (trades slower lookups for far less memory per member).
+		cache_eviction_policy guildMemberPolicy{};///< Limits for the guild_member cache - the compact store ignores these.
+		cache_eviction_policy voiceStatePolicy{};///< Limits for the voice state cache.
+		cache_eviction_policy channelPolicy{};///< Limits for the channel cache.
+		cache_eviction_policy guildPolicy{};///< Limits for the guild cache.
+		cache_eviction_policy rolePolicy{};///< Limits for the role cache.
+		cache_eviction_policy userPolicy{};///< Limits for the user cache.
+		bool trackPermissions{ true };///< Do we keep the permission engine's tables up to date, so that permission checks don't have to copy from the caches?
+		jsonifier::string snapshotPath{};///< If set, the caches are written here on shutdown, and lazily restored from here on the next start.
+	};
+
+	/// @brief Options for the tls connections made by the library, to the gateway as well as to the rest api.
+	struct tls_options {
+		bool enableKernelTls{};///< Do we hand record encryption off to the kernel, once handshakes complete? (linux only - falls back to user-space tls elsewhere).
+	};
+
+	/// @brief Options for the library's Https client.
+	struct https_options {
+		jsonifier::vector<discord_core_internal::https_workload_type> uncoalescedWorkloads{};///< Get endpoints that should never be coalesced.
+		uint64_t responseCacheMaxBytes{ 1024 * 1024 * 16 };///< The most response data that the response cache may hold.
+		milliseconds responseCacheTtl{ 60000 };///< How long cached responses stay fresh for, if no gateway event invalidates them first.
+		jsonifier::string proxyAddress{};///< If set, every request to discord's api is routed through the rest proxy listening at this address, rather than straight to it.
+		uint16_t proxyPort{ 8090 };///< The port that the rest proxy is listening on.
+		bool coalesceGetRequests{ true };///< Do concurrent, identical get requests share a single upstream request?
+		bool cacheResponses{};///< Do we cache the responses of read endpoints that gateway events can invalidate?
 	};
 
 	/// @brief Configuration data for the library's main class, discord_core_client.
@@ -244,6 +275,8 @@ namespace discord_core_api {
 		jsonifier::string botToken{};///< Your bot's token.
 		logging_options logOptions{};///< Options for the output/logging of the library.
 		cache_options cacheOptions{};///< Options for the cache of the library.
+		https_options httpsOptions{};///< Options for the Https client of the library.
+		tls_options tlsOptions{};///< Options for the tls connections of the library.
 		uint16_t connectionPort{};///< A potentially alternative connection port for the websocket.
 	};
 
@@ -282,6 +315,14 @@ namespace discord_core_api {
 
 		bool doWeCacheRoles() const;
 
+		bool doWeUseCompactGuildMembers() const;
+
+		const cache_options& getCacheOptions() const;
+
+		const https_options& getHttpsOptions() const;
+
+		bool doWeUseKernelTls() const;
+
 		update_presence_data getPresenceData() const;
 
 		jsonifier::string getBotToken() const;
@@ -554,11 +595,7 @@ namespace discord_core_api {
 		/// @param permission a permission to check the current channel_data for.
 		/// @return bool a bool suggesting the presence of the chosen permission.
 		inline bool checkForPermission(const guild_member_data& guildMember, const channel_data& channel, permission permission) {
-			if ((jsonifier::strToUint64(computePermissions(guildMember, channel).data()) & static_cast<uint64_t>(permission)) == static_cast<uint64_t>(permission)) {
-				return true;
-			} else {
-				return false;
-			}
+			return (computePermissionBits(guildMember, channel) & static_cast<uint64_t>(permission)) == static_cast<uint64_t>(permission);
 		}
 
 		/// @brief Returns a string containing the currently held permissions_base in a given guild.
@@ -766,11 +803,13 @@ namespace discord_core_api {
 		DiscordCoreAPI_Dll static jsonifier::string computeOverwrites(jsonifier::string_view basePermissions, const guild_member_data& guildMember, const channel_data& channel);
 
 		inline static jsonifier::string computePermissions(const guild_member_data& guildMember, const channel_data& channel) {
-			jsonifier::string permissions = computeBasePermissions(guildMember);
-			permissions					  = computeOverwrites(permissions, guildMember, channel);
-			return permissions;
+			return jsonifier::toString(computePermissionBits(guildMember, channel));
 		}
 
+		/// @brief Computes a guild_member's permissions in a channel as raw bits - from the permission_engine's tables where it tracks the guild, and otherwise
+		/// from the caches.
+		DiscordCoreAPI_Dll static uint64_t computePermissionBits(const guild_member_data& guildMember, const channel_data& channel);
+
 		DiscordCoreAPI_Dll static jsonifier::string computeBasePermissions(const guild_member_data& guildMember);
 	};
 
@@ -870,6 +909,65 @@ namespace discord_core_api {
 		uint64_t value{};
 	};
 
+	/// @brief A multipart/form-data body, held as a list of segments so that file contents can be written to the socket without first being concatenated, or
+	/// copied - in-memory files are referenced where they are, so they have to outlive the body. (the entity functions that build these hold their data
+	/// package for as long as the request is in flight.)
+	class DiscordCoreAPI_Dll multipart_body {
+	  public:
+		multipart_body& operator=(multipart_body&&) noexcept = default;
+		multipart_body(multipart_body&&) noexcept			 = default;
+
+		multipart_body& operator=(const multipart_body&) = delete;
+		multipart_body(const multipart_body&)			 = delete;
+
+		multipart_body() = default;
+
+		/// @brief Assembles the segments of the body, memory-mapping any files that were given by path.
+		/// @param payloadJson the serialized contents of the payload_json part, which the body takes over.
+		/// @param files the files to be attached, which are referenced rather than copied.
+		multipart_body(jsonifier::string&& payloadJson, const jsonifier::vector<file>& files);
+
+		/// @brief Visits each of the body's segments, in the order that they go out on the wire.
+		/// @param function the function to be called with each segment, along with the mapped file that it came from, if any.
+		template<typename function_type> inline void forEachSegment(function_type&& function) const {
+			function(static_cast<jsonifier::string_view>(payloadHeader), static_cast<const mapped_file*>(nullptr));
+			function(static_cast<jsonifier::string_view>(payloadJson), static_cast<const mapped_file*>(nullptr));
+			for (auto& value: parts) {
+				function(static_cast<jsonifier::string_view>(value.header), static_cast<const mapped_file*>(nullptr));
+				if (value.mapping.size() > 0) {
+					function(value.mapping.view(), &value.mapping);
+				} else {
+					function(value.data, static_cast<const mapped_file*>(nullptr));
+				}
+			}
+			function(static_cast<jsonifier::string_view>(trailer), static_cast<const mapped_file*>(nullptr));
+		}
+
+		/// @brief Collects the total length of the body.
+		/// @return uint64_t the length, in bytes.
+		uint64_t size() const;
+
+		/// @brief Checks whether or not any parts have been added to the body.
+		/// @return bool true if there are no parts.
+		bool empty() const;
+
+		/// @brief Collects the contents of the payload_json part.
+		/// @return jsonifier::string_view the serialized payload.
+		jsonifier::string_view getPayloadJson() const;
+
+	  protected:
+		struct part {
+			jsonifier::string header{};///< The boundary and headers that precede this part.
+			jsonifier::string_view data{};///< The in-memory contents of this part, which belong to the caller's file.
+			mapped_file mapping{};///< The mapped contents of this part, when it was given by path.
+		};
+
+		jsonifier::string payloadHeader{};
+		jsonifier::string payloadJson{};
+		std::vector<part> parts{};
+		jsonifier::string trailer{};
+	};
+
 	DiscordCoreAPI_Dll jsonifier::string constructMultiPartData(jsonifier::string_view data, const jsonifier::vector<file>& files);
 
 	DiscordCoreAPI_Dll jsonifier::string convertToLowerCase(jsonifier::string_view stringToConvert);
@@ -213,9 +213,21 @@ namespace discord_core_api {
 			errorStream	 = other.getErrorStream();
 		}
 
+		/// @brief Resolves a message for printing - invocables are only called once we know that the message is actually going to be printed.
+		/// @tparam string_type either a printable string type, or an invocable returning one.
+		/// @param what the message, or the invocable producing it.
+		/// @return the printable message.
+		template<typename string_type> inline static decltype(auto) resolveMessage(const string_type& what) {
+			if constexpr (std::is_invocable_v<const string_type&>) {
+				return what();
+			} else {
+				return (what);
+			}
+		}
+
 		/// @brief Print an error message of the specified type.
 		/// @tparam messageType the type of message to print.
-		/// @param what the error message.
+		/// @param what the error message, or an invocable that produces it on demand.
 		/// @param where the source location where the error occurred (default: current source location).
 		template<print_message_type messageType, typename string_type>
 		inline static void printError(const string_type& what, std::source_location where = std::source_location::current()) {
@@ -224,7 +236,7 @@ namespace discord_core_api {
 					if (doWePrintGeneralErrors.load(std::memory_order_acquire)) {
 						std::unique_lock lock{ accessMutex };
 						*errorStream << shiftToBrightRed() << "General error, caught at: " << where.file_name() << ", " << where.line() << ":" << where.column()
-									 << ", in: " << where.function_name() << ", it is: " << what << std::endl
+									 << ", in: " << where.function_name() << ", it is: " << resolveMessage(what) << std::endl
 									 << reset() << std::endl;
 					}
 					break;
@@ -233,7 +245,7 @@ namespace discord_core_api {
 					if (doWePrintWebSocketErrors.load(std::memory_order_acquire)) {
 						std::unique_lock lock{ accessMutex };
 						*errorStream << shiftToBrightRed() << "WebSocket error, caught at: " << where.file_name() << ", " << where.line() << ":" << where.column()
-									 << ", in: " << where.function_name() << ", it is: " << what << std::endl
+									 << ", in: " << where.function_name() << ", it is: " << resolveMessage(what) << std::endl
 									 << reset() << std::endl;
 					}
 					break;
@@ -242,7 +254,7 @@ namespace discord_core_api {
 					if (doWePrintHttpsErrors.load(std::memory_order_acquire)) {
 						std::unique_lock lock{ accessMutex };
 						*errorStream << shiftToBrightRed() << "Https error, caught at: " << where.file_name() << ", " << where.line() << ":" << where.column()
-									 << ", in: " << where.function_name() << ", it is: " << what << std::endl
+									 << ", in: " << where.function_name() << ", it is: " << resolveMessage(what) << std::endl
 									 << reset() << std::endl;
 					}
 					break;
@@ -252,7 +264,7 @@ namespace discord_core_api {
 
 		/// @brief Print a success message of the specified type.
 		/// @tparam messageType the type of message to print.
-		/// @param what the success message.
+		/// @param what the success message, or an invocable that produces it on demand.
 		/// @param where the source location where the success occurred (default: current source location).
 		template<print_message_type messageType, typename string_type>
 		inline static void printSuccess(const string_type& what, std::source_location where = std::source_location::current()) {
@@ -261,7 +273,7 @@ namespace discord_core_api {
 					if (doWePrintGeneralSuccesses.load(std::memory_order_acquire)) {
 						std::unique_lock lock{ accessMutex };
 						*outputStream << shiftToBrightBlue() << "General success, caught at: " << where.file_name() << ", " << where.line() << ":" << where.column()
-									  << ", in: " << where.function_name() << ", it is: " << what << std::endl
+									  << ", in: " << where.function_name() << ", it is: " << resolveMessage(what) << std::endl
 									  << reset() << std::endl;
 					}
 					break;
@@ -270,7 +282,7 @@ namespace discord_core_api {
 					if (doWePrintWebSocketSuccesses.load(std::memory_order_acquire)) {
 						std::unique_lock lock{ accessMutex };
 						*outputStream << shiftToBrightGreen() << "WebSocket success, caught at: " << where.file_name() << ", " << where.line() << ":" << where.column()
-									  << ", in: " << where.function_name() << ", it is: " << what << std::endl
+									  << ", in: " << where.function_name() << ", it is: " << resolveMessage(what) << std::endl
 									  << reset() << std::endl;
 					}
 					break;
@@ -279,7 +291,7 @@ namespace discord_core_api {
 					if (doWePrintHttpsSuccesses.load(std::memory_order_acquire)) {
 						std::unique_lock lock{ accessMutex };
 						*outputStream << shiftToBrightGreen() << "Https success, caught at: " << where.file_name() << ", " << where.line() << ":" << where.column()
-									  << ", in: " << where.function_name() << ", it is: " << what << std::endl
+									  << ", in: " << where.function_name() << ", it is: " << resolveMessage(what) << std::endl
 									  << reset() << std::endl;
 					}
 					break;
@@ -0,0 +1,156 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// CacheProjection.hpp - Header for the compile-time selection of the fields that the caches store.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file CacheProjection.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/Base.hpp>
+
+namespace discord_core_api {
+
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// @brief The optional fields of a cached guild - its id and flags are always kept, as are its owner id and roles, which computeBasePermissions() needs.
+	enum class guild_cache_fields : uint64_t {
+		channels		 = 1 << 0,
+		members [[deprecated("guild_cache_data no longer lists its members - they're indexed by guild_members::getCachedGuildMemberIds().")]] = 1 << 1,
+		emoji			 = 1 << 2,
+		roles			 = 1 << 3,
+		discovery_splash = 1 << 4,
+		name			 = 1 << 5,
+		member_count	 = 1 << 6,
+		discovery		 = 1 << 7,
+		owner_id		 = 1 << 8,
+		banner			 = 1 << 9,
+		splash			 = 1 << 10,
+		icon			 = 1 << 11,
+		all				 = (1 << 12) - 1
+	};
+
+	/// @brief The optional fields of a cached channel - its id, guild id, type and flags are always kept, as are its permission overwrites, which
+	/// computeOverwrites() needs.
+	enum class channel_cache_fields : uint64_t {
+		permission_overwrites = 1 << 0,
+		topic				  = 1 << 1,
+		name				  = 1 << 2,
+		member_count		  = 1 << 3,
+		parent_id			  = 1 << 4,
+		position			  = 1 << 5,
+		owner_id			  = 1 << 6,
+		all					  = (1 << 7) - 1
+	};
+
+	/// @brief The optional fields of a cached user - its id and flags are always kept.
+	enum class user_cache_fields : uint64_t {
+		avatar_decoration = 1 << 0,
+		discriminator	  = 1 << 1,
+		global_name		  = 1 << 2,
+		user_name		  = 1 << 3,
+		avatar			  = 1 << 4,
+		banner			  = 1 << 5,
+		premium_type	  = 1 << 6,
+		accent_color	  = 1 << 7,
+		all				  = (1 << 8) - 1
+	};
+
+	/// @brief The optional fields of a cached guild_member - its guild id, user id and flags are always kept, as are its roles, which the permission
+	/// computations and guild_members::getCachedGuildMemberIdsWithRole() need.
+	enum class guild_member_cache_fields : uint64_t {
+		roles		= 1 << 0,
+		permissions = 1 << 1,
+		joined_at	= 1 << 2,
+		nick		= 1 << 3,
+		avatar		= 1 << 4,
+		all			= (1 << 5) - 1
+	};
+
+	template<typename value_type>
+	concept cache_field_enum = std::same_as<value_type, guild_cache_fields> || std::same_as<value_type, channel_cache_fields> || std::same_as<value_type, user_cache_fields> ||
+		std::same_as<value_type, guild_member_cache_fields>;
+
+	template<cache_field_enum value_type> inline constexpr value_type operator|(value_type lhs, value_type rhs) {
+		return static_cast<value_type>(static_cast<uint64_t>(lhs) | static_cast<uint64_t>(rhs));
+	}
+
+/// The fields that each cache keeps are fixed when the library is built, by defining these as an expression of the enums above, for example:
+/// -DDCA_GUILD_MEMBER_CACHE_FIELDS="discord_core_api::guild_member_cache_fields::roles|discord_core_api::guild_member_cache_fields::nick".
+#if !defined(DCA_GUILD_CACHE_FIELDS)
+	#define DCA_GUILD_CACHE_FIELDS discord_core_api::guild_cache_fields::all
+#endif
+#if !defined(DCA_CHANNEL_CACHE_FIELDS)
+	#define DCA_CHANNEL_CACHE_FIELDS discord_core_api::channel_cache_fields::all
+#endif
+#if !defined(DCA_USER_CACHE_FIELDS)
+	#define DCA_USER_CACHE_FIELDS discord_core_api::user_cache_fields::all
+#endif
+#if !defined(DCA_GUILD_MEMBER_CACHE_FIELDS)
+	#define DCA_GUILD_MEMBER_CACHE_FIELDS discord_core_api::guild_member_cache_fields::all
+#endif
+
+	class guild_member_cache_data;
+	class channel_cache_data;
+	class guild_cache_data;
+	class user_cache_data;
+
+	/// @brief The fields that a cache_data type keeps, when it is built from its full counterpart - the rest are left empty, so that they take up no memory beyond
+	/// their own footprint.
+	/// @tparam value_type the cache_data type.
+	template<typename value_type> struct cache_projection;
+
+	/// @tparam field_type_new the field enum of the cache_data type.
+	/// @tparam fieldsNew the fields that were configured to be kept.
+	/// @tparam requiredFields the fields that are kept whatever the configuration, as the permission fallbacks and the secondary indices are computed from them.
+	template<typename field_type_new, field_type_new fieldsNew, field_type_new requiredFields = field_type_new{}> struct cache_projection_base {
+		using field_type = field_type_new;
+		static constexpr field_type fields{ fieldsNew | requiredFields };
+
+		/// @brief Checks whether a field is kept.
+		/// @param field the field to check.
+		/// @return true if the field is kept.
+		inline static constexpr bool keeps(field_type field) {
+			return (static_cast<uint64_t>(fields) & static_cast<uint64_t>(field)) != 0;
+		}
+	};
+
+	template<> struct cache_projection<guild_cache_data>
+		: public cache_projection_base<guild_cache_fields, DCA_GUILD_CACHE_FIELDS, guild_cache_fields::owner_id | guild_cache_fields::roles> {};
+
+	template<> struct cache_projection<channel_cache_data>
+		: public cache_projection_base<channel_cache_fields, DCA_CHANNEL_CACHE_FIELDS, channel_cache_fields::permission_overwrites> {};
+
+	template<> struct cache_projection<user_cache_data> : public cache_projection_base<user_cache_fields, DCA_USER_CACHE_FIELDS> {};
+
+	template<> struct cache_projection<guild_member_cache_data>
+		: public cache_projection_base<guild_member_cache_fields, DCA_GUILD_MEMBER_CACHE_FIELDS, guild_member_cache_fields::roles> {};
+
+	/**@}*/
+
+}
@@ -44,6 +44,12 @@ namespace discord_core_api {
 		* @{
 		*/
 
+		/// @brief A coroutine handle queued on a worker thread.
+		struct worker_task {
+			std::coroutine_handle<> handle{};///< The coroutine to be resumed.
+			bool detached{};///< Whether the coroutine frees its own frame on completion - in which case the handle mustn't be touched once it has been resumed.
+		};
+
 		/// @brief A struct representing a worker thread for coroutine-based tasks.
 		struct worker_thread {
 			inline worker_thread() = default;
@@ -61,7 +67,7 @@ namespace discord_core_api {
 
 			inline ~worker_thread() = default;
 
-			unbounded_message_block<std::coroutine_handle<>> tasks{};///< Queue of coroutine tasks.
+			unbounded_message_block<worker_task> tasks{};///< Queue of coroutine tasks.
 			std::atomic_bool areWeCurrentlyWorking{};///< Atomic flag indicating if the thread is working.
 			std::jthread thread{};///< Joinable thread.
 		};
@@ -74,9 +80,9 @@ namespace discord_core_api {
 			/// @brief Constructor to create a coroutine thread pool. initializes the worker threads.
 			inline co_routine_thread_pool() : threadCount(std::thread::hardware_concurrency()) {
 				for (uint32_t x = 0; x < threadCount; ++x) {
-					currentIndex.fetch_add(1, std::memory_order_release);
+					// the index comes from fetch_add() itself, as a separate load could observe another thread's increment, and hand two workers the same key.
+					uint64_t indexNew = currentIndex.fetch_add(1, std::memory_order_acq_rel) + 1;
 					currentCount.fetch_add(1, std::memory_order_release);
-					uint64_t indexNew = currentIndex.load(std::memory_order_acquire);
 					getMap().emplace(indexNew, makeUnique<worker_thread>());
 					getMap()[indexNew]->thread = std::jthread([=, this](std::stop_token tokenNew) mutable {
 						threadFunction(getMap().at(indexNew).get(), tokenNew);
@@ -86,7 +92,8 @@ namespace discord_core_api {
 
 			/// @brief Submit a coroutine task to the thread pool.
 			/// @param coro the coroutine handle to submit.
-			inline void submitTask(std::coroutine_handle<> coro) {
+			/// @param detached whether the coroutine frees its own frame on completion.
+			inline void submitTask(std::coroutine_handle<> coro, bool detached = false) {
 				bool areWeAllBusy{ true };
 				uint64_t currentLowestValue{ std::numeric_limits<uint64_t>::max() };
 				uint64_t currentLowestIndex{ std::numeric_limits<uint64_t>::max() };
@@ -102,18 +109,18 @@ namespace discord_core_api {
 					}
 				}
 				if (areWeAllBusy) {
-					currentIndex.fetch_add(1, std::memory_order_release);
+					uint64_t indexNew = currentIndex.fetch_add(1, std::memory_order_acq_rel) + 1;
 					currentCount.fetch_add(1, std::memory_order_release);
-					uint64_t indexNew = currentIndex.load(std::memory_order_acquire);
 					lock01.unlock();
 					std::unique_lock lock02{ workerAccessMutex };
 					getMap().emplace(indexNew, makeUnique<worker_thread>());
+					getMap()[indexNew]->tasks.send(worker_task{ coro, detached });
 					getMap()[indexNew]->thread = std::jthread([=, this](std::stop_token tokenNew) mutable {
 						threadFunction(getMap().at(indexNew).get(), tokenNew);
 					});
 					lock02.unlock();
 				} else {
-					getMap()[currentLowestIndex]->tasks.send(std::move(coro));
+					getMap()[currentLowestIndex]->tasks.send(worker_task{ coro, detached });
 				}
 			}
 
@@ -133,12 +140,12 @@ namespace discord_core_api {
 			/// @param tokenNew The stop token for the thread.
 			inline void threadFunction(worker_thread* thread, std::stop_token tokenNew) {
 				while (!doWeQuit.load(std::memory_order_acquire) && !tokenNew.stop_requested()) {
-					std::coroutine_handle<> coroHandle{};
-					if (thread->tasks.tryReceive(coroHandle)) {
+					worker_task task{};
+					if (thread->tasks.tryReceive(task)) {
 						thread->areWeCurrentlyWorking.store(true, std::memory_order_release);
 						try {
-							coroHandle();
-							while (!coroHandle.done()) {
+							task.handle();
+							while (!task.detached && !task.handle.done()) {
 								std::this_thread::sleep_for(1ms);
 							}
 						} catch (const std::runtime_error& error) {
@@ -146,24 +153,19 @@ namespace discord_core_api {
 						}
 						thread->areWeCurrentlyWorking.store(false, std::memory_order_release);
 					}
-					if (currentCount.load(std::memory_order_acquire) > threadCount) {
-						uint64_t extraWorkers{ currentCount.load(std::memory_order_acquire) - threadCount };
-						while (extraWorkers > 0) {
-							--extraWorkers;
-							size_type currentHighestIndex{};
-							for (const auto& [key, value]: *this) {
-								if (key > currentHighestIndex) {
-									currentHighestIndex = key;
+					// an idle worker beyond the base count retires itself - only once its own queue is empty, so that no submitted task is ever dropped.
+					if (currentCount.load(std::memory_order_acquire) > threadCount && thread->tasks.size() == 0) {
+						std::unique_lock lock{ workerAccessMutex };
+						if (currentCount.load(std::memory_order_acquire) > threadCount && thread->tasks.size() == 0) {
+							for (auto& [key, value]: getMap()) {
+								if (value.get() == thread) {
+									uint64_t keyNew{ key };
+									currentCount.fetch_sub(1, std::memory_order_release);
+									thread->thread.detach();
+									getMap().erase(keyNew);
+									return;
 								}
 							}
-							std::unique_lock lock{ workerAccessMutex };
-							auto oldThread = begin() + currentHighestIndex;
-							if (oldThread->second->thread.joinable()) {
-								oldThread->second->thread.request_stop();
-								oldThread->second->thread.detach();
-								currentCount.fetch_sub(1, std::memory_order_release);
-								getMap().erase(oldThread->first);
-							}
 						}
 					}
 					std::this_thread::sleep_for(std::chrono::nanoseconds{ 100000 });
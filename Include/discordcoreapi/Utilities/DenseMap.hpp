@@ -0,0 +1,202 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// DenseMap.hpp - Header for the dense_map class.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file DenseMap.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/UnorderedMap.hpp>
+#include <vector>
+
+namespace discord_core_api {
+
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// @brief A map that keeps its key/value pairs packed contiguously in a vector, beside an unordered_map from each key to its position - for maps that are iterated
+	/// far more often than they are modified, so that iteration is a linear walk over packed memory. erasure moves the last pair into the erased pair's place, so it
+	/// invalidates iterators and references to the last pair, and iteration follows insertion order only until the first erasure.
+	/// @tparam key_type_new the type of the key.
+	/// @tparam value_type_new the type of the value.
+	template<typename key_type_new, typename value_type_new> class dense_map {
+	  public:
+		using key_type		  = key_type_new;
+		using mapped_type	  = value_type_new;
+		using value_type	  = std::pair<key_type_new, value_type_new>;
+		using size_type		  = uint64_t;
+		using difference_type = int64_t;
+		using reference		  = value_type&;
+		using const_reference = const value_type&;
+		using iterator		  = typename std::vector<value_type>::iterator;
+		using const_iterator  = typename std::vector<value_type>::const_iterator;
+
+		inline dense_map() = default;
+
+		inline dense_map(std::initializer_list<value_type> list) {
+			reserve(list.size());
+			for (auto& value: list) {
+				emplace(value.first, value.second);
+			}
+		};
+
+		/// @brief Inserts a key/value pair, or overwrites the value if the key is already present - as with unordered_map.
+		template<typename... mapped_type_new> inline iterator emplace(key_type key, mapped_type_new&&... value) {
+			if (auto iter = indices.find(key); iter != indices.end()) {
+				if constexpr (sizeof...(mapped_type_new) > 0) {
+					values[iter->second].second = mapped_type{ std::forward<mapped_type_new>(value)... };
+				}
+				return values.begin() + static_cast<difference_type>(iter->second);
+			}
+			indices.emplace(key, values.size());
+			values.emplace_back(std::move(key), mapped_type{ std::forward<mapped_type_new>(value)... });
+			return values.end() - 1;
+		}
+
+		inline mapped_type& operator[](const key_type& key) {
+			if (auto iter = indices.find(key); iter != indices.end()) {
+				return values[iter->second].second;
+			}
+			return emplace(key)->second;
+		}
+
+		inline const mapped_type& at(const key_type& key) const {
+			auto iter = find(key);
+			if (iter == end()) {
+				throw std::runtime_error{ "Sorry, but an object by that key doesn't exist in this map." };
+			}
+			return iter->second;
+		}
+
+		inline mapped_type& at(const key_type& key) {
+			auto iter = find(key);
+			if (iter == end()) {
+				throw std::runtime_error{ "Sorry, but an object by that key doesn't exist in this map." };
+			}
+			return iter->second;
+		}
+
+		inline const_iterator find(const key_type& key) const {
+			if (auto iter = indices.find(key); iter != indices.end()) {
+				return values.begin() + static_cast<difference_type>(iter->second);
+			}
+			return values.end();
+		}
+
+		inline iterator find(const key_type& key) {
+			if (auto iter = indices.find(key); iter != indices.end()) {
+				return values.begin() + static_cast<difference_type>(iter->second);
+			}
+			return values.end();
+		}
+
+		inline bool contains(const key_type& key) const {
+			return indices.contains(key);
+		}
+
+		/// @brief Erases a key/value pair.
+		/// @return iterator the pair that took the erased one's place, or end() if none did.
+		inline iterator erase(const key_type& key) {
+			auto iter = indices.find(key);
+			if (iter == indices.end()) {
+				return values.end();
+			}
+			size_type index{ iter->second };
+			indices.erase(key);
+			return eraseIndex(index);
+		}
+
+		/// @brief Erases a key/value pair.
+		/// @return iterator the pair that took the erased one's place, or end() if none did.
+		inline iterator erase(iterator iter) {
+			size_type index{ static_cast<size_type>(iter - values.begin()) };
+			indices.erase(iter->first);
+			return eraseIndex(index);
+		}
+
+		inline const_iterator begin() const {
+			return values.begin();
+		}
+
+		inline const_iterator end() const {
+			return values.end();
+		}
+
+		inline iterator begin() {
+			return values.begin();
+		}
+
+		inline iterator end() {
+			return values.end();
+		}
+
+		inline size_type size() const {
+			return values.size();
+		}
+
+		inline bool empty() const {
+			return values.empty();
+		}
+
+		inline void reserve(size_type sizeNew) {
+			values.reserve(sizeNew);
+			indices.reserve(sizeNew);
+		}
+
+		inline size_type capacity() const {
+			return values.capacity();
+		}
+
+		inline void swap(dense_map& other) {
+			std::swap(indices, other.indices);
+			std::swap(values, other.values);
+		}
+
+		inline void clear() {
+			indices.clear();
+			values.clear();
+		}
+
+	  protected:
+		unordered_map<key_type, size_type> indices{};
+		std::vector<value_type> values{};
+
+		inline iterator eraseIndex(size_type index) {
+			if (index + 1 != values.size()) {
+				values[index] = std::move(values.back());
+				// the moved key is always present, so it's looked up rather than default-inserted - which the legacy table can do twice for a key it already holds.
+				indices.find(values[index].first)->second = index;
+			}
+			values.pop_back();
+			return values.begin() + static_cast<difference_type>(index);
+		}
+	};
+
+	/**@}*/
+
+}
@@ -0,0 +1,225 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// Epoch.hpp - Header for the epoch-based memory reclamation classes.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file Epoch.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/Base.hpp>
+#include <algorithm>
+#include <limits>
+#include <chrono>
+#include <thread>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/**
+		 * \addtogroup discord_core_internal
+		 * @{
+		 */
+
+		/// @brief A reader's announcement of the epoch that it started in - on its own cache line, so that readers don't contend on each other's slots.
+		struct alignas(64) epoch_reader_slot {
+			std::atomic_uint64_t epoch{ std::numeric_limits<uint64_t>::max() };
+			std::atomic_bool inUse{};
+		};
+
+		/// @brief An unlinked object that is waiting to be deleted, along with the epoch that it was retired in.
+		struct epoch_retired_object {
+			void* ptr{};
+			void (*deleter)(void*){};
+			uint64_t epoch{};
+		};
+
+		/// @brief Epoch-based reclamation, for objects that readers may still be looking at after a writer has unlinked them. readers announce the epoch
+		/// that they started in, writers retire unlinked objects into the current epoch, and retired objects are only deleted once the global epoch has
+		/// moved two steps past theirs - which can't happen while any reader that might have seen them is still active.
+		class epoch_manager {
+		  public:
+			static constexpr uint64_t inactiveEpoch{ std::numeric_limits<uint64_t>::max() };
+			static constexpr uint64_t maxReaderSlots{ 1024 };
+			static constexpr uint64_t reclaimThreshold{ 64 };
+			static constexpr std::chrono::nanoseconds reclaimInterval{ std::chrono::milliseconds{ 10 } };
+
+			/// @brief Claims a reader slot, and announces the current epoch in it - yielding until one frees up, if every slot is in use.
+			/// @return uint64_t the index of the claimed slot.
+			inline static uint64_t enter() {
+				thread_local uint64_t slotHint{ std::hash<std::thread::id>{}(std::this_thread::get_id()) % maxReaderSlots };
+				while (true) {
+					for (uint64_t x = 0; x < maxReaderSlots; ++x) {
+						uint64_t index{ (slotHint + x) % maxReaderSlots };
+						bool expected{ false };
+						if (readerSlots[index].inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+							// the announcement has to be visible before any of the reader's loads from the protected structure.
+							readerSlots[index].epoch.store(globalEpoch.load(std::memory_order_acquire), std::memory_order_seq_cst);
+							slotHint = index;
+							return index;
+						}
+					}
+					std::this_thread::yield();
+				}
+			}
+
+			/// @brief Withdraws the announcement in a reader slot, and releases it - reclaiming whatever it can, at most once per reclaimInterval, so that fewer
+			/// than reclaimThreshold retired objects don't wait on the next retire() for however long that takes.
+			/// @param index the index of the slot.
+			inline static void exit(uint64_t index) {
+				readerSlots[index].epoch.store(inactiveEpoch, std::memory_order_release);
+				readerSlots[index].inUse.store(false, std::memory_order_release);
+				if (retiredCount.load(std::memory_order_acquire) > 0) {
+					tryReclaim();
+				}
+			}
+
+			/// @brief Hands an unlinked object over, to be deleted once no reader can still be looking at it.
+			/// @tparam value_type the type of the object.
+			/// @param ptr the object, which must have been allocated with new.
+			template<typename value_type> inline static void retire(value_type* ptr) {
+				if (!ptr) {
+					return;
+				}
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				std::unique_lock lock{ retireMutex };
+				retiredObjects.emplace_back(epoch_retired_object{ ptr,
+					[](void* other) {
+						delete static_cast<value_type*>(other);
+					},
+					globalEpoch.load(std::memory_order_acquire) });
+				retiredCount.store(retiredObjects.size(), std::memory_order_release);
+				if (retiredObjects.size() >= reclaimThreshold) {
+					tryAdvance();
+					reclaim();
+				}
+			}
+
+			/// @brief Collects the number of retired objects that are still waiting to be deleted.
+			inline static uint64_t getRetiredCount() {
+				std::unique_lock lock{ retireMutex };
+				return retiredObjects.size();
+			}
+
+		  protected:
+			inline static std::array<epoch_reader_slot, maxReaderSlots> readerSlots{};
+			inline static std::vector<epoch_retired_object> retiredObjects{};
+			inline static std::atomic_int64_t lastReclaimTime{};
+			inline static std::atomic_uint64_t retiredCount{};
+			inline static std::atomic_uint64_t globalEpoch{};
+			inline static std::mutex retireMutex{};
+
+			/// @brief Advances the epoch and reclaims, unless that was last done under reclaimInterval ago - or a writer is holding retireMutex, in which case
+			/// the next exit() tries again, rather than this one waiting.
+			inline static void tryReclaim() {
+				int64_t currentTime{ std::chrono::steady_clock::now().time_since_epoch().count() };
+				int64_t lastTime{ lastReclaimTime.load(std::memory_order_acquire) };
+				if (currentTime - lastTime < std::chrono::duration_cast<std::chrono::steady_clock::duration>(reclaimInterval).count() ||
+					!lastReclaimTime.compare_exchange_strong(lastTime, currentTime, std::memory_order_acq_rel)) {
+					return;
+				}
+				std::unique_lock lock{ retireMutex, std::try_to_lock };
+				if (lock.owns_lock()) {
+					tryAdvance();
+					reclaim();
+				}
+			}
+
+			/// @brief Moves the global epoch forward, if every active reader has caught up with it.
+			inline static void tryAdvance() {
+				uint64_t currentEpoch{ globalEpoch.load(std::memory_order_acquire) };
+				for (auto& value: readerSlots) {
+					uint64_t readerEpoch{ value.epoch.load(std::memory_order_acquire) };
+					if (readerEpoch != inactiveEpoch && readerEpoch != currentEpoch) {
+						return;
+					}
+				}
+				globalEpoch.compare_exchange_strong(currentEpoch, currentEpoch + 1, std::memory_order_acq_rel);
+			}
+
+			/// @brief Deletes the retired objects that are at least two epochs old - must be called with retireMutex held.
+			inline static void reclaim() {
+				uint64_t currentEpoch{ globalEpoch.load(std::memory_order_acquire) };
+				auto newEnd = std::remove_if(retiredObjects.begin(), retiredObjects.end(), [&](epoch_retired_object& value) {
+					if (value.epoch + 2 <= currentEpoch) {
+						value.deleter(value.ptr);
+						return true;
+					}
+					return false;
+				});
+				retiredObjects.erase(newEnd, retiredObjects.end());
+				retiredCount.store(retiredObjects.size(), std::memory_order_release);
+			}
+		};
+
+		/// @brief A scoped guard for a reader's announcement in the epoch_manager.
+		class epoch_guard {
+		  public:
+			inline epoch_guard& operator=(epoch_guard&& other) noexcept {
+				if (this != &other) {
+					release();
+					std::swap(slotIndex, other.slotIndex);
+				}
+				return *this;
+			}
+
+			inline epoch_guard(epoch_guard&& other) noexcept {
+				*this = std::move(other);
+			}
+
+			inline epoch_guard& operator=(const epoch_guard&) = delete;
+			inline epoch_guard(const epoch_guard&)			  = delete;
+
+			/// @brief Enters the current epoch.
+			inline epoch_guard() : slotIndex{ epoch_manager::enter() } {};
+
+			/// @brief Creates a guard that hasn't entered any epoch.
+			inline static epoch_guard empty() {
+				return epoch_guard{ epoch_manager::maxReaderSlots };
+			}
+
+			inline ~epoch_guard() {
+				release();
+			}
+
+		  protected:
+			uint64_t slotIndex{ epoch_manager::maxReaderSlots };
+
+			inline explicit epoch_guard(uint64_t slotIndexNew) : slotIndex{ slotIndexNew } {};
+
+			inline void release() {
+				if (slotIndex < epoch_manager::maxReaderSlots) {
+					epoch_manager::exit(slotIndex);
+					slotIndex = epoch_manager::maxReaderSlots;
+				}
+			}
+		};
+
+		/**@}*/
+
+	}
+
+}
@@ -30,6 +30,8 @@
 #pragma once
 
 #include <discordcoreapi/FoundationEntities.hpp>
+#include <future>
+#include <memory>
 
 namespace discord_core_api {
 
@@ -76,6 +78,28 @@ namespace discord_core_api {
 
 	namespace discord_core_internal {
 
+		/// @brief A callable that takes an event's arguments by non-const or rvalue reference, as delegates could before an event's arguments were shared
+		/// between all of its delegates - rather than by value or by const reference, as they're now passed.
+		template<typename function_type, typename... arg_types>
+		concept mutable_arg_callable = !std::is_invocable_v<function_type&, const arg_types&...> &&
+			(std::is_invocable_v<function_type&, arg_types&...> || std::is_invocable_v<function_type&, arg_types&&...>);
+
+		/// @brief Wraps a mutable_arg_callable in the const-reference signature that delegates are called through, by handing it its own copies of the
+		/// arguments on each call.
+		/// @param functionNew the callable to wrap.
+		/// @return std::function<return_type(const arg_types&...)> the wrapped callable.
+		template<typename return_type, typename... arg_types, typename function_type>
+		inline std::function<return_type(const arg_types&...)> wrapMutableArgCallable(function_type&& functionNew) {
+			return [functionNew = std::forward<function_type>(functionNew)](const arg_types&... args) mutable -> return_type {
+				std::tuple<arg_types...> argsNew{ args... };
+				if constexpr (std::is_invocable_v<std::remove_cvref_t<function_type>&, arg_types&...>) {
+					return std::apply(functionNew, argsNew);
+				} else {
+					return std::apply(functionNew, std::move(argsNew));
+				}
+			};
+		}
+
 		/// @brief Event-delegate, representing an event function to be executed.
 		template<typename return_type, typename... arg_types> class event_delegate {
 		  public:
@@ -95,6 +119,7 @@ namespace discord_core_api {
 			inline event_delegate& operator=(event_delegate&& other) noexcept {
 				if (this != &other) {
 					function.swap(other.function);
+					std::swap(ordered, other.ordered);
 				}
 				return *this;
 			}
@@ -109,20 +134,35 @@ namespace discord_core_api {
 			}
 
 			/// @brief Assignment operator to set the delegate function.
-			/// this operator assigns a new std::function, 'functionNew', as the delegate function of the current instance.
+			/// this operator assigns a new std::function, 'functionNew', as the delegate function of the current instance. a function that takes its arguments by
+			/// const reference is handed the event's shared arguments without their being copied.
 			/// @param functionNew the std::function to assign as the current event.
 			/// @return reference to the current event_delegate instance after the assignment.
-			inline event_delegate& operator=(std::function<return_type(arg_types...)> functionNew) {
+			inline event_delegate& operator=(std::function<return_type(const arg_types&...)> functionNew) {
 				function = functionNew;
 				return *this;
 			}
 
-			/// @brief Constructor, taking a std::function<return_type(arg_types...)> as an argument.
+			/// @brief Constructor, taking a std::function<return_type(const arg_types&...)> as an argument.
 			/// @param functionNew the function to construct as the current event.
-			inline event_delegate(std::function<return_type(arg_types...)> functionNew) {
+			inline event_delegate(std::function<return_type(const arg_types&...)> functionNew) {
 				*this = functionNew;
 			}
 
+			/// @brief Assignment operator for functions that take the event's arguments by non-const or rvalue reference - each call hands them their own copies.
+			/// @param functionNew the function to assign as the current event.
+			/// @return reference to the current event_delegate instance after the assignment.
+			template<mutable_arg_callable<arg_types...> function_type> inline event_delegate& operator=(function_type&& functionNew) {
+				function = wrapMutableArgCallable<return_type, arg_types...>(std::forward<function_type>(functionNew));
+				return *this;
+			}
+
+			/// @brief Constructor for functions that take the event's arguments by non-const or rvalue reference - each call hands them their own copies.
+			/// @param functionNew the function to construct as the current event.
+			template<mutable_arg_callable<arg_types...> function_type> inline event_delegate(function_type&& functionNew) {
+				*this = std::forward<function_type>(functionNew);
+			}
+
 			/// @brief Assignment operator to set the delegate function using a function pointer.
 			/// this operator assigns a new function pointer, 'functionNew', as the delegate function of the current instance.
 			/// @param functionNew the function pointer to assign as the current event.
@@ -141,14 +181,68 @@ namespace discord_core_api {
 				*this = functionNew;
 			}
 
+			/// @brief Marks the delegate as ordered - an event's ordered delegates run one after another, in the order that they were added, rather than
+			/// alongside the rest.
+			/// @param orderedNew whether or not the delegate is ordered.
+			/// @return reference to the current event_delegate instance.
+			inline event_delegate& setOrdered(bool orderedNew) {
+				ordered = orderedNew;
+				return *this;
+			}
+
+		  protected:
+			std::function<return_type(const arg_types&...)> function{};
+			bool ordered{};
+		};
+
+		/// @brief A shared_ptr that is published and collected atomically, so that readers never have to take a lock - std::atomic<std::shared_ptr> where the standard
+		/// library provides it.
+		template<typename value_type> class atomic_shared_ptr {
+		  public:
+			inline atomic_shared_ptr() = default;
+
+			inline std::shared_ptr<value_type> load() const {
+#if defined(__cpp_lib_atomic_shared_ptr)
+				return value.load(std::memory_order_acquire);
+#else
+				return std::atomic_load_explicit(&value, std::memory_order_acquire);
+#endif
+			}
+
+			inline void store(std::shared_ptr<value_type> valueNew) {
+#if defined(__cpp_lib_atomic_shared_ptr)
+				value.store(std::move(valueNew), std::memory_order_release);
+#else
+				std::atomic_store_explicit(&value, std::move(valueNew), std::memory_order_release);
+#endif
+			}
+
 		  protected:
-			std::function<return_type(arg_types...)> function{};
+#if defined(__cpp_lib_atomic_shared_ptr)
+			std::atomic<std::shared_ptr<value_type>> value{};
+#else
+			std::shared_ptr<value_type> value{};
+#endif
+		};
+
+		/// @brief Counts down the thread-pool tasks of a single dispatch, and invokes a callback once the last of them has finished.
+		struct event_completion {
+			std::atomic_uint64_t remainingTasks{};
+			std::function<void()> onComplete{};
+
+			inline void finishTask() {
+				if (remainingTasks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+					onComplete();
+				}
+			}
 		};
 
 		/// @brief Template class representing an event that executes event functions.
 		template<typename return_type, typename... arg_types> class event {
 		  public:
-			unordered_map<event_delegate_token, event_delegate<return_type, arg_types...>> functions{};
+			using delegate_type = event_delegate<return_type, arg_types...>;
+			using delegate_list = std::vector<std::pair<event_delegate_token, std::shared_ptr<delegate_type>>>;
+			using shared_args	= std::tuple<std::shared_ptr<const arg_types>...>;///< The arguments of a single invocation, held once and shared by all of its tasks.
 
 			inline event& operator=(const event& other) = delete;
 			inline event(const event& other)			= delete;
@@ -160,7 +254,9 @@ namespace discord_core_api {
 			/// @return reference to the current event instance after the move assignment.
 			inline event& operator=(event&& other) noexcept {
 				if (this != &other) {
-					std::swap(functions, other.functions);
+					auto functionsNew = functions.load();
+					functions.store(other.functions.load());
+					other.functions.store(std::move(functionsNew));
 					std::swap(eventId, other.eventId);
 				}
 				return *this;
@@ -184,12 +280,14 @@ namespace discord_core_api {
 			/// @brief Add an event delegate to the event.
 			/// @param eventDelegate the event delegate to add.
 			/// @return event_delegate_token the token representing the added event delegate.
-			inline event_delegate_token add(event_delegate<return_type, arg_types...>&& eventDelegate) {
+			inline event_delegate_token add(delegate_type&& eventDelegate) {
 				std::unique_lock lock{ accessMutex };
 				event_delegate_token eventToken{};
-				eventToken.handlerId  = std::chrono::duration_cast<std::chrono::duration<uint64_t, std::micro>>(sys_clock::now().time_since_epoch()).count();
-				eventToken.eventId	  = eventId;
-				functions[eventToken] = std::move(eventDelegate);
+				eventToken.handlerId = std::chrono::duration_cast<std::chrono::duration<uint64_t, std::micro>>(sys_clock::now().time_since_epoch()).count();
+				eventToken.eventId	 = eventId;
+				auto functionsNew	 = copyFunctions();
+				functionsNew->emplace_back(eventToken, std::make_shared<delegate_type>(std::move(eventDelegate)));
+				functions.store(std::move(functionsNew));
 				return eventToken;
 			}
 
@@ -198,24 +296,69 @@ namespace discord_core_api {
 			inline void erase(const event_delegate_token& eventToken) {
 				std::unique_lock lock{ accessMutex };
 				if (eventToken.eventId == eventId) {
-					if (functions.contains(eventToken)) {
-						functions.erase(eventToken);
-					}
+					auto functionsNew = copyFunctions();
+					std::erase_if(*functionsNew, [&](const auto& value) {
+						return value.first == eventToken;
+					});
+					functions.store(std::move(functionsNew));
 				}
 			}
 
-			/// @brief Invoke the event with provided arguments.
+			/// @brief Collects the number of event delegates currently added to the event.
+			inline uint64_t size() const {
+				auto functionsNew = functions.load();
+				return functionsNew ? functionsNew->size() : 0;
+			}
+
+			/// @brief Removes all of the event delegates.
+			inline void clear() {
+				std::unique_lock lock{ accessMutex };
+				functions.store(nullptr);
+			}
+
+			/// @brief Invoke the event with provided arguments - launching each delegate on the thread pool, without waiting for any of them.
 			/// @param args the arguments to pass to the event delegates.
 			inline void operator()(const arg_types&... args) {
-				std::unique_lock lock{ accessMutex };
-				for (auto& [key, value]: functions) {
-					try {
-						value.function(args...).get();
-					} catch (const dca_exception& error) {
-						message_printer::printError<print_message_type::general>(error.what());
-					}
-				}
-				return;
+				launch(nullptr, shared_args{ std::make_shared<const arg_types>(args)... });
+			}
+
+			/// @brief Invoke the event with provided arguments, and collect a future that becomes ready once every delegate has finished - for callers that need to
+			/// join.
+			/// @param args the arguments to pass to the event delegates.
+			/// @return std::future<void> the completion future.
+			inline std::future<void> dispatch(const arg_types&... args) {
+				return dispatch(std::make_shared<const arg_types>(args)...);
+			}
+
+			/// @brief Invoke the event with arguments that are already shared and immutable - every delegate is handed the same objects, which are released once
+			/// the last of the delegates has finished with them.
+			/// @param argsNew the arguments to pass to the event delegates.
+			/// @return std::future<void> the completion future.
+			inline std::future<void> dispatch(std::shared_ptr<const arg_types>... argsNew) requires(sizeof...(arg_types) > 0) {
+				auto promise = std::make_shared<std::promise<void>>();
+				auto returnValue{ promise->get_future() };
+				dispatch(
+					[promise]() {
+						promise->set_value();
+					},
+					std::move(argsNew)...);
+				return returnValue;
+			}
+
+			/// @brief Invoke the event with shared, immutable arguments, and invoke a callback - on whichever thread finishes last - once every delegate has
+			/// finished, or straight away if there are none. for callers that need to chain work after the delegates, without blocking a thread to join them.
+			/// @param onComplete the callback to invoke.
+			/// @param argsNew the arguments to pass to the event delegates.
+			inline void dispatch(std::function<void()> onComplete, std::shared_ptr<const arg_types>... argsNew) requires(sizeof...(arg_types) > 0) {
+				auto completion		   = std::make_shared<event_completion>();
+				completion->onComplete = std::move(onComplete);
+				launch(completion, shared_args{ std::move(argsNew)... });
+			}
+
+			/// @brief Invoke the event with shared, immutable arguments - launching each delegate on the thread pool, without waiting for any of them.
+			/// @param argsNew the arguments to pass to the event delegates.
+			inline void operator()(std::shared_ptr<const arg_types>... argsNew) requires(sizeof...(arg_types) > 0) {
+				launch(nullptr, shared_args{ std::move(argsNew)... });
 			}
 
 			~event() {
@@ -226,8 +369,69 @@ namespace discord_core_api {
 			}
 
 		  protected:
+			atomic_shared_ptr<const delegate_list> functions{};
 			std::mutex accessMutex{};
 			uint64_t eventId{};
+
+			/// @brief Copies the current snapshot of the delegates, to be modified and then published in its place.
+			inline std::shared_ptr<delegate_list> copyFunctions() const {
+				auto functionsOld = functions.load();
+				return functionsOld ? std::make_shared<delegate_list>(*functionsOld) : std::make_shared<delegate_list>();
+			}
+
+			/// @brief Launches the delegates of the current snapshot - each unordered one on its own thread-pool task, and the ordered ones together, in the order
+			/// that they were added, on a single task.
+			inline void launch(std::shared_ptr<event_completion> completion, const shared_args& argsNew) {
+				auto functionsNew = functions.load();
+				if (!functionsNew || functionsNew->empty()) {
+					if (completion) {
+						completion->onComplete();
+					}
+					return;
+				}
+				uint64_t orderedCount{ static_cast<uint64_t>(std::count_if(functionsNew->begin(), functionsNew->end(), [](const auto& value) {
+					return value.second->ordered;
+				})) };
+				if (completion) {
+					completion->remainingTasks.store(functionsNew->size() - orderedCount + (orderedCount > 0 ? 1 : 0), std::memory_order_release);
+				}
+				for (uint64_t x = 0; x < functionsNew->size(); ++x) {
+					if (!(*functionsNew)[x].second->ordered) {
+						runDelegates(functionsNew, x, x + 1, false, argsNew, completion);
+					}
+				}
+				if (orderedCount > 0) {
+					runDelegates(functionsNew, 0, functionsNew->size(), true, argsNew, completion);
+				}
+			}
+
+			/// @brief Runs a range of a snapshot's delegates on the thread pool, one after another - an unordered delegate alone, or all of the ordered ones. the
+			/// task is detached, so its frame - and with it the snapshot, the arguments and the completion - is freed as soon as it finishes.
+			inline static detached_task runDelegates(std::shared_ptr<const delegate_list> functionsNew, uint64_t startIndex, uint64_t endIndex, bool orderedOnly,
+				shared_args argsNew, std::shared_ptr<event_completion> completion) {
+				// held in a body-scoped local, so that this task's references to the payload are dropped before the completion is signalled.
+				shared_args args{ std::move(argsNew) };
+				for (uint64_t x = startIndex; x < endIndex; ++x) {
+					auto& delegate = *(*functionsNew)[x].second;
+					if (orderedOnly && !delegate.ordered) {
+						continue;
+					}
+					try {
+						std::apply(
+							[&](const auto&... values) {
+								delegate.function(*values...).get();
+							},
+							args);
+					} catch (const std::exception& error) {
+						message_printer::printError<print_message_type::general>(error.what());
+					}
+				}
+				args = shared_args{};
+				if (completion) {
+					completion->finishTask();
+				}
+				co_return;
+			}
 		};
 
 		/// @brief Event-delegate, for representing an event-function to be executed conditionally.
@@ -261,7 +465,7 @@ namespace discord_core_api {
 			/// this operator assigns a new std::function, 'functionNew', as the delegate function of the current instance.
 			/// @param functionNew the std::function to assign as the current event.
 			/// @return reference to the current trigger_event_delegate instance after the assignment.
-			inline trigger_event_delegate& operator=(std::function<return_type(arg_types...)> functionNew) {
+			inline trigger_event_delegate& operator=(std::function<return_type(const arg_types&...)> functionNew) {
 				function = functionNew;
 				return *this;
 			}
@@ -271,11 +475,25 @@ namespace discord_core_api {
 			/// this constructor initializes the trigger_event_delegate instance with the provided std::function.
 			/// it calls the assignment operator to set the delegate function using the provided std::function.
 			/// @param functionNew the function to construct as the current event.
-			inline trigger_event_delegate(std::function<return_type(arg_types...)> functionNew) {
+			inline trigger_event_delegate(std::function<return_type(const arg_types&...)> functionNew) {
 				// call the assignment operator to set the delegate function using the provided std::function.
 				*this = functionNew;
 			}
 
+			/// @brief Assignment operator for functions that take the event's arguments by non-const or rvalue reference - each call hands them their own copies.
+			/// @param functionNew the function to assign as the current event.
+			/// @return reference to the current trigger_event_delegate instance after the assignment.
+			template<mutable_arg_callable<arg_types...> function_type> inline trigger_event_delegate& operator=(function_type&& functionNew) {
+				function = wrapMutableArgCallable<return_type, arg_types...>(std::forward<function_type>(functionNew));
+				return *this;
+			}
+
+			/// @brief Constructor for functions that take the event's arguments by non-const or rvalue reference - each call hands them their own copies.
+			/// @param functionNew the function to construct as the current event.
+			template<mutable_arg_callable<arg_types...> function_type> inline trigger_event_delegate(function_type&& functionNew) {
+				*this = std::forward<function_type>(functionNew);
+			}
+
 			/// @brief Assignment operator to set the delegate function using a function pointer.
 			/// this operator assigns a new function pointer, 'functionNew', as the delegate function of the current instance.
 			/// @param functionNew the function pointer to assign as the current event.
@@ -297,7 +515,7 @@ namespace discord_core_api {
 
 			/// @brief Sets the test function to determine conditional execution.
 			/// @param testFunctionNew the test function to set.
-			inline void setTestFunction(std::function<bool(arg_types...)> testFunctionNew) {
+			inline void setTestFunction(std::function<bool(const arg_types&...)> testFunctionNew) {
 				testFunction = testFunctionNew;
 			}
 
@@ -307,15 +525,21 @@ namespace discord_core_api {
 				testFunction = testFunctionNew;
 			}
 
+			/// @brief Sets a test function that takes the event's arguments by non-const or rvalue reference - each call hands it its own copies.
+			/// @param testFunctionNew the test function to set.
+			template<mutable_arg_callable<arg_types...> function_type> inline void setTestFunction(function_type&& testFunctionNew) {
+				testFunction = wrapMutableArgCallable<bool, arg_types...>(std::forward<function_type>(testFunctionNew));
+			}
+
 		  protected:
-			std::function<return_type(arg_types...)> function{};
-			std::function<bool(arg_types...)> testFunction{};
+			std::function<return_type(const arg_types&...)> function{};
+			std::function<bool(const arg_types&...)> testFunction{};
 		};
 
 		/// @brief A trigger event that fires based on the result of trigger-function return value.
 		template<typename return_type, typename... arg_types> class trigger_event {
 		  public:
-			unordered_map<event_delegate_token, trigger_event_delegate<return_type, arg_types...>> functions{};
+			dense_map<event_delegate_token, trigger_event_delegate<return_type, arg_types...>> functions{};
 
 			inline trigger_event& operator=(const trigger_event& other) = delete;
 			inline trigger_event(const trigger_event& other)			= delete;
@@ -375,15 +599,17 @@ namespace discord_core_api {
 			/// @param args the arguments to pass to the trigger event delegates.
 			inline void operator()(const arg_types&... args) {
 				std::unique_lock lock{ accessMutex };
-				for (auto iterator = functions.begin(); iterator != functions.end(); ++iterator) {
+				for (auto iterator = functions.begin(); iterator != functions.end();) {
 					try {
-						if (iterator.operator*().second.testFunction(args...)) {
-							iterator.operator*().second.function(args...);
-							iterator = functions.erase(iterator->first);
+						if (iterator->second.testFunction(args...)) {
+							iterator->second.function(args...);
+							iterator = functions.erase(iterator);
+							continue;
 						}
 					} catch (const dca_exception& error) {
 						message_printer::printError<print_message_type::general>(error.what());
 					}
+					++iterator;
 				}
 				return;
 			}
@@ -0,0 +1,107 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// EventQueue.hpp - Header for the per-guild ordered event queues.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file EventQueue.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/Base.hpp>
+#include <discordcoreapi/Utilities/UnorderedMap.hpp>
+#include <functional>
+#include <deque>
+#include <bit>
+
+namespace discord_core_api {
+
+	class detached_task;
+
+	namespace discord_core_internal {
+
+		/**
+		* \addtogroup discord_core_internal
+		* @{
+		*/
+
+		/// @brief A set of fifo queues of event tasks, one per key - a guild's id, or a channel's id for events outside of a guild. the tasks under a key run one at a
+		/// time, in the order that they were enqueued, while the tasks under different keys run in parallel - so that a burst of events in one guild never delays
+		/// the others. each task is handed a completion callback, which it must invoke exactly once, when it and everything that it launched have finished - the
+		/// key's next task is chained from that callback, so that no thread is ever blocked waiting on a task's delegates.
+		class DiscordCoreAPI_Dll ordered_event_queue {
+		  public:
+			using completion_type = std::function<void()>;
+			using task_type		  = std::function<void(completion_type)>;
+
+			static constexpr uint64_t shardCount{ 32 };
+
+			inline ordered_event_queue() = default;
+
+			/// @brief Enqueues a task under a key, launching a drain of the key's queue on the thread pool if one isn't already running.
+			/// @param key the key to order the task under.
+			/// @param task the task to be run.
+			/// @return bool false if the queue has been stopped, and the task was dropped.
+			bool enqueue(uint64_t key, task_type&& task);
+
+			/// @brief Stops accepting new tasks, and blocks until every task that was already enqueued has finished.
+			void stopAndWait();
+
+			/// @brief Collects the number of keys that currently have a drain running.
+			uint64_t activeKeys() const;
+
+		  protected:
+			/// @brief A shard of the queues, padded out to its own cache line. a key is present for exactly as long as a drain of its queue is running.
+			struct alignas(64) queue_shard {
+				unordered_map<uint64_t, std::deque<task_type>> queues{};
+				mutable std::mutex queueMutex{};
+			};
+
+			/// @brief Shared by a running task's completion callback and its drain - whichever of the two arrives second carries on with the key's next task.
+			struct task_state {
+				std::atomic_uint8_t arrivals{};
+				std::atomic_bool completed{};
+			};
+
+			std::array<queue_shard, shardCount> shards{};
+			std::atomic_bool acceptingTasks{ true };
+
+			/// @brief Launches runQueue for a key on the thread pool.
+			/// @param key the key to drain.
+			detached_task drainQueue(uint64_t key);
+
+			/// @brief Runs the tasks under a key, until one of them completes asynchronously - in which case its callback relaunches the drain - or the queue is
+			/// empty.
+			/// @param key the key to drain.
+			void runQueue(uint64_t key);
+
+			inline queue_shard& getShard(uint64_t key) {
+				static constexpr uint64_t shardBits{ static_cast<uint64_t>(std::countr_zero(shardCount)) };
+				return shards[key_hasher<uint64_t>::getHashKey(key) >> (64 - shardBits)];
+			}
+		};
+
+		/**@}*/
+	}
+}
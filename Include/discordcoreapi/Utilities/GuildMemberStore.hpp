@@ -0,0 +1,426 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// GuildMemberStore.hpp - Header for the compact, columnar guild_member store.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file GuildMemberStore.hpp
+#pragma once
+
+#include <discordcoreapi/FoundationEntities.hpp>
+#include <discordcoreapi/Utilities/UnorderedMap.hpp>
+#include <discordcoreapi/Utilities/UniquePtr.hpp>
+#include <optional>
+#include <bit>
+
+namespace discord_core_api {
+
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// @brief A member's roles, as indices into their guild's role table - the first three are held inline, and any further ones spill over into the guild's overflow map.
+	struct compact_role_set {
+		std::array<uint16_t, 3> indices{};///< The first three role indices.
+		uint16_t count{};///< The total number of roles.
+	};
+
+	/// @brief The struct-of-arrays columns holding every cached member of a single guild - row x of each column belongs to the same member.
+	class guild_member_columns {
+	  public:
+		/// @brief Discord's epoch, in seconds since the unix epoch - join times are stored as 32-bit offsets from it, which lasts until 2151.
+		static constexpr uint64_t discordEpochSeconds{ 1420070400ULL };
+
+		inline guild_member_columns() = default;
+
+		/// @brief Adds a member, or overwrites the member with the same user id.
+		/// @param member the member to be stored.
+		inline void emplace(const guild_member_cache_data& member) {
+			uint64_t userId{ member.user.id.operator const uint64_t&() };
+			uint32_t row{};
+			if (auto iter = rows.find(userId); iter != rows.end()) {
+				row = iter->second;
+				releaseNick(nickIds[row]);
+				overflowRoles.erase(row);
+				avatars.erase(row);
+			} else {
+				row = static_cast<uint32_t>(userIds.size());
+				userIds.emplace_back(userId);
+				permissionValues.emplace_back();
+				joinedAtSeconds.emplace_back();
+				nickIds.emplace_back();
+				roleSets.emplace_back();
+				flags.emplace_back();
+				rows.emplace(userId, row);
+			}
+			permissionValues[row] = member.permissionsVal.operator uint64_t();
+			joinedAtSeconds[row]  = compressTimeStamp(member.joinedAt);
+			nickIds[row]		  = internNick(member.nick);
+			flags[row]			  = member.flags;
+			compact_role_set roleSet{};
+			roleSet.count = static_cast<uint16_t>(member.roles.size());
+			for (uint64_t x = 0; x < member.roles.size(); ++x) {
+				uint16_t roleIndex{ getRoleIndex(member.roles[x].operator const uint64_t&()) };
+				if (x < roleSet.indices.size()) {
+					roleSet.indices[x] = roleIndex;
+				} else {
+					overflowRoles[row].emplace_back(roleIndex);
+				}
+			}
+			roleSets[row] = roleSet;
+			if (!(member.avatar == icon_hash{})) {
+				avatars.emplace(row, member.avatar);
+			}
+		}
+
+		/// @brief Rebuilds a member from its row.
+		/// @param guildId the id of the guild that these columns belong to.
+		/// @param userId the user id of the member.
+		/// @return the member, if it is stored here.
+		inline std::optional<guild_member_cache_data> find(uint64_t guildId, uint64_t userId) const {
+			auto iter = rows.find(userId);
+			if (iter == rows.end()) {
+				return std::nullopt;
+			}
+			uint32_t row{ iter->second };
+			guild_member_cache_data returnData{};
+			returnData.user.id		  = userId;
+			returnData.guildId		  = guildId;
+			returnData.permissionsVal = permissionValues[row];
+			returnData.joinedAt		  = expandTimeStamp(joinedAtSeconds[row]);
+			returnData.flags		  = flags[row];
+			if (nickIds[row] != 0) {
+				returnData.nick = nickPool[nickIds[row] - 1];
+			}
+			const auto& roleSet = roleSets[row];
+			returnData.roles.reserve(roleSet.count);
+			for (uint64_t x = 0; x < roleSet.count && x < roleSet.indices.size(); ++x) {
+				returnData.roles.emplace_back(roleTable[roleSet.indices[x]]);
+			}
+			if (roleSet.count > roleSet.indices.size()) {
+				for (auto& value: overflowRoles.at(row)) {
+					returnData.roles.emplace_back(roleTable[value]);
+				}
+			}
+			if (auto avatarIter = avatars.find(row); avatarIter != avatars.end()) {
+				returnData.avatar = avatarIter->second;
+			}
+			return returnData;
+		}
+
+		/// @brief Checks whether a member is stored here.
+		/// @param userId the user id of the member.
+		inline bool contains(uint64_t userId) const {
+			return rows.contains(userId);
+		}
+
+		/// @brief Removes a member, by moving the last row into its place.
+		/// @param userId the user id of the member.
+		inline void erase(uint64_t userId) {
+			auto iter = rows.find(userId);
+			if (iter == rows.end()) {
+				return;
+			}
+			uint32_t row{ iter->second };
+			uint32_t lastRow{ static_cast<uint32_t>(userIds.size() - 1) };
+			rows.erase(userId);
+			releaseNick(nickIds[row]);
+			overflowRoles.erase(row);
+			avatars.erase(row);
+			if (row != lastRow) {
+				userIds[row]		  = userIds[lastRow];
+				permissionValues[row] = permissionValues[lastRow];
+				joinedAtSeconds[row]  = joinedAtSeconds[lastRow];
+				nickIds[row]		  = nickIds[lastRow];
+				roleSets[row]		  = roleSets[lastRow];
+				flags[row]			  = flags[lastRow];
+				if (auto overflowIter = overflowRoles.find(lastRow); overflowIter != overflowRoles.end()) {
+					auto overflow = std::move(overflowIter->second);
+					overflowRoles.erase(lastRow);
+					overflowRoles.emplace(row, std::move(overflow));
+				}
+				if (auto avatarIter = avatars.find(lastRow); avatarIter != avatars.end()) {
+					auto avatar = avatarIter->second;
+					avatars.erase(lastRow);
+					avatars.emplace(row, avatar);
+				}
+				rows[userIds[row]] = row;
+			}
+			userIds.pop_back();
+			permissionValues.pop_back();
+			joinedAtSeconds.pop_back();
+			nickIds.pop_back();
+			roleSets.pop_back();
+			flags.pop_back();
+		}
+
+		/// @brief Visits every member stored here, expanding each one in turn.
+		/// @param guildId the id of the guild that these columns belong to.
+		/// @param function the function to be called with each member.
+		template<typename function_type> inline void visit(uint64_t guildId, function_type&& function) const {
+			for (auto& value: userIds) {
+				if (auto member = find(guildId, value)) {
+					function(static_cast<const guild_member_cache_data&>(*member));
+				}
+			}
+		}
+
+		/// @brief Collects the number of members stored here.
+		inline uint64_t size() const {
+			return userIds.size();
+		}
+
+		/// @brief Collects the approximate number of bytes that these columns occupy, including their indices and pools.
+		inline uint64_t getMemoryUsage() const {
+			uint64_t returnValue{ sizeof(*this) };
+			returnValue += userIds.capacity() * sizeof(uint64_t) + permissionValues.capacity() * sizeof(uint64_t) + joinedAtSeconds.capacity() * sizeof(uint32_t) +
+				nickIds.capacity() * sizeof(uint32_t) + roleSets.capacity() * sizeof(compact_role_set) + flags.capacity() * sizeof(guild_member_flags);
+			returnValue += rows.capacity() * (sizeof(std::pair<uint64_t, uint32_t>) + 1);
+			returnValue += avatars.capacity() * (sizeof(std::pair<uint32_t, icon_hash>) + 1);
+			returnValue += overflowRoles.capacity() * (sizeof(std::pair<uint32_t, std::vector<uint16_t>>) + 1);
+			for (auto& value: overflowRoles) {
+				returnValue += value.second.capacity() * sizeof(uint16_t);
+			}
+			returnValue += roleTable.capacity() * sizeof(uint64_t) + roleIndices.capacity() * (sizeof(std::pair<uint64_t, uint16_t>) + 1);
+			returnValue += nickPool.capacity() * sizeof(jsonifier::string) + nickRefCounts.capacity() * sizeof(uint32_t) + freeNickIds.capacity() * sizeof(uint32_t);
+			returnValue += nickIndices.capacity() * (sizeof(std::pair<jsonifier::string, uint32_t>) + 1);
+			for (auto& value: nickPool) {
+				returnValue += value.capacity();
+			}
+			return returnValue;
+		}
+
+	  protected:
+		unordered_map<uint32_t, std::vector<uint16_t>> overflowRoles{};///< Roles beyond the first three, by row.
+		unordered_map<jsonifier::string, uint32_t> nickIndices{};///< Interned nicks, to their ids.
+		unordered_map<uint64_t, uint16_t> roleIndices{};///< Role ids, to their indices in the role table.
+		std::vector<compact_role_set> roleSets{};///< Each member's roles.
+		unordered_map<uint32_t, icon_hash> avatars{};///< Guild avatars, by row - most members have none.
+		std::vector<guild_member_flags> flags{};///< Each member's flags.
+		unordered_map<uint64_t, uint32_t> rows{};///< User ids, to their rows.
+		std::vector<jsonifier::string> nickPool{};///< The interned nicks - a nick id of x refers to nickPool[x - 1].
+		std::vector<uint64_t> permissionValues{};///< Each member's base permissions.
+		std::vector<uint32_t> joinedAtSeconds{};///< Each member's join time, in seconds since discordEpochSeconds.
+		std::vector<uint32_t> nickRefCounts{};///< The number of rows referring to each interned nick.
+		std::vector<uint32_t> freeNickIds{};///< Released nick ids, for re-use.
+		std::vector<uint64_t> roleTable{};///< Every role id that a member of this guild has been seen with.
+		std::vector<uint32_t> nickIds{};///< Each member's nick id, or 0 for none.
+		std::vector<uint64_t> userIds{};///< Each member's user id.
+
+		/// @brief Interns a nick, or adds a reference to an already-interned one.
+		/// @param nick the nick to be interned.
+		/// @return the nick's id, or 0 for an empty nick.
+		inline uint32_t internNick(const jsonifier::string& nick) {
+			if (nick.empty()) {
+				return 0;
+			}
+			if (auto iter = nickIndices.find(nick); iter != nickIndices.end()) {
+				++nickRefCounts[iter->second - 1];
+				return iter->second;
+			}
+			uint32_t nickId{};
+			if (!freeNickIds.empty()) {
+				nickId = freeNickIds.back();
+				freeNickIds.pop_back();
+				nickPool[nickId - 1]	  = nick;
+				nickRefCounts[nickId - 1] = 1;
+			} else {
+				nickPool.emplace_back(nick);
+				nickRefCounts.emplace_back(1);
+				nickId = static_cast<uint32_t>(nickPool.size());
+			}
+			nickIndices.emplace(nick, nickId);
+			return nickId;
+		}
+
+		/// @brief Drops a reference to an interned nick, releasing it once nothing refers to it.
+		/// @param nickId the id of the nick.
+		inline void releaseNick(uint32_t nickId) {
+			if (nickId == 0) {
+				return;
+			}
+			if (--nickRefCounts[nickId - 1] == 0) {
+				nickIndices.erase(nickPool[nickId - 1]);
+				nickPool[nickId - 1].clear();
+				freeNickIds.emplace_back(nickId);
+			}
+		}
+
+		/// @brief Collects the index of a role in the role table, adding it if need be.
+		/// @param roleId the id of the role.
+		/// @return the role's index.
+		inline uint16_t getRoleIndex(uint64_t roleId) {
+			if (auto iter = roleIndices.find(roleId); iter != roleIndices.end()) {
+				return iter->second;
+			}
+			if (roleTable.size() >= std::numeric_limits<uint16_t>::max()) {
+				throw dca_exception{ "Sorry, but a guild's role table can't hold any more roles." };
+			}
+			uint16_t roleIndex{ static_cast<uint16_t>(roleTable.size()) };
+			roleTable.emplace_back(roleId);
+			roleIndices.emplace(roleId, roleIndex);
+			return roleIndex;
+		}
+
+		/// @brief Packs a time_stamp into 32-bit seconds since discord's epoch.
+		inline static uint32_t compressTimeStamp(const time_stamp& timeStamp) {
+			uint64_t seconds{ timeStamp.operator uint64_t() / 1000ULL };
+			if (seconds <= discordEpochSeconds) {
+				return 0;
+			}
+			return static_cast<uint32_t>(std::min<uint64_t>(seconds - discordEpochSeconds, std::numeric_limits<uint32_t>::max()));
+		}
+
+		/// @brief Unpacks 32-bit seconds since discord's epoch into a time_stamp.
+		inline static time_stamp expandTimeStamp(uint32_t seconds) {
+			return seconds == 0 ? time_stamp{} : time_stamp{ (static_cast<uint64_t>(seconds) + discordEpochSeconds) * 1000ULL };
+		}
+	};
+
+	/// @brief A compact store for large guild_member caches - each guild's members are held as columns, with interned nicks, role indices and 32-bit join times, and the
+	/// guilds are split into independently-locked shards by id.
+	/// @tparam shardCount the number of shards, which must be a power of two.
+	template<uint64_t shardCount = 32> class guild_member_store {
+	  public:
+		static_assert(shardCount > 0 && (shardCount & (shardCount - 1)) == 0, "Sorry, but the shard count of a guild_member_store must be a power of two.");
+
+		inline guild_member_store() = default;
+
+		/// @brief Adds a member, or overwrites the existing member with the same ids.
+		/// @param member the member to be stored.
+		inline void emplace(const guild_member_cache_data& member) {
+			uint64_t guildId{ member.guildId.operator const uint64_t&() };
+			auto& shard = getShard(guildId);
+			std::unique_lock lock{ shard.storeMutex };
+			auto& columns = shard.guilds[guildId];
+			if (!columns) {
+				columns = makeUnique<guild_member_columns>();
+			}
+			columns->emplace(member);
+		}
+
+		/// @brief Collects a copy of a member.
+		/// @param guildId the id of the member's guild.
+		/// @param userId the member's user id.
+		/// @return the member, if it is stored.
+		inline std::optional<guild_member_cache_data> find(snowflake guildId, snowflake userId) const {
+			auto& shard = getShard(guildId.operator const uint64_t&());
+			std::shared_lock lock{ shard.storeMutex };
+			if (auto iter = shard.guilds.find(guildId.operator const uint64_t&()); iter != shard.guilds.end()) {
+				return iter->second->find(guildId.operator const uint64_t&(), userId.operator const uint64_t&());
+			}
+			return std::nullopt;
+		}
+
+		/// @brief Checks whether a member is stored.
+		/// @param guildId the id of the member's guild.
+		/// @param userId the member's user id.
+		inline bool contains(snowflake guildId, snowflake userId) const {
+			auto& shard = getShard(guildId.operator const uint64_t&());
+			std::shared_lock lock{ shard.storeMutex };
+			if (auto iter = shard.guilds.find(guildId.operator const uint64_t&()); iter != shard.guilds.end()) {
+				return iter->second->contains(userId.operator const uint64_t&());
+			}
+			return false;
+		}
+
+		/// @brief Removes a member.
+		/// @param guildId the id of the member's guild.
+		/// @param userId the member's user id.
+		inline void erase(snowflake guildId, snowflake userId) {
+			auto& shard = getShard(guildId.operator const uint64_t&());
+			std::unique_lock lock{ shard.storeMutex };
+			if (auto iter = shard.guilds.find(guildId.operator const uint64_t&()); iter != shard.guilds.end()) {
+				iter->second->erase(userId.operator const uint64_t&());
+				if (iter->second->size() == 0) {
+					shard.guilds.erase(guildId.operator const uint64_t&());
+				}
+			}
+		}
+
+		/// @brief Removes every member of a guild.
+		/// @param guildId the id of the guild.
+		inline void eraseGuild(snowflake guildId) {
+			auto& shard = getShard(guildId.operator const uint64_t&());
+			std::unique_lock lock{ shard.storeMutex };
+			shard.guilds.erase(guildId.operator const uint64_t&());
+		}
+
+		/// @brief Visits every stored member, one shard at a time, while holding each shard's read lock.
+		/// @param function the function to be called with each member - it must not call back into this store.
+		template<typename function_type> inline void visit(function_type&& function) const {
+			for (auto& shard: shards) {
+				std::shared_lock lock{ shard.storeMutex };
+				for (auto& value: shard.guilds) {
+					value.second->visit(value.first, function);
+				}
+			}
+		}
+
+		/// @brief Collects the total number of stored members.
+		inline uint64_t count() const {
+			uint64_t returnValue{};
+			for (auto& shard: shards) {
+				std::shared_lock lock{ shard.storeMutex };
+				for (auto& value: shard.guilds) {
+					returnValue += value.second->size();
+				}
+			}
+			return returnValue;
+		}
+
+		/// @brief Collects the approximate number of bytes occupied by the stored members - divide by count() for the per-member cost.
+		inline uint64_t getMemoryUsage() const {
+			uint64_t returnValue{ sizeof(*this) };
+			for (auto& shard: shards) {
+				std::shared_lock lock{ shard.storeMutex };
+				returnValue += shard.guilds.capacity() * (sizeof(std::pair<uint64_t, unique_ptr<guild_member_columns>>) + 1);
+				for (auto& value: shard.guilds) {
+					returnValue += value.second->getMemoryUsage();
+				}
+			}
+			return returnValue;
+		}
+
+	  protected:
+		/// @brief A shard of the store, padded out to its own cache line.
+		struct alignas(64) store_shard {
+			unordered_map<uint64_t, unique_ptr<guild_member_columns>> guilds{};
+			mutable std::shared_mutex storeMutex{};
+		};
+
+		std::array<store_shard, shardCount> shards{};
+
+		inline store_shard& getShard(uint64_t guildId) const {
+			static constexpr uint64_t shardBits{ static_cast<uint64_t>(std::countr_zero(shardCount)) };
+			uint64_t hash{ key_hasher<uint64_t>::getHashKey(guildId) };
+			return const_cast<store_shard&>(shards[shardBits == 0 ? 0 : hash >> (64 - shardBits)]);
+		}
+	};
+
+	/**@}*/
+
+}
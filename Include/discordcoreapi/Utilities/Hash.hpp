@@ -81,20 +81,50 @@ namespace discord_core_api {
 		return hash;
 	}
 
+	/// @brief Mixes a single 64-bit value into a hash, for keys that already are 64-bit ids - a bijection, so distinct ids never collide, and with every output bit
+	/// depending on every input bit, so that both the high and the low bits can be used to pick shards and slots.
+	/// @param value the value to be mixed.
+	/// @return uint64_t the hash.
+	inline constexpr uint64_t mixHash(uint64_t value) {
+		value ^= value >> 33;
+		value *= 0xff51afd7ed558ccdull;
+		value ^= value >> 33;
+		value *= 0xc4ceb9fe1a85ec53ull;
+		value ^= value >> 33;
+		return value;
+	}
+
 	class two_id_key {
 	  public:
 		template<guild_member_t value_type> two_id_key(const value_type& other);
 		template<voice_state_t value_type> two_id_key(const value_type& other);
 
+		inline two_id_key(snowflake idOneNew, snowflake idTwoNew) : idOne{ idOneNew }, idTwo{ idTwoNew } {};
+
+		inline bool operator==(const two_id_key& other) const {
+			return idOne == other.idOne && idTwo == other.idTwo;
+		}
+
 		snowflake idOne{};
 		snowflake idTwo{};
 	};
 
+	/// @brief A key that carries an already-computed hash, for finding an object again by the hash it was stored under.
+	struct precomputed_hash {
+		uint64_t value{};
+	};
+
 	template<typename value_type> struct key_hasher;
 
+	template<> struct key_hasher<precomputed_hash> {
+		inline static uint64_t getHashKey(const precomputed_hash& other) {
+			return other.value;
+		}
+	};
+
 	template<has_id value_type> struct key_hasher<value_type> {
 		inline static uint64_t getHashKey(const value_type& other) {
-			return internalHashFunction(&other.id.operator const uint64_t&(), sizeof(uint64_t));
+			return mixHash(other.id.operator const uint64_t&());
 		}
 	};
 
@@ -112,16 +142,13 @@ namespace discord_core_api {
 
 	template<jsonifier::concepts::integer_t value_type> struct key_hasher<value_type> {
 		inline static uint64_t getHashKey(const value_type& other) {
-			return internalHashFunction(&other, sizeof(other));
+			return mixHash(static_cast<uint64_t>(other));
 		}
 	};
 
 	template<> struct key_hasher<two_id_key> {
 		inline static uint64_t getHashKey(const two_id_key& other) {
-			uint64_t values[2]{};
-			values[0] = other.idOne.operator const uint64_t&();
-			values[1] = other.idTwo.operator const uint64_t&();
-			return internalHashFunction(values, sizeof(uint64_t) * std::size(values));
+			return mixHash(mixHash(other.idOne.operator const uint64_t&()) ^ other.idTwo.operator const uint64_t&());
 		}
 	};
 
@@ -139,7 +166,7 @@ namespace discord_core_api {
 
 	template<> struct key_hasher<snowflake> {
 		inline static uint64_t getHashKey(const snowflake& data) {
-			return internalHashFunction(&data.operator const uint64_t&(), sizeof(uint64_t));
+			return mixHash(data.operator const uint64_t&());
 		}
 	};
 
@@ -167,6 +194,12 @@ namespace discord_core_api {
 
 	template<typename value_Type> struct key_accessor;
 
+	template<> struct key_accessor<precomputed_hash> {
+		inline static uint64_t getHashKey(const precomputed_hash& other) {
+			return other.value;
+		}
+	};
+
 	template<guild_member_t value_type> struct key_accessor<value_type> {
 		inline static uint64_t getHashKey(const value_type& other) {
 			return key_hasher<value_type>::getHashKey(other);
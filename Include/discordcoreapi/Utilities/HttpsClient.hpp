@@ -30,6 +30,9 @@
 #pragma once
 
 #include <discordcoreapi/Utilities/RateLimitQueue.hpp>
+#include <discordcoreapi/Utilities/ZlibDecoder.hpp>
+#include <discordcoreapi/Utilities/Metrics.hpp>
+#include <deque>
 
 namespace discord_core_api {
 
@@ -52,6 +55,7 @@ namespace discord_core_api {
 				Method_Not_Allowed	= 405,///< The https method used is not valid for the location specified.
 				Too_Many_Requests	= 429,///< You are being rate limited, see rate limits.
 				Gateway_Unavailable = 502,///< There was not a gateway available to process your request. wait a bit and retry.
+				Decoding_Error		= 1000,///< The response body couldn't be decoded, or ended before its compressed stream did - set by the library, not sent by the server.
 			};
 
 			inline static unordered_map<https_response_codes, jsonifier::string> outputErrorValues{
@@ -65,7 +69,8 @@ namespace discord_core_api {
 				{ static_cast<https_response_codes>(405), "the https method used is not valid for the location specified" },
 				{ static_cast<https_response_codes>(429), "you are being rate limited, see rate limits" },
 				{ static_cast<https_response_codes>(502), "there was not a gateway available to process your request.wait a bit and retry" },
-				{ static_cast<https_response_codes>(500), "the server had an error processing your request(these are rare)" }
+				{ static_cast<https_response_codes>(500), "the server had an error processing your request(these are rare)" },
+				{ static_cast<https_response_codes>(1000), "the response body couldn't be decoded, or ended before its compressed stream did" }
 			};
 
 			https_response_codes value{};
@@ -96,10 +101,45 @@ namespace discord_core_api {
 
 		enum class https_state { Collecting_Headers = 0, Collecting_Contents = 1, Collecting_Chunked_Contents = 2, complete = 3 };
 
+		enum class https_chunk_state { Collecting_Size = 0, Collecting_Data = 1, Collecting_Data_End = 2, Collecting_Trailers = 3 };
+
+		/// @brief The header that tells a rest proxy which workload type - and so which rate-limit bucket - a relayed request belongs to.
+		constexpr jsonifier::string_view workloadTypeHeader{ "X-Workload-Type" };
+
 		class https_error : public dca_exception {
 		  public:
 			https_response_code errorCode{};
 			inline https_error(jsonifier::string_view message, std::source_location location = std::source_location::current()) : dca_exception{ message, location } {};
+
+			/// @brief Attaches the request and response bodies, which are only formatted into the message once what() is actually called.
+			/// @param requestContentNew the content of the failed request.
+			/// @param responseContentNew the body of the error response.
+			inline void setBodies(jsonifier::string&& requestContentNew, jsonifier::string&& responseContentNew) {
+				requestContent	= std::move(requestContentNew);
+				responseContent = std::move(responseContentNew);
+			}
+
+			inline const char* what() const noexcept override {
+				if (fullMessage.empty() && (!requestContent.empty() || !responseContent.empty())) {
+					try {
+						fullMessage = dca_exception::what();
+						if (!requestContent.empty()) {
+							fullMessage += "Content: " + std::string{ requestContent.data(), requestContent.size() } + "\n";
+						}
+						if (!responseContent.empty()) {
+							fullMessage += "The Response: " + std::string{ responseContent.data(), responseContent.size() };
+						}
+					} catch (...) {
+						fullMessage.clear();
+					}
+				}
+				return fullMessage.empty() ? dca_exception::what() : fullMessage.c_str();
+			}
+
+		  protected:
+			jsonifier::string responseContent{};
+			jsonifier::string requestContent{};
+			mutable std::string fullMessage{};
 		};
 
 		struct DiscordCoreAPI_Dll https_response_data {
@@ -110,10 +150,20 @@ namespace discord_core_api {
 			https_response_code responseCode{ std::numeric_limits<uint32_t>::max() };
 			unordered_map<jsonifier::string, jsonifier::string> responseHeaders{};
 			https_state currentState{ https_state::Collecting_Headers };
+			content_encoding contentEncoding{ content_encoding::identity };///< The content coding of the response body.
 			jsonifier::string responseData{};
+			nanoseconds decodeTime{};///< Time spent decoding the response body, if it was encoded.
 			uint64_t contentLength{};
+			uint64_t bytesOnWire{};///< The number of body bytes received, before decoding.
 
 		  protected:
+			https_chunk_state chunkState{ https_chunk_state::Collecting_Size };
+			uint64_t chunkBytesRemaining{};///< Bytes left in the chunk currently being collected.
+			uint64_t headerScanOffset{};///< Where to resume searching for the end of the headers.
+			uint64_t parseOffset{};///< Bytes of the connection's input buffer that have already been consumed.
+			uint64_t bodyOffset{};///< Where the body starts in the connection's input buffer, if it was left there.
+			bool isBodyInBuffer{};///< Was the body left in the connection's input buffer, to be handed over without a copy?
+			bool didDecodingFail{};///< Did the decoder reject part of the body? the rest of it is still read, so that the connection stays usable, but not decoded.
 			bool isItChunked{};
 		};
 
@@ -134,6 +184,12 @@ namespace discord_core_api {
 			virtual ~https_rnr_builder() = default;
 
 		  protected:
+			void appendBody(jsonifier::string_view bodyData);
+
+			void completeBody();
+
+			bool completeUnframedBody();
+
 			bool parseContents();
 
 			bool parseChunk();
@@ -149,16 +205,21 @@ namespace discord_core_api {
 			jsonifier::string currentBaseUrl{};
 			int32_t currentReconnectTries{};
 			https_workload_data workload{};
+			zlib_decoder_wrapper decoder{};
 			https_response_data data{};
 
 			https_connection() = default;
 
-			https_connection(const jsonifier::string& baseUrlNew, const uint16_t portNew);
+			https_connection(const jsonifier::string& baseUrlNew, const uint16_t portNew, bool isItTlsNew = true);
 
 			void resetValues(https_workload_data&& workloadNew, rate_limit_data* newRateLimitData);
 
 			void handleBuffer() override;
 
+			/// @brief Hands a response body's buffer back to the connection once it has been parsed, so that its capacity gets re-used for the next response.
+			/// @param buffer the buffer to be recycled.
+			void releaseBuffer(jsonifier::string&& buffer);
+
 			bool areWeConnected();
 
 			void disconnect();
@@ -209,29 +270,24 @@ namespace discord_core_api {
 				connection.resetValues(std::move(workloadNew), &rateLimitData);
 				auto returnData = httpsRequestInternal(connection);
 				if (returnData.responseCode != 200 && returnData.responseCode != 204 && returnData.responseCode != 201) {
-					jsonifier::string errorMessage{};
-					if (connection.workload.callStack != "") {
-						errorMessage += connection.workload.callStack + " ";
-					}
-					errorMessage += "Https error: " + returnData.responseCode.operator jsonifier::string() + "\nThe request: base url: " + connection.workload.baseUrl + "\n";
-					if (!connection.workload.relativePath.empty()) {
-						errorMessage += "Relative Url: " + connection.workload.relativePath + "\n";
-					}
-					if (!connection.workload.content.empty()) {
-						errorMessage += "Content: " + connection.workload.content + "\n";
-					}
-					if (!returnData.responseData.empty()) {
-						errorMessage += "The Response: " + static_cast<jsonifier::string>(returnData.responseData);
-					}
-					https_error theError{ errorMessage };
-					theError.errorCode = returnData.responseCode;
-					throw theError;
+					throw makeHttpsError(connection.workload, std::move(returnData));
 				}
 				return returnData;
 			}
 
 		  protected:
+			jsonifier::string proxyAddress{};///< The address of the rest proxy that requests are relayed through, if any.
 			jsonifier::string botToken{};
+			uint16_t proxyPort{};
+
+			/// @brief Whether or not a workload goes through the rest proxy - only discord's api does, as that is all that the proxy relays.
+			/// @param workload the workload to check.
+			bool isItProxied(const https_workload_data& workload) const;
+
+			/// @brief (Re)connects a connection, either to its workload's host or to the rest proxy.
+			void connectToHost(https_connection& connection);
+
+			https_error makeHttpsError(https_workload_data& workload, https_response_data&& returnData);
 
 			https_response_data httpsRequestInternal(https_connection& connection);
 
@@ -240,6 +296,188 @@ namespace discord_core_api {
 			https_response_data getResponse(https_connection& connection);
 		};
 
+		/// @brief A size-bounded, time-limited cache of the responses of read endpoints, keyed by route. only endpoints that are precisely invalidated - by their
+		/// matching gateway dispatches, or by our own writes to the same routes - are cached.
+		class https_response_cache {
+		  public:
+			/// @brief Enables (or disables) the cache.
+			/// @param options the https options of the current client.
+			inline static void initialize(const https_options& options) {
+				std::unique_lock lock{ accessMutex };
+				maxBytes = options.responseCacheMaxBytes;
+				ttl		 = options.responseCacheTtl;
+				isEnabled.store(options.cacheResponses, std::memory_order_release);
+			}
+
+			/// @brief Whether or not responses for the given workload type are cached.
+			inline static bool isItCacheable(https_workload_type workloadType) {
+				if (!isEnabled.load(std::memory_order_acquire)) {
+					return false;
+				}
+				switch (workloadType) {
+					case https_workload_type::Get_Global_Application_Commands:
+					case https_workload_type::Get_Guild_Application_Commands:
+					case https_workload_type::Get_Channel:
+					case https_workload_type::Get_Guild:
+					case https_workload_type::Get_Guild_Channels:
+					case https_workload_type::Get_Guild_Roles: {
+						return true;
+					}
+					default: {
+						return false;
+					}
+				}
+			}
+
+			/// @brief Collects a fresh cached response for a route.
+			/// @param route the relative path of the request, including its query.
+			/// @param responseData the string to store the response into.
+			/// @return true if a fresh response was found.
+			inline static bool get(jsonifier::string_view route, jsonifier::string& responseData) {
+				std::unique_lock lock{ accessMutex };
+				if (auto result = entries.find(static_cast<jsonifier::string>(route)); result != entries.end()) {
+					if (result->second.expiry > hrclock::now()) {
+						responseData = result->second.responseData;
+						metrics::https.responseCacheHits.add();
+						return true;
+					}
+					currentBytes -= result->second.responseData.size();
+					entries.erase(result);
+				}
+				metrics::https.responseCacheMisses.add();
+				return false;
+			}
+
+			/// @brief Registers a request for a route as it is submitted - every invalidation of the route from then on bumps its generation, so that a response
+			/// which was already on its way can't be stored over the invalidation. each call must be matched by one to store() or to endRequest().
+			/// @param route the relative path of the request, including its query.
+			/// @return uint64_t the route's current generation, to be handed back to store().
+			inline static uint64_t beginRequest(jsonifier::string_view route) {
+				std::unique_lock lock{ accessMutex };
+				auto& pendingRoute = pendingRoutes[static_cast<jsonifier::string>(route.substr(0, route.find('?')))];
+				++pendingRoute.requestCount;
+				return pendingRoute.generation;
+			}
+
+			/// @brief Releases a request that was registered by beginRequest(), without storing its response.
+			/// @param route the relative path of the request, including its query.
+			inline static void endRequest(jsonifier::string_view route) {
+				std::unique_lock lock{ accessMutex };
+				releaseRequest(route);
+			}
+
+			/// @brief Stores a response for a route, unless the route was invalidated after its request was submitted - evicting the oldest entries if the cache
+			/// is full - and releases the request.
+			/// @param route the relative path of the request, including its query.
+			/// @param responseData the body of the response.
+			/// @param generation the route's generation, as returned by beginRequest() when the request was submitted.
+			inline static void store(jsonifier::string_view route, jsonifier::string_view responseData, uint64_t generation) {
+				std::unique_lock lock{ accessMutex };
+				if (releaseRequest(route) != generation || responseData.size() > maxBytes) {
+					return;
+				}
+				jsonifier::string key{ static_cast<jsonifier::string>(route) };
+				if (auto result = entries.find(key); result != entries.end()) {
+					currentBytes -= result->second.responseData.size();
+					entries.erase(result);
+				}
+				while (insertionOrder.size() > 0 && (currentBytes + responseData.size() > maxBytes || insertionOrder.size() > entries.size() * 2 + 16)) {
+					// the queue can hold keys that were since replaced or invalidated - only evict an entry if it is still the one that was queued.
+					if (auto result = entries.find(insertionOrder.front().first); result != entries.end() && result->second.expiry == insertionOrder.front().second) {
+						currentBytes -= result->second.responseData.size();
+						entries.erase(result);
+					}
+					insertionOrder.pop_front();
+				}
+				auto expiry = hrclock::now() + ttl;
+				currentBytes += responseData.size();
+				entries[key] = cache_entry{ expiry, static_cast<jsonifier::string>(responseData) };
+				insertionOrder.emplace_back(std::move(key), expiry);
+			}
+
+			/// @brief Drops every cached response for a route, regardless of its query.
+			/// @param route the relative path, without a query.
+			inline static void invalidate(jsonifier::string_view route) {
+				invalidateIf([&](jsonifier::string_view path) {
+					return path == route;
+				});
+			}
+
+			/// @brief Drops every cached response that a write to the given route could have changed - the route itself, the collections above it, and
+			/// everything beneath it.
+			/// @param route the relative path of the write, with or without a query.
+			inline static void invalidateRelated(jsonifier::string_view route) {
+				route = route.substr(0, route.find('?'));
+				invalidateIf([&](jsonifier::string_view path) {
+					return isItAPathPrefix(route, path) || isItAPathPrefix(path, route);
+				});
+			}
+
+		  protected:
+			struct cache_entry {
+				hrclock::time_point expiry{};
+				jsonifier::string responseData{};
+			};
+
+			/// @brief A route that has requests in flight.
+			struct pending_route {
+				uint64_t requestCount{};///< The requests for the route that haven't been released yet.
+				uint64_t generation{};///< How many times the route has been invalidated while it had requests in flight.
+			};
+
+			inline static unordered_map<jsonifier::string, pending_route> pendingRoutes{};
+			inline static unordered_map<jsonifier::string, cache_entry> entries{};
+			inline static std::deque<std::pair<jsonifier::string, hrclock::time_point>> insertionOrder{};
+			inline static std::atomic_bool isEnabled{};
+			inline static std::mutex accessMutex{};
+			inline static uint64_t currentBytes{};
+			inline static milliseconds ttl{};
+			inline static uint64_t maxBytes{};
+
+			/// @brief Whether or not one path is a whole-segment prefix of another - "/guilds/1" is not a prefix of "/guilds/12".
+			inline static bool isItAPathPrefix(jsonifier::string_view prefix, jsonifier::string_view path) {
+				return path.size() >= prefix.size() && path.substr(0, prefix.size()) == prefix && (path.size() == prefix.size() || path[prefix.size()] == '/');
+			}
+
+			/// @brief Releases a request for a route, under the lock.
+			/// @return uint64_t the route's generation.
+			inline static uint64_t releaseRequest(jsonifier::string_view route) {
+				auto result = pendingRoutes.find(static_cast<jsonifier::string>(route.substr(0, route.find('?'))));
+				if (result == pendingRoutes.end()) {
+					return std::numeric_limits<uint64_t>::max();
+				}
+				uint64_t generation{ result->second.generation };
+				if (--result->second.requestCount == 0) {
+					pendingRoutes.erase(result);
+				}
+				return generation;
+			}
+
+			template<typename function_type> inline static void invalidateIf(function_type&& function) {
+				if (!isEnabled.load(std::memory_order_acquire)) {
+					return;
+				}
+				std::unique_lock lock{ accessMutex };
+				for (auto& [key, value]: pendingRoutes) {
+					if (function(jsonifier::string_view{ key })) {
+						++value.generation;
+					}
+				}
+				jsonifier::vector<jsonifier::string> keysToErase{};
+				for (auto& [key, value]: entries) {
+					jsonifier::string_view path{ key };
+					if (function(path.substr(0, path.find('?')))) {
+						keysToErase.emplace_back(key);
+					}
+				}
+				for (auto& value: keysToErase) {
+					currentBytes -= entries[value].responseData.size();
+					entries.erase(value);
+				}
+				metrics::https.responseCacheInvalidations.add(keysToErase.size());
+			}
+		};
+
 		/**
 		 * \addtogroup discord_core_internal
 		 * @{
@@ -249,41 +487,44 @@ namespace discord_core_api {
 		/// @brief For sending Https requests.
 		class DiscordCoreAPI_Dll https_client : public https_client_core {
 		  public:
-			https_client(jsonifier::string_view botTokenNew);
+			https_client(jsonifier::string_view botTokenNew, const https_options& options = https_options{});
 
 			template<typename value_type, typename string_type> void getParseErrors(jsonifier::jsonifier_core& parser, value_type& value, string_type& stringNew) {
 				parser.parseJson(value, stringNew);
 				if (auto result = parser.getErrors(); result.size() > 0) {
 					for (auto& valueNew: result) {
-						message_printer::printError<print_message_type::websocket>(valueNew.reportError());
+						message_printer::printError<print_message_type::websocket>([&] {
+							return valueNew.reportError();
+						});
 					}
 				}
 			}
 
 			template<typename workload_type, typename... args> void submitWorkloadAndGetResult(workload_type&& workload, args&... argsNew) {
+				if (workload.workloadClass == https_workload_class::Get && https_response_cache::isItCacheable(workload.getWorkloadType())) {
+					if (jsonifier::string cachedResponse{}; https_response_cache::get(workload.relativePath, cachedResponse)) {
+						if constexpr ((( !std::is_void_v<args> ) || ...)) {
+							if (cachedResponse.size() > 0) {
+								(getParseErrors(parser, argsNew, cachedResponse), ...);
+							}
+						}
+						return;
+					}
+				}
+				if (workload.workloadClass == https_workload_class::Get && coalescedWorkloads[static_cast<uint64_t>(workload.getWorkloadType())]) {
+					https_response_data returnData = submitCoalescedWorkload(std::move(workload));
+					if constexpr ((( !std::is_void_v<args> ) || ...)) {
+						if (returnData.responseData.size() > 0) {
+							(getParseErrors(parser, argsNew, returnData.responseData), ...);
+						}
+					}
+					return;
+				}
 				https_connection_stack_holder stackHolder{ connectionManager, std::move(workload) };
 				https_response_data returnData = httpsRequest(stackHolder.getConnection());
 				if (static_cast<uint32_t>(returnData.responseCode) != 200 && static_cast<uint32_t>(returnData.responseCode) != 204 &&
 					static_cast<uint32_t>(returnData.responseCode) != 201) {
-					jsonifier::string errorMessage{};
-					if (stackHolder.getConnection().workload.callStack != "") {
-						errorMessage += stackHolder.getConnection().workload.callStack + " ";
-					}
-					errorMessage +=
-						"Https error: " + returnData.responseCode.operator jsonifier::string() + "\nThe request: base url: " + stackHolder.getConnection().workload.baseUrl + "\n";
-					if (!stackHolder.getConnection().workload.relativePath.empty()) {
-						errorMessage += "Relative Url: " + stackHolder.getConnection().workload.relativePath + "\n";
-					}
-					if (!stackHolder.getConnection().workload.content.empty()) {
-						errorMessage += "Content: " + stackHolder.getConnection().workload.content + "\n";
-					}
-					if (!returnData.responseData.empty()) {
-						errorMessage += "The Response: " + static_cast<jsonifier::string>(returnData.responseData);
-					}
-					https_error theError{ errorMessage };
-					theError.errorCode = returnData.responseCode;
-
-					throw theError;
+					throw makeHttpsError(stackHolder.getConnection().workload, std::move(returnData));
 				}
 
 				if constexpr ((( !std::is_void_v<args> ) || ...)) {
@@ -291,11 +532,30 @@ namespace discord_core_api {
 						(getParseErrors(parser, argsNew, returnData.responseData), ...);
 					}
 				}
+				stackHolder.getConnection().releaseBuffer(std::move(returnData.responseData));
 			}
 
+			/// @brief Submits a workload through the rate-limited connections, and returns the response whatever its status - for relaying requests on behalf of
+			/// other processes.
+			/// @param workload the workload to be submitted.
+			/// @return https_response_data the response.
+			https_response_data forwardWorkload(https_workload_data&& workload);
+
 		  protected:
+			/// @brief An upstream get request, along with the callers that are waiting on its result.
+			struct in_flight_request {
+				std::shared_future<https_response_data> result{};
+				uint64_t waiterCount{};
+			};
+
+			std::array<bool, static_cast<uint64_t>(https_workload_type::Last)> coalescedWorkloads{};///< Which get endpoints may be coalesced.
+			unordered_map<jsonifier::string, in_flight_request> inFlightRequests{};
 			https_connection_manager connectionManager{};
 			rate_limit_queue rateLimitQueue{};
+			std::mutex inFlightMutex{};
+
+			/// @brief Submits a get request, unless an identical one is already in flight - in which case its result is shared instead.
+			https_response_data submitCoalescedWorkload(https_workload_data&& workload);
 
 			https_response_data executeByRateLimitData(https_connection& connection);
 
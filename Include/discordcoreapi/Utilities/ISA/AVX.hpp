@@ -33,6 +33,7 @@
 
 	#include <immintrin.h>
 	#include <numeric>
+	#include <bit>
 
 namespace discord_core_api {
 
@@ -95,6 +96,72 @@ namespace discord_core_api {
 			}
 		};
 
+		// @brief A class for OR-reducing role values over member role bitmaps using AVX instructions.
+		class role_bitmap_reducer {
+		  public:
+			// @brief The number of 64-bit bitmap words per cpu register.
+			static constexpr uint64_t membersPerRegister{ 2 };
+
+			// @brief ORs, into each member's accumulator, the values of the roles that are set in that member's bitmap word. this version uses AVX instructions.
+			// @param bitmapWords pointer to membersPerRegister members' bitmap words, all covering the same 64 roles.
+			// @param roleValues pointer to the values of those 64 roles.
+			// @param accumulators pointer to membersPerRegister accumulators.
+			inline static void reduceRegister(const uint64_t* bitmapWords, const uint64_t* roleValues, uint64_t* accumulators) {
+				uint64_t presentRoles{ bitmapWords[0] | bitmapWords[1] };
+				if (presentRoles == 0) {
+					return;
+				}
+				__m128i words{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(bitmapWords)) };
+				__m128i accumulator{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(accumulators)) };
+				while (presentRoles != 0) {
+					uint64_t roleIndex{ static_cast<uint64_t>(std::countr_zero(presentRoles)) };
+					__m128i roleBit{ _mm_set1_epi64x(static_cast<int64_t>(1ull << roleIndex)) };
+					__m128i memberMask{ _mm_cmpeq_epi64(_mm_and_si128(words, roleBit), roleBit) };
+					accumulator = _mm_or_si128(accumulator, _mm_and_si128(memberMask, _mm_set1_epi64x(static_cast<int64_t>(roleValues[roleIndex]))));
+					presentRoles &= presentRoles - 1;
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(accumulators), accumulator);
+			}
+		};
+
+		// @brief A group of hash table control bytes, probed all at once using SSE2 instructions.
+		class control_group {
+		  public:
+			// @brief The number of control bytes per group.
+			static constexpr uint64_t width{ 16 };
+
+			// @param controlBytes pointer to the first of the group's control bytes.
+			inline explicit control_group(const int8_t* controlBytes) : group{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(controlBytes)) } {};
+
+			// @brief Collects a mask of the slots whose control byte equals value. this version uses SSE2 instructions.
+			inline uint64_t match(int8_t value) const {
+				return static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(value), group)));
+			}
+
+			// @brief Collects a mask of the empty slots. this version uses SSE2 instructions.
+			inline uint64_t matchEmpty() const {
+				return match(-128);
+			}
+
+			// @brief Collects a mask of the empty or deleted slots - those whose control byte is below -1. this version uses SSE2 instructions.
+			inline uint64_t matchEmptyOrDeleted() const {
+				return static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), group)));
+			}
+
+			// @brief Collects a mask of the occupied slots - those whose control byte has its high bit clear. this version uses SSE2 instructions.
+			inline uint64_t matchFull() const {
+				return static_cast<uint16_t>(~_mm_movemask_epi8(group));
+			}
+
+			// @brief Collects the index, within the group, of the lowest slot set in a mask.
+			inline static uint64_t lowestIndex(uint64_t mask) {
+				return static_cast<uint64_t>(std::countr_zero(mask));
+			}
+
+		  protected:
+			__m128i group{};
+		};
+
 	}
 }
 
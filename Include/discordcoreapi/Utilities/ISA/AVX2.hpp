@@ -33,6 +33,7 @@
 
 	#include <immintrin.h>
 	#include <numeric>
+	#include <bit>
 
 namespace discord_core_api {
 
@@ -94,6 +95,72 @@ namespace discord_core_api {
 				return _mm256_load_ps(newArray);
 			}
 		};
+
+		// @brief A class for OR-reducing role values over member role bitmaps using AVX2 instructions.
+		class role_bitmap_reducer {
+		  public:
+			// @brief The number of 64-bit bitmap words per cpu register.
+			static constexpr uint64_t membersPerRegister{ 4 };
+
+			// @brief ORs, into each member's accumulator, the values of the roles that are set in that member's bitmap word. this version uses AVX2 instructions.
+			// @param bitmapWords pointer to membersPerRegister members' bitmap words, all covering the same 64 roles.
+			// @param roleValues pointer to the values of those 64 roles.
+			// @param accumulators pointer to membersPerRegister accumulators.
+			inline static void reduceRegister(const uint64_t* bitmapWords, const uint64_t* roleValues, uint64_t* accumulators) {
+				uint64_t presentRoles{ bitmapWords[0] | bitmapWords[1] | bitmapWords[2] | bitmapWords[3] };
+				if (presentRoles == 0) {
+					return;
+				}
+				__m256i words{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bitmapWords)) };
+				__m256i accumulator{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(accumulators)) };
+				while (presentRoles != 0) {
+					uint64_t roleIndex{ static_cast<uint64_t>(std::countr_zero(presentRoles)) };
+					__m256i roleBit{ _mm256_set1_epi64x(static_cast<int64_t>(1ull << roleIndex)) };
+					__m256i memberMask{ _mm256_cmpeq_epi64(_mm256_and_si256(words, roleBit), roleBit) };
+					accumulator = _mm256_or_si256(accumulator, _mm256_and_si256(memberMask, _mm256_set1_epi64x(static_cast<int64_t>(roleValues[roleIndex]))));
+					presentRoles &= presentRoles - 1;
+				}
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(accumulators), accumulator);
+			}
+		};
+
+		// @brief A group of hash table control bytes, probed all at once using AVX2 instructions.
+		class control_group {
+		  public:
+			// @brief The number of control bytes per group.
+			static constexpr uint64_t width{ 32 };
+
+			// @param controlBytes pointer to the first of the group's control bytes.
+			inline explicit control_group(const int8_t* controlBytes) : group{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(controlBytes)) } {};
+
+			// @brief Collects a mask of the slots whose control byte equals value. this version uses AVX2 instructions.
+			inline uint64_t match(int8_t value) const {
+				return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_set1_epi8(value), group)));
+			}
+
+			// @brief Collects a mask of the empty slots. this version uses AVX2 instructions.
+			inline uint64_t matchEmpty() const {
+				return match(-128);
+			}
+
+			// @brief Collects a mask of the empty or deleted slots - those whose control byte is below -1. this version uses AVX2 instructions.
+			inline uint64_t matchEmptyOrDeleted() const {
+				return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_set1_epi8(-1), group)));
+			}
+
+			// @brief Collects a mask of the occupied slots - those whose control byte has its high bit clear. this version uses AVX2 instructions.
+			inline uint64_t matchFull() const {
+				return static_cast<uint32_t>(~_mm256_movemask_epi8(group));
+			}
+
+			// @brief Collects the index, within the group, of the lowest slot set in a mask.
+			inline static uint64_t lowestIndex(uint64_t mask) {
+				return static_cast<uint64_t>(std::countr_zero(mask));
+			}
+
+		  protected:
+			__m256i group{};
+		};
 	}
 }
 
@@ -34,6 +34,7 @@
 
 	#include <immintrin.h>
 	#include <numeric>
+	#include <bit>
 
 namespace discord_core_api {
 
@@ -98,6 +99,71 @@ namespace discord_core_api {
 			}
 		};
 
+		// @brief A class for OR-reducing role values over member role bitmaps using AVX512 instructions.
+		class role_bitmap_reducer {
+		  public:
+			// @brief The number of 64-bit bitmap words per cpu register.
+			static constexpr uint64_t membersPerRegister{ 8 };
+
+			// @brief ORs, into each member's accumulator, the values of the roles that are set in that member's bitmap word. this version uses AVX512 instructions.
+			// @param bitmapWords pointer to membersPerRegister members' bitmap words, all covering the same 64 roles.
+			// @param roleValues pointer to the values of those 64 roles.
+			// @param accumulators pointer to membersPerRegister accumulators.
+			inline static void reduceRegister(const uint64_t* bitmapWords, const uint64_t* roleValues, uint64_t* accumulators) {
+				__m512i words{ _mm512_loadu_si512(bitmapWords) };
+				uint64_t presentRoles{ static_cast<uint64_t>(_mm512_reduce_or_epi64(words)) };
+				if (presentRoles == 0) {
+					return;
+				}
+				__m512i accumulator{ _mm512_loadu_si512(accumulators) };
+				while (presentRoles != 0) {
+					uint64_t roleIndex{ static_cast<uint64_t>(std::countr_zero(presentRoles)) };
+					__mmask8 memberMask{ _mm512_test_epi64_mask(words, _mm512_set1_epi64(static_cast<int64_t>(1ull << roleIndex))) };
+					accumulator = _mm512_mask_or_epi64(accumulator, memberMask, accumulator, _mm512_set1_epi64(static_cast<int64_t>(roleValues[roleIndex])));
+					presentRoles &= presentRoles - 1;
+				}
+				_mm512_storeu_si512(accumulators, accumulator);
+			}
+		};
+
+		// @brief A group of hash table control bytes, probed all at once using AVX2 instructions.
+		class control_group {
+		  public:
+			// @brief The number of control bytes per group.
+			static constexpr uint64_t width{ 32 };
+
+			// @param controlBytes pointer to the first of the group's control bytes.
+			inline explicit control_group(const int8_t* controlBytes) : group{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(controlBytes)) } {};
+
+			// @brief Collects a mask of the slots whose control byte equals value. this version uses AVX2 instructions.
+			inline uint64_t match(int8_t value) const {
+				return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_set1_epi8(value), group)));
+			}
+
+			// @brief Collects a mask of the empty slots. this version uses AVX2 instructions.
+			inline uint64_t matchEmpty() const {
+				return match(-128);
+			}
+
+			// @brief Collects a mask of the empty or deleted slots - those whose control byte is below -1. this version uses AVX2 instructions.
+			inline uint64_t matchEmptyOrDeleted() const {
+				return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_set1_epi8(-1), group)));
+			}
+
+			// @brief Collects a mask of the occupied slots - those whose control byte has its high bit clear. this version uses AVX2 instructions.
+			inline uint64_t matchFull() const {
+				return static_cast<uint32_t>(~_mm256_movemask_epi8(group));
+			}
+
+			// @brief Collects the index, within the group, of the lowest slot set in a mask.
+			inline static uint64_t lowestIndex(uint64_t mask) {
+				return static_cast<uint64_t>(std::countr_zero(mask));
+			}
+
+		  protected:
+			__m256i group{};
+		};
+
 	};
 }
 
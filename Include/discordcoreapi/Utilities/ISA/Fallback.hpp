@@ -32,7 +32,9 @@
 #if (!JSONIFIER_CHECK_FOR_INSTRUCTION(JSONIFIER_AVX)) && (!JSONIFIER_CHECK_FOR_INSTRUCTION(JSONIFIER_AVX2)) && (!JSONIFIER_CHECK_FOR_INSTRUCTION(JSONIFIER_AVX512))
 
 	#include <cstdint>
+	#include <cstring>
 	#include <numeric>
+	#include <bit>
 
 namespace discord_core_api {
 
@@ -72,6 +74,71 @@ namespace discord_core_api {
 				}
 			}
 		};
+
+		// @brief A class for OR-reducing role values over member role bitmaps using x64 instructions.
+		class role_bitmap_reducer {
+		  public:
+			// @brief The number of 64-bit bitmap words per cpu register.
+			static constexpr uint64_t membersPerRegister{ 1 };
+
+			// @brief ORs, into each member's accumulator, the values of the roles that are set in that member's bitmap word. this version uses x64 instructions.
+			// @param bitmapWords pointer to membersPerRegister members' bitmap words, all covering the same 64 roles.
+			// @param roleValues pointer to the values of those 64 roles.
+			// @param accumulators pointer to membersPerRegister accumulators.
+			inline static void reduceRegister(const uint64_t* bitmapWords, const uint64_t* roleValues, uint64_t* accumulators) {
+				for (uint64_t x = 0; x < membersPerRegister; ++x) {
+					uint64_t presentRoles{ bitmapWords[x] };
+					while (presentRoles != 0) {
+						accumulators[x] |= roleValues[std::countr_zero(presentRoles)];
+						presentRoles &= presentRoles - 1;
+					}
+				}
+			}
+		};
+
+		// @brief A group of hash table control bytes, probed all at once by treating them as a single 64-bit word.
+		class control_group {
+		  public:
+			// @brief The number of control bytes per group.
+			static constexpr uint64_t width{ 8 };
+
+			// @param controlBytes pointer to the first of the group's control bytes.
+			inline explicit control_group(const int8_t* controlBytes) {
+				std::memcpy(&group, controlBytes, sizeof(group));
+			};
+
+			// @brief Collects a mask of the slots whose control byte equals value - which may include false positives directly above a true match, so the keys
+			// must be compared anyway. this version uses x64 instructions.
+			inline uint64_t match(int8_t value) const {
+				uint64_t matches{ group ^ (lsbs * static_cast<uint8_t>(value)) };
+				return (matches - lsbs) & ~matches & msbs;
+			}
+
+			// @brief Collects a mask of the empty slots. this version uses x64 instructions.
+			inline uint64_t matchEmpty() const {
+				return (group & ~(group << 6)) & msbs;
+			}
+
+			// @brief Collects a mask of the empty or deleted slots. this version uses x64 instructions.
+			inline uint64_t matchEmptyOrDeleted() const {
+				return (group & ~(group << 7)) & msbs;
+			}
+
+			// @brief Collects a mask of the occupied slots - those whose control byte has its high bit clear. this version uses x64 instructions.
+			inline uint64_t matchFull() const {
+				return ~group & msbs;
+			}
+
+			// @brief Collects the index, within the group, of the lowest slot set in a mask.
+			inline static uint64_t lowestIndex(uint64_t mask) {
+				return static_cast<uint64_t>(std::countr_zero(mask)) >> 3;
+			}
+
+		  protected:
+			static constexpr uint64_t lsbs{ 0x0101010101010101ull };
+			static constexpr uint64_t msbs{ 0x8080808080808080ull };
+			uint64_t group{};
+		};
 	}
 }
 
@@ -0,0 +1,184 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// MappedFile.hpp - Header for the read-only memory-mapped file class.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file MappedFile.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/Base.hpp>
+
+#if !defined(_WIN32)
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+	#include <fcntl.h>
+#endif
+
+namespace discord_core_api {
+
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// @brief A read-only view of a file's contents, mapped into memory for as long as the instance lives.
+	class mapped_file {
+	  public:
+		inline mapped_file() = default;
+
+		inline mapped_file& operator=(mapped_file&& other) noexcept {
+			if (this != &other) {
+				unmap();
+				std::swap(length, other.length);
+				std::swap(ptr, other.ptr);
+#if defined(_WIN32)
+				std::swap(mappingHandle, other.mappingHandle);
+				std::swap(fileHandle, other.fileHandle);
+#else
+				std::swap(fileDescriptor, other.fileDescriptor);
+#endif
+			}
+			return *this;
+		}
+
+		inline mapped_file(mapped_file&& other) noexcept {
+			*this = std::move(other);
+		}
+
+		inline mapped_file& operator=(const mapped_file&) = delete;
+		inline mapped_file(const mapped_file&)			  = delete;
+
+		/// @brief Maps the file at the given path.
+		/// @param filePath the path of the file to be mapped.
+		inline mapped_file(jsonifier::string_view filePath) {
+			jsonifier::string filePathNew{ static_cast<jsonifier::string>(filePath) };
+#if defined(_WIN32)
+			fileHandle = CreateFileA(filePathNew.data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+			LARGE_INTEGER fileSize{};
+			if (fileHandle == INVALID_HANDLE_VALUE || !GetFileSizeEx(fileHandle, &fileSize)) {
+				unmap();
+				throw dca_exception{ "mapped_file::mapped_file() error: failed to open " + filePathNew + "." };
+			}
+			length = static_cast<uint64_t>(fileSize.QuadPart);
+			if (length == 0) {
+				return;
+			}
+			mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (mappingHandle) {
+				ptr = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+			}
+#else
+			fileDescriptor = open(filePathNew.data(), O_RDONLY | O_CLOEXEC);
+			struct stat fileStatus {};
+			if (fileDescriptor == -1 || fstat(fileDescriptor, &fileStatus) == -1) {
+				unmap();
+				throw dca_exception{ "mapped_file::mapped_file() error: failed to open " + filePathNew + "." };
+			}
+			length = static_cast<uint64_t>(fileStatus.st_size);
+			if (length == 0) {
+				return;
+			}
+			// the descriptor stays open alongside the mapping, so that kernel tls connections can sendfile() straight from it.
+			auto newPtr = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+			if (newPtr != MAP_FAILED) {
+				// the pages are consumed once, front to back, as they're written to the socket.
+				madvise(newPtr, length, MADV_SEQUENTIAL);
+				ptr = static_cast<const char*>(newPtr);
+			}
+#endif
+			if (!ptr) {
+				unmap();
+				throw dca_exception{ "mapped_file::mapped_file() error: failed to map " + filePathNew + "." };
+			}
+		}
+
+		/// @brief Collects a view of the file's contents.
+		/// @return jsonifier::string_view the mapped bytes.
+		inline jsonifier::string_view view() const {
+			return ptr ? jsonifier::string_view{ ptr, length } : jsonifier::string_view{};
+		}
+
+		/// @brief Collects the descriptor of the mapped file.
+		/// @return int32_t the descriptor, or -1 if there isn't one (always, on windows).
+		inline int32_t getFileDescriptor() const {
+#if defined(_WIN32)
+			return -1;
+#else
+			return fileDescriptor;
+#endif
+		}
+
+		/// @brief Collects the size of the file.
+		/// @return uint64_t the size, in bytes.
+		inline uint64_t size() const {
+			return length;
+		}
+
+		inline ~mapped_file() {
+			unmap();
+		}
+
+	  protected:
+#if defined(_WIN32)
+		HANDLE fileHandle{ INVALID_HANDLE_VALUE };
+		HANDLE mappingHandle{};
+#else
+		int32_t fileDescriptor{ -1 };
+#endif
+		const char* ptr{};
+		uint64_t length{};
+
+		inline void unmap() {
+#if defined(_WIN32)
+			if (ptr) {
+				UnmapViewOfFile(ptr);
+			}
+			if (mappingHandle) {
+				CloseHandle(mappingHandle);
+				mappingHandle = nullptr;
+			}
+			if (fileHandle != INVALID_HANDLE_VALUE) {
+				CloseHandle(fileHandle);
+				fileHandle = INVALID_HANDLE_VALUE;
+			}
+#else
+			if (ptr) {
+				munmap(const_cast<char*>(ptr), length);
+			}
+			if (fileDescriptor != -1) {
+				::close(fileDescriptor);
+				fileDescriptor = -1;
+			}
+#endif
+			ptr	   = nullptr;
+			length = 0;
+		}
+	};
+
+	/**@}*/
+
+}
@@ -0,0 +1,173 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// Metrics.hpp - Header for the library's runtime counters.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file Metrics.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/Base.hpp>
+
+namespace discord_core_api {
+
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// @brief A lock-free, monotonically increasing counter.
+	class metric_counter {
+	  public:
+		inline metric_counter() = default;
+
+		/// @brief Adds to the counter.
+		/// @param amount the amount to add.
+		inline void add(uint64_t amount = 1) {
+			value.fetch_add(amount, std::memory_order_relaxed);
+		}
+
+		/// @brief Collects the current value of the counter.
+		/// @return uint64_t the current value.
+		inline uint64_t load() const {
+			return value.load(std::memory_order_relaxed);
+		}
+
+	  protected:
+		std::atomic_uint64_t value{};
+	};
+
+	/// @brief A lock-free record of the count, total and maximum of a series of durations.
+	class metric_latency {
+	  public:
+		inline metric_latency() = default;
+
+		/// @brief Records a new sample.
+		/// @param sample the duration to be recorded.
+		inline void record(nanoseconds sample) {
+			uint64_t sampleCount{ static_cast<uint64_t>(sample.count()) };
+			count.fetch_add(1, std::memory_order_relaxed);
+			totalNs.fetch_add(sampleCount, std::memory_order_relaxed);
+			uint64_t currentMax{ maxNs.load(std::memory_order_relaxed) };
+			while (sampleCount > currentMax && !maxNs.compare_exchange_weak(currentMax, sampleCount, std::memory_order_relaxed)) {
+			}
+		}
+
+		/// @brief Collects the number of recorded samples.
+		inline uint64_t getCount() const {
+			return count.load(std::memory_order_relaxed);
+		}
+
+		/// @brief Collects the mean of the recorded samples.
+		inline nanoseconds getAverage() const {
+			auto countNew = count.load(std::memory_order_relaxed);
+			return countNew > 0 ? nanoseconds{ static_cast<int64_t>(totalNs.load(std::memory_order_relaxed) / countNew) } : nanoseconds{};
+		}
+
+		/// @brief Collects the largest recorded sample.
+		inline nanoseconds getMax() const {
+			return nanoseconds{ static_cast<int64_t>(maxNs.load(std::memory_order_relaxed)) };
+		}
+
+	  protected:
+		std::atomic_uint64_t totalNs{};
+		std::atomic_uint64_t count{};
+		std::atomic_uint64_t maxNs{};
+	};
+
+	/// @brief Tls handshake counters.
+	struct tls_metrics {
+		metric_latency resumedHandshakes{};///< Handshakes that resumed a cached session.
+		metric_latency fullHandshakes{};///< Handshakes that negotiated a new session.
+		metric_counter sessionsCached{};///< Sessions/tickets handed to us by servers.
+		metric_counter failedHandshakes{};///< Handshakes that failed outright.
+		metric_counter kernelTlsConnections{};///< Connections whose record layer was handed off to the kernel.
+		metric_counter sendfileBytes{};///< File bytes that went out through SSL_sendfile, without being copied into user space.
+	};
+
+	/// @brief Name resolution and tcp connect counters.
+	struct dns_metrics {
+		metric_latency lookups{};///< Lookups that actually went out to the system resolver.
+		metric_latency connects{};///< Time taken to establish tcp connections, across all attempted addresses.
+		metric_counter cacheHits{};///< Resolutions answered from a fresh cache entry.
+		metric_counter staleHits{};///< Resolutions answered from an expired entry, while it was being refreshed.
+		metric_counter failedLookups{};///< Lookups that returned no addresses.
+	};
+
+	/// @brief Https client counters.
+	struct https_metrics {
+		metric_counter coalescedRequests{};///< Get requests that were answered by another caller's identical, in-flight request.
+		metric_counter responseCacheInvalidations{};///< Cached responses dropped by gateway events or by our own writes.
+		metric_counter responseCacheMisses{};///< Cacheable get requests that had to go out to the api.
+		metric_counter responseCacheHits{};///< Cacheable get requests answered from the response cache.
+		metric_latency decodedBodies{};///< Time spent inflating gzip/deflate response bodies.
+		metric_counter encodedBodyBytes{};///< Bytes of those bodies as they arrived on the wire.
+		metric_counter decodedBodyBytes{};///< Bytes of those bodies once decoded.
+	};
+
+	/// @brief Object cache counters, summed across all of the caches.
+	struct cache_metrics {
+		metric_counter evictedEntries{};///< Objects evicted to keep a cache within its entry or byte budget.
+		metric_counter expiredEntries{};///< Objects dropped for going unrefreshed for longer than their cache's ttl.
+	};
+
+	/// @brief Process-wide runtime counters, for observing the library's behaviour.
+	class metrics {
+	  public:
+		inline static tls_metrics tls{};///< Tls handshake counters.
+		inline static dns_metrics dns{};///< Name resolution and tcp connect counters.
+		inline static https_metrics https{};///< Https client counters.
+		inline static cache_metrics caches{};///< Object cache counters.
+
+		/// @brief Formats the current values of all of the counters.
+		/// @return jsonifier::string a human-readable report.
+		inline static jsonifier::string report() {
+			jsonifier::string returnValue{};
+			returnValue += "tls: full handshakes: " + jsonifier::toString(tls.fullHandshakes.getCount()) +
+				", avg: " + jsonifier::toString(std::chrono::duration_cast<microseconds>(tls.fullHandshakes.getAverage()).count()) + "us" +
+				", resumed handshakes: " + jsonifier::toString(tls.resumedHandshakes.getCount()) +
+				", avg: " + jsonifier::toString(std::chrono::duration_cast<microseconds>(tls.resumedHandshakes.getAverage()).count()) + "us" +
+				", failed handshakes: " + jsonifier::toString(tls.failedHandshakes.load()) + ", sessions cached: " + jsonifier::toString(tls.sessionsCached.load()) +
+				", kernel tls connections: " + jsonifier::toString(tls.kernelTlsConnections.load()) + ", sendfile bytes: " + jsonifier::toString(tls.sendfileBytes.load()) + "\n";
+			returnValue += "dns: lookups: " + jsonifier::toString(dns.lookups.getCount()) +
+				", avg: " + jsonifier::toString(std::chrono::duration_cast<microseconds>(dns.lookups.getAverage()).count()) + "us" +
+				", cache hits: " + jsonifier::toString(dns.cacheHits.load()) + ", stale hits: " + jsonifier::toString(dns.staleHits.load()) +
+				", failed lookups: " + jsonifier::toString(dns.failedLookups.load()) + ", connects: " + jsonifier::toString(dns.connects.getCount()) +
+				", avg: " + jsonifier::toString(std::chrono::duration_cast<microseconds>(dns.connects.getAverage()).count()) + "us\n";
+			returnValue += "https: coalesced requests: " + jsonifier::toString(https.coalescedRequests.load()) +
+				", response cache hits: " + jsonifier::toString(https.responseCacheHits.load()) + ", misses: " + jsonifier::toString(https.responseCacheMisses.load()) +
+				", invalidations: " + jsonifier::toString(https.responseCacheInvalidations.load()) +
+				", decoded bodies: " + jsonifier::toString(https.decodedBodies.getCount()) +
+				", avg: " + jsonifier::toString(std::chrono::duration_cast<microseconds>(https.decodedBodies.getAverage()).count()) + "us" +
+				", encoded bytes: " + jsonifier::toString(https.encodedBodyBytes.load()) + ", decoded bytes: " + jsonifier::toString(https.decodedBodyBytes.load()) + "\n";
+			returnValue += "caches: evicted entries: " + jsonifier::toString(caches.evictedEntries.load()) +
+				", expired entries: " + jsonifier::toString(caches.expiredEntries.load()) + "\n";
+			return returnValue;
+		}
+	};
+
+	/**@}*/
+
+}
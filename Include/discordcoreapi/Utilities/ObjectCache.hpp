@@ -32,29 +32,193 @@
 #include <discordcoreapi/Utilities/Base.hpp>
 #include <discordcoreapi/Utilities/Etf.hpp>
 #include <discordcoreapi/Utilities/UniquePtr.hpp>
+#include <discordcoreapi/Utilities/Epoch.hpp>
+#include <discordcoreapi/Utilities/Metrics.hpp>
+#include <functional>
+#include <optional>
+#include <memory>
+#include <deque>
+#include <bit>
 
 namespace discord_core_api {
 
-	/// @brief A template class representing an object cache.
+	/// @brief A read-only view of an object in an object_cache, which keeps the object alive - without blocking writers - for as long as the view exists.
+	/// @tparam value_type the type of the viewed object.
+	template<typename value_type> class cache_view {
+	  public:
+		template<typename value_type_new, uint64_t> friend class object_cache;
+
+		inline cache_view& operator=(cache_view&& other) noexcept {
+			if (this != &other) {
+				guard = std::move(other.guard);
+				ptr	  = std::exchange(other.ptr, nullptr);
+			}
+			return *this;
+		}
+
+		inline cache_view(cache_view&& other) noexcept {
+			*this = std::move(other);
+		}
+
+		inline cache_view& operator=(const cache_view&) = delete;
+		inline cache_view(const cache_view&)			= delete;
+
+		inline cache_view() = default;
+
+		/// @brief Checks whether or not the object was found in the cache.
+		inline explicit operator bool() const {
+			return ptr != nullptr;
+		}
+
+		inline const value_type& operator*() const {
+			return *ptr;
+		}
+
+		inline const value_type* operator->() const {
+			return ptr;
+		}
+
+	  protected:
+		discord_core_internal::epoch_guard guard{ discord_core_internal::epoch_guard::empty() };
+		const value_type* ptr{};
+
+		inline cache_view(discord_core_internal::epoch_guard&& guardNew, const value_type* ptrNew) : guard{ std::move(guardNew) }, ptr{ ptrNew } {};
+	};
+
+	/// @brief Limits on what an object_cache may hold - each limit is left off while it is zero. The entry and byte limits are enforced per shard, as an even share of the
+	/// total.
+	struct cache_eviction_policy {
+		uint64_t maxEntries{};///< The most objects that the cache may hold.
+		uint64_t maxBytes{};///< The most bytes that the cache's objects may occupy, as estimated by sizeof() - so memory that they own on the heap isn't counted.
+		milliseconds ttl{};///< How long an object may go without being refreshed by an emplace() or update() before it expires.
+
+		/// @brief Checks whether any of the limits are set.
+		inline bool isItActive() const {
+			return maxEntries > 0 || maxBytes > 0 || ttl.count() > 0;
+		}
+	};
+
+	/// @brief A list held by a cached object, which copies of the object share until one of them modifies it - so that object_cache::update(), which copies the
+	/// object it modifies, only copies the lists that it actually changes.
+	/// @tparam value_type the type of the list's elements.
+	template<typename value_type> class copy_on_write_vector {
+	  public:
+		using vector_type	 = jsonifier::vector<value_type>;
+		using const_iterator = typename vector_type::const_iterator;
+		using size_type		 = uint64_t;
+
+		inline copy_on_write_vector() = default;
+
+		inline copy_on_write_vector& operator=(vector_type&& valuesNew) {
+			values = std::make_shared<const vector_type>(std::move(valuesNew));
+			return *this;
+		}
+
+		inline copy_on_write_vector(vector_type&& valuesNew) {
+			*this = std::move(valuesNew);
+		}
+
+		inline const_iterator begin() const {
+			return get().begin();
+		}
+
+		inline const_iterator end() const {
+			return get().end();
+		}
+
+		inline size_type size() const {
+			return get().size();
+		}
+
+		inline bool empty() const {
+			return get().empty();
+		}
+
+		inline const value_type& at(size_type index) const {
+			return get().at(index);
+		}
+
+		inline const value_type& operator[](size_type index) const {
+			return get()[index];
+		}
+
+		/// @brief Collects the list itself.
+		inline const vector_type& get() const {
+			static const vector_type emptyValues{};
+			return values ? *values : emptyValues;
+		}
+
+		/// @brief Appends an element, to a fresh copy of the list.
+		template<typename... arg_types> inline void emplace_back(arg_types&&... args) {
+			auto valuesNew = get();
+			valuesNew.emplace_back(std::forward<arg_types>(args)...);
+			*this = std::move(valuesNew);
+		}
+
+		/// @brief Removes an element, from a fresh copy of the list.
+		/// @param iter an iterator to the element, into this list.
+		inline void erase(const_iterator iter) {
+			auto index	   = static_cast<int64_t>(iter - begin());
+			auto valuesNew = get();
+			valuesNew.erase(valuesNew.begin() + index);
+			*this = std::move(valuesNew);
+		}
+
+		inline void clear() {
+			values.reset();
+		}
+
+	  protected:
+		std::shared_ptr<const vector_type> values{};///< The list - never modified once it is shared, only replaced.
+	};
+
+	/// @brief An object held by an object_cache, along with its eviction state.
+	/// @tparam value_type the type of the object.
+	template<typename value_type> struct cache_entry {
+		inline cache_entry() = default;
+
+		template<typename value_type_new> inline explicit cache_entry(value_type_new&& valueNew) : value(std::forward<value_type_new>(valueNew)) {};
+
+		value_type value{};///< The object.
+		int64_t refreshedAt{};///< When the object was last emplaced or updated, in milliseconds - only kept while the cache has a ttl.
+		std::atomic_uint8_t weight{};///< The clock weight - 2 after a refresh, 1 after a read, and decremented each time the clock hand passes without evicting it.
+	};
+
+	template<typename value_type> struct key_hasher<cache_entry<value_type>> {
+		inline static uint64_t getHashKey(const cache_entry<value_type>& other) {
+			return key_hasher<value_type>::getHashKey(other.value);
+		}
+	};
+
+	/// @brief A template class representing an object cache, split into independently-locked shards by key hash.
 	/// @tparam value_type the type of values stored in the cache.
-	template<typename value_type> class object_cache {
+	/// @tparam shardCount the number of shards, which must be a power of two.
+	template<typename value_type, uint64_t shardCount = 32> class object_cache {
 	  public:
+		static_assert(shardCount > 0 && (shardCount & (shardCount - 1)) == 0, "Sorry, but the shard count of an object_cache must be a power of two.");
+
 		using mapped_type	  = value_type;
 		using reference		  = mapped_type&;
 		using const_reference = const mapped_type&;
 		using pointer		  = mapped_type*;
+		using entry_type	  = cache_entry<mapped_type>;
 
 		/// @brief Default constructor for the object_cache class.
-		inline object_cache() : cacheMap{} {};
+		inline object_cache() = default;
 
 		/// @brief Move assignment operator for the object_cache class.
 		/// @param other another object_cache instance to be moved.
 		/// @return reference to the current object_cache instance.
 		inline object_cache& operator=(object_cache&& other) noexcept {
 			if (this != &other) {
-				std::unique_lock lock01{ other.cacheMutex };
-				std::unique_lock lock02{ cacheMutex };
-				std::swap(cacheMap, other.cacheMap);
+				for (uint64_t x = 0; x < shardCount; ++x) {
+					std::scoped_lock lock{ other.shards[x].cacheMutex, shards[x].cacheMutex };
+					std::swap(shards[x].cacheMap, other.shards[x].cacheMap);
+					std::swap(shards[x].clockQueue, other.shards[x].clockQueue);
+					std::swap(shards[x].byteCount, other.shards[x].byteCount);
+				}
+				std::swap(policy, other.policy);
+				std::swap(evictionHandler, other.evictionHandler);
 			}
 			return *this;
 		}
@@ -65,70 +229,289 @@ namespace discord_core_api {
 			*this = std::move(other);
 		}
 
-		/// @brief Add an object to the cache.
+		/// @brief Sets the limits that the cache is kept within - this must be called before the cache is in use.
+		/// @param policyNew the new limits.
+		inline void setEvictionPolicy(const cache_eviction_policy& policyNew) {
+			policy = policyNew;
+		}
+
+		/// @brief Sets a function to be called with each object that gets evicted or expires - this must be called before the cache is in use.
+		/// @param handlerNew the function, which is called while the object's shard is locked, and so must not call back into this cache.
+		inline void setEvictionHandler(std::function<void(const_reference)> handlerNew) {
+			evictionHandler = std::move(handlerNew);
+		}
+
+		/// @brief Add an object to the cache, or overwrite the existing object with the same key.
 		/// @tparam mapped_type_new the type of the object to be added.
 		/// @param object the object to be added to the cache.
-		/// @return an iterator pointing to the newly added object in the cache.
-		template<typename mapped_type_new> inline auto emplace(mapped_type_new&& object) {
-			std::unique_lock lock(cacheMutex);
-			return cacheMap.emplace(makeUnique<std::remove_cvref_t<mapped_type_new>>(std::forward<mapped_type_new>(object)));
+		template<typename mapped_type_new> inline void emplace(mapped_type_new&& object) {
+			auto& shard = getShard(object);
+			std::unique_lock lock{ shard.cacheMutex };
+			if (auto iter = shard.cacheMap.find(object); iter != shard.cacheMap.end()) {
+				// objects are never modified in place, as views of them may be being read - the old one is retired until its readers are gone.
+				auto newObject = makeUnique<entry_type>(std::forward<mapped_type_new>(object));
+				refresh(*newObject);
+				(*iter).swap(newObject);
+				discord_core_internal::epoch_manager::retire(newObject.release());
+			} else {
+				auto newObject = makeUnique<entry_type>(std::forward<mapped_type_new>(object));
+				refresh(*newObject);
+				track(shard, *newObject);
+				shard.cacheMap.emplace(std::move(newObject));
+				enforcePolicy(shard);
+			}
 		}
 
-		/// @brief Access an object in the cache using a key.
+		/// @brief Collect a copy of an object in the cache.
+		/// @tparam key_type the type of the key used for access.
+		/// @param key the key of the object to be collected.
+		/// @return std::optional<mapped_type> a copy of the object, or nothing if it isn't cached.
+		template<typename key_type> inline std::optional<mapped_type> find(key_type&& key) const {
+			auto& shard = getShard(key);
+			std::shared_lock lock{ shard.cacheMutex };
+			if (auto iter = shard.cacheMap.find(key); iter != shard.cacheMap.end() && touch(**iter)) {
+				return std::optional<mapped_type>{ (*iter)->value };
+			}
+			return std::nullopt;
+		}
+
+		/// @brief Collect a read-only view of an object in the cache, without copying it.
+		/// @tparam key_type the type of the key used for access.
+		/// @param key the key of the object to be viewed.
+		/// @return cache_view<mapped_type> a view of the object, which is empty if it isn't cached.
+		template<typename key_type> inline cache_view<mapped_type> view(key_type&& key) const {
+			discord_core_internal::epoch_guard guard{};
+			auto& shard = getShard(key);
+			std::shared_lock lock{ shard.cacheMutex };
+			if (auto iter = shard.cacheMap.find(key); iter != shard.cacheMap.end() && touch(**iter)) {
+				return cache_view<mapped_type>{ std::move(guard), &(*iter)->value };
+			}
+			return cache_view<mapped_type>{};
+		}
+
+		/// @brief Modify a copy of an object in the cache, while holding its shard's write lock, and then replace the object with it.
+		/// @tparam key_type the type of the key used for access.
+		/// @tparam function_type the type of the function that modifies the object.
+		/// @param key the key of the object to be modified.
+		/// @param function the function to be called with a reference to the object.
+		/// @return `true` if the object was cached, and so was modified, `false` otherwise.
+		template<typename key_type, typename function_type> inline bool update(key_type&& key, function_type&& function) {
+			auto& shard = getShard(key);
+			std::unique_lock lock{ shard.cacheMutex };
+			if (auto iter = shard.cacheMap.find(key); iter != shard.cacheMap.end()) {
+				auto newObject = makeUnique<entry_type>(static_cast<const_reference>((*iter)->value));
+				function(newObject->value);
+				refresh(*newObject);
+				(*iter).swap(newObject);
+				discord_core_internal::epoch_manager::retire(newObject.release());
+				return true;
+			}
+			return false;
+		}
+
+		/// @brief Visit every object in the cache, one shard at a time, while holding each shard's read lock.
+		/// @tparam function_type the type of the function to be called.
+		/// @param function the function to be called with a const reference to each object - it must not call back into this cache.
+		template<typename function_type> inline void visit(function_type&& function) const {
+			for (auto& shard: shards) {
+				std::shared_lock lock{ shard.cacheMutex };
+				for (auto& value: shard.cacheMap) {
+					if (!isItExpired(*value)) {
+						function(static_cast<const_reference>(value->value));
+					}
+				}
+			}
+		}
+
+		/// @brief Access an object in the cache using a key - the same as view(), so that the object stays valid for as long as the returned view is held, and a missing
+		/// key inserts nothing.
 		/// @tparam mapped_type_new the type of the key used for access.
 		/// @param key the key used for accessing the object in the cache.
-		/// @return reference to the object associated with the provided key.
-		template<typename mapped_type_new> inline reference operator[](mapped_type_new&& key) {
-			std::shared_lock lock(cacheMutex);
-			if (!cacheMap.contains(key)) {
-				cacheMap.emplace(makeUnique<mapped_type>());
-			}
-			return *cacheMap.operator[](key);
+		/// @return cache_view<mapped_type> a view of the object, which is empty if it isn't cached.
+		template<typename mapped_type_new> inline cache_view<mapped_type> operator[](mapped_type_new&& key) const {
+			return view(std::forward<mapped_type_new>(key));
 		}
 
 		/// @brief Check if the cache contains an object with a given key.
 		/// @tparam mapped_type_new the type of the key to be checked.
 		/// @param key the key to check for existence in the cache.
 		/// @return `true` if the cache contains the key, `false` otherwise.
-		template<typename mapped_type_new> inline bool contains(mapped_type_new&& key) {
-			std::shared_lock lock(cacheMutex);
-			return cacheMap.contains(std::forward<mapped_type_new>(key));
+		template<typename mapped_type_new> inline bool contains(mapped_type_new&& key) const {
+			auto& shard = getShard(key);
+			std::shared_lock lock{ shard.cacheMutex };
+			auto iter = shard.cacheMap.find(key);
+			return iter != shard.cacheMap.end() && !isItExpired(**iter);
 		}
 
 		/// @brief Remove an object from the cache using a key.
 		/// @tparam mapped_type_new the type of the key used for removal.
 		/// @param key the key used to remove the object from the cache.
 		template<typename mapped_type_new> inline void erase(mapped_type_new&& key) {
-			std::unique_lock lock(cacheMutex);
-			cacheMap.erase(std::forward<mapped_type_new>(key));
+			auto& shard = getShard(key);
+			std::unique_lock lock{ shard.cacheMutex };
+			if (auto iter = shard.cacheMap.find(key); iter != shard.cacheMap.end()) {
+				auto& object = *iter;
+				shard.byteCount -= sizeof(entry_type);
+				// erasing only clears the slot's sentinel, leaving the pointer in place to be released - it can't be released first, as erasure hashes it.
+				shard.cacheMap.erase(std::forward<mapped_type_new>(key));
+				discord_core_internal::epoch_manager::retire(object.release());
+			}
 		}
 
 		/// @brief Get the number of objects currently in the cache.
 		/// @return the number of objects in the cache.
-		inline uint64_t count() {
-			std::shared_lock lock(cacheMutex);
-			return cacheMap.size();
-		}
-
-		/// @brief Get an iterator to the beginning of the cache.
-		/// @return an iterator to the beginning of the cache.
-		inline auto begin() {
-			return cacheMap.begin();
+		inline uint64_t count() const {
+			uint64_t returnValue{};
+			for (auto& shard: shards) {
+				std::shared_lock lock{ shard.cacheMutex };
+				returnValue += shard.cacheMap.size();
+			}
+			return returnValue;
 		}
 
-		/// @brief Get an iterator to the end of the cache.
-		/// @return an iterator to the end of the cache.
-		inline auto end() {
-			return cacheMap.end();
+		/// @brief Get the estimated number of bytes occupied by the objects currently in the cache.
+		/// @return the number of bytes, as estimated by sizeof().
+		inline uint64_t getByteCount() const {
+			uint64_t returnValue{};
+			for (auto& shard: shards) {
+				std::shared_lock lock{ shard.cacheMutex };
+				returnValue += shard.byteCount;
+			}
+			return returnValue;
 		}
 
 		/// @brief Destructor for the object_cache class.
 		inline ~object_cache(){};
 
 	  protected:
-		unordered_set<unique_ptr<mapped_type>> cacheMap{};///< The underlying container for storing objects.
-		std::shared_mutex cacheMutex{};///< Mutex for ensuring thread-safe access to the cache.
-	};
+		/// @brief One independently-locked slice of the cache.
+		struct alignas(64) cache_shard {
+			unordered_set<unique_ptr<entry_type>> cacheMap{};///< The underlying container for storing this shard's objects.
+			std::deque<uint64_t> clockQueue{};///< The hashes of this shard's objects, in the order that the clock hand visits them.
+			mutable std::shared_mutex cacheMutex{};///< Mutex for ensuring thread-safe access to this shard.
+			uint64_t byteCount{};///< The estimated bytes occupied by this shard's objects.
+		};
+
+		std::array<cache_shard, shardCount> shards{};///< The shards, selected by the high bits of each key's hash.
+		std::function<void(const_reference)> evictionHandler{};///< Called with each evicted or expired object.
+		cache_eviction_policy policy{};///< The limits that the cache is kept within.
+
+		/// @brief Selects the shard that a given key or object belongs to.
+		/// @tparam key_type the type of the key or object.
+		/// @param key the key or object.
+		/// @return a reference to the shard.
+		template<typename key_type> inline cache_shard& getShard(key_type&& key) const {
+			// the sets index their buckets with the low bits of the same hash, so the high bits keep the shards from skewing them.
+			static constexpr uint64_t shardBits{ static_cast<uint64_t>(std::countr_zero(shardCount)) };
+			uint64_t hash{ key_accessor<std::unwrap_ref_decay_t<key_type>>::getHashKey(key) };
+			return const_cast<cache_shard&>(shards[shardBits == 0 ? 0 : hash >> (64 - shardBits)]);
+		}
 
+		inline static int64_t getCurrentTime() {
+			return std::chrono::duration_cast<milliseconds>(hrclock::now().time_since_epoch()).count();
+		}
+
+		/// @brief Marks an entry as freshly written, which protects it from the next two passes of the clock hand.
+		inline void refresh(entry_type& entry) const {
+			if (policy.isItActive()) {
+				entry.weight.store(2, std::memory_order_relaxed);
+				if (policy.ttl.count() > 0) {
+					entry.refreshedAt = getCurrentTime();
+				}
+			}
+		}
+
+		/// @brief Marks an entry as read, under a shared lock.
+		/// @return false if the entry has expired, and so should be treated as missing.
+		inline bool touch(const entry_type& entry) const {
+			if (!policy.isItActive()) {
+				return true;
+			}
+			if (isItExpired(entry)) {
+				return false;
+			}
+			auto& weight = const_cast<std::atomic_uint8_t&>(entry.weight);
+			if (weight.load(std::memory_order_relaxed) == 0) {
+				weight.store(1, std::memory_order_relaxed);
+			}
+			return true;
+		}
+
+		inline bool isItExpired(const entry_type& entry) const {
+			return policy.ttl.count() > 0 && getCurrentTime() - entry.refreshedAt >= policy.ttl.count();
+		}
+
+		/// @brief Accounts for a newly-added entry.
+		inline void track(cache_shard& shard, const entry_type& entry) {
+			shard.byteCount += sizeof(entry_type);
+			if (policy.isItActive()) {
+				shard.clockQueue.emplace_back(key_hasher<entry_type>::getHashKey(entry));
+			}
+		}
+
+		inline bool isItOverBudget(const cache_shard& shard) const {
+			uint64_t maxEntries{ (policy.maxEntries + shardCount - 1) / shardCount };
+			uint64_t maxBytes{ (policy.maxBytes + shardCount - 1) / shardCount };
+			return (maxEntries > 0 && shard.cacheMap.size() > maxEntries) || (maxBytes > 0 && shard.byteCount > maxBytes);
+		}
+
+		/// @brief Brings a shard back within the policy's limits - the clock hand evicts entries until the shard is within its budget, and then sweeps a few more for
+		/// expired ones.
+		inline void enforcePolicy(cache_shard& shard) {
+			if (!policy.isItActive()) {
+				return;
+			}
+			static constexpr uint64_t expirySweepLength{ 8 };
+			// each pass of the hand lowers every weight by one, and no weight is above 2, so three passes are always enough.
+			uint64_t stepsRemaining{ shard.clockQueue.size() * 3 };
+			uint64_t sweepsRemaining{ policy.ttl.count() > 0 ? expirySweepLength : 0 };
+			while (!shard.clockQueue.empty() && stepsRemaining > 0) {
+				bool isItOver{ isItOverBudget(shard) };
+				if (!isItOver && sweepsRemaining == 0) {
+					break;
+				}
+				--stepsRemaining;
+				uint64_t hash{ shard.clockQueue.front() };
+				shard.clockQueue.pop_front();
+				auto iter = shard.cacheMap.find(precomputed_hash{ hash });
+				if (iter == shard.cacheMap.end()) {
+					// erased since it was queued.
+					continue;
+				}
+				auto& entry = **iter;
+				if (isItExpired(entry)) {
+					metrics::caches.expiredEntries.add();
+					evict(shard, hash);
+				} else if (!isItOver) {
+					--sweepsRemaining;
+					shard.clockQueue.emplace_back(hash);
+				} else if (entry.weight.load(std::memory_order_relaxed) > 0) {
+					entry.weight.fetch_sub(1, std::memory_order_relaxed);
+					shard.clockQueue.emplace_back(hash);
+				} else {
+					metrics::caches.evictedEntries.add();
+					evict(shard, hash);
+				}
+			}
+			if (shard.clockQueue.size() > shard.cacheMap.size() * 2 + 16) {
+				// erased entries leave their hashes behind, so the queue is rebuilt once they make up most of it.
+				shard.clockQueue.clear();
+				for (auto& value: shard.cacheMap) {
+					shard.clockQueue.emplace_back(key_hasher<entry_type>::getHashKey(*value));
+				}
+			}
+		}
+
+		inline void evict(cache_shard& shard, uint64_t hash) {
+			auto iter = shard.cacheMap.find(precomputed_hash{ hash });
+			auto& object = *iter;
+			if (evictionHandler) {
+				evictionHandler(static_cast<const_reference>(object->value));
+			}
+			shard.byteCount -= sizeof(entry_type);
+			shard.cacheMap.erase(precomputed_hash{ hash });
+			discord_core_internal::epoch_manager::retire(object.release());
+		}
+	};
 
 }
@@ -0,0 +1,114 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// RestProxy.hpp - Header for the rest proxy, which relays the requests of several processes through one set of rate limits.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file RestProxy.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/HttpsClient.hpp>
+
+namespace discord_core_api {
+
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// @brief Options for the rest proxy.
+	struct rest_proxy_options {
+		jsonifier::string bindAddress{ "127.0.0.1" };///< The local address to listen on - the proxy speaks plain http, so keep this on a private interface.
+		jsonifier::string botToken{};///< The bot token that every relayed request is authorized with.
+		uint64_t maxPendingConnections{ 64 };///< Accepted connections that may wait for a free worker - any beyond this are answered with a 503.
+		milliseconds idleTimeout{ 30000 };///< How long a connection may go without sending anything before it is closed, to free its worker.
+		uint64_t workerCount{ 16 };///< The threads that serve connections - each serves one connection at a time, until it closes or goes idle.
+		uint16_t port{ 8090 };///< The port to listen on.
+		bool enableKernelTls{};///< Do we hand the upstream connections' record encryption off to the kernel? (linux only).
+	};
+
+	/// @brief Relays rest requests from the https_clients of other processes - all running the same token - through a single https_client, so that they all
+	/// share one set of rate-limit buckets. processes opt in through https_options::proxyAddress. only requests to discord's api are relayed, as the proxy
+	/// authorizes everything that it sends with its token.
+	class DiscordCoreAPI_Dll rest_proxy {
+	  public:
+		/// @brief Creates the proxy, and binds its listening socket.
+		/// @param options the options for the proxy.
+		rest_proxy(const rest_proxy_options& options);
+
+		/// @brief Accepts and serves connections until stop() is called.
+		void run();
+
+		/// @brief Makes run() return, once the connections that are currently being served have closed.
+		void stop();
+
+		/// @brief Whether or not the listening socket was bound successfully.
+		bool isItListening();
+
+		~rest_proxy();
+
+	  protected:
+		unique_ptr<discord_core_internal::https_client> httpsClient{};
+#if defined(_WIN32)
+		discord_core_internal::wsadata_wrapper theWSAData{};
+#endif
+		discord_core_internal::socket_wrapper listeningSocket{};
+		std::condition_variable_any pendingCondition{};
+		std::atomic_uint64_t activeConnections{};
+		std::deque<SOCKET> pendingConnections{};
+		uint64_t maxPendingConnections{};
+		std::atomic_bool doWeQuit{};
+		std::mutex pendingMutex{};
+		milliseconds idleTimeout{};
+		jsonifier::vector<std::jthread> workers{};
+
+		/// @brief Serves queued connections, one at a time, until the proxy is destroyed.
+		/// @param token the worker's stop token.
+		void runWorker(std::stop_token token);
+
+		/// @brief Serves the requests of one client connection, until it closes or goes idle.
+		/// @param clientSocket the accepted socket.
+		void serveConnection(SOCKET clientSocket);
+
+		/// @brief Reads one complete request from a client connection, and converts it into a workload.
+		/// @param clientSocket the socket to read from.
+		/// @param buffer bytes that have been received but not yet consumed.
+		/// @param workload the workload to fill.
+		/// @return true if a request was read, false if the connection closed or the request was malformed.
+		bool readRequest(SOCKET clientSocket, jsonifier::string& buffer, discord_core_internal::https_workload_data& workload);
+
+		/// @brief Writes a response back to a client connection.
+		/// @param clientSocket the socket to write to.
+		/// @param responseCode the status code of the response.
+		/// @param responseHeaders the headers of the upstream response, which are passed on apart from those that the proxy sets itself.
+		/// @param responseData the body of the response.
+		/// @return true if the whole response was written.
+		bool writeResponse(SOCKET clientSocket, uint64_t responseCode, const unordered_map<jsonifier::string, jsonifier::string>& responseHeaders,
+			jsonifier::string_view responseData);
+	};
+
+	/**@}*/
+
+}
@@ -0,0 +1,140 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// SecondaryIndex.hpp - Header for the secondary indices kept alongside the caches.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file SecondaryIndex.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/Base.hpp>
+#include <discordcoreapi/Utilities/UnorderedMap.hpp>
+#include <discordcoreapi/Utilities/UnorderedSet.hpp>
+#include <shared_mutex>
+#include <bit>
+
+namespace discord_core_api {
+
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// @brief A one-to-many index from a key to a set of ids, split into independently-locked shards by key hash - so that the ids under a key can be collected in
+	/// O(result), rather than by scanning a whole cache.
+	/// @tparam key_type the type of the key - snowflake or two_id_key.
+	/// @tparam shardCount the number of shards, which must be a power of two.
+	template<typename key_type, uint64_t shardCount = 32> class secondary_index {
+	  public:
+		static_assert(shardCount > 0 && (shardCount & (shardCount - 1)) == 0, "Sorry, but the shard count of a secondary_index must be a power of two.");
+
+		inline secondary_index() = default;
+
+		/// @brief Adds an id under a key.
+		/// @param key the key.
+		/// @param id the id to be added.
+		inline void insert(const key_type& key, snowflake id) {
+			auto& shard = getShard(key);
+			std::unique_lock lock{ shard.indexMutex };
+			shard.indexMap[key].emplace(id);
+		}
+
+		/// @brief Removes an id from under a key, dropping the key once it has no ids left.
+		/// @param key the key.
+		/// @param id the id to be removed.
+		inline void erase(const key_type& key, snowflake id) {
+			auto& shard = getShard(key);
+			std::unique_lock lock{ shard.indexMutex };
+			if (auto iter = shard.indexMap.find(key); iter != shard.indexMap.end()) {
+				iter->second.erase(id);
+				if (iter->second.empty()) {
+					shard.indexMap.erase(key);
+				}
+			}
+		}
+
+		/// @brief Collects the ids under a key.
+		/// @param key the key.
+		/// @return jsonifier::vector<snowflake> the ids.
+		inline jsonifier::vector<snowflake> collect(const key_type& key) const {
+			jsonifier::vector<snowflake> returnValues{};
+			auto& shard = getShard(key);
+			std::shared_lock lock{ shard.indexMutex };
+			if (auto iter = shard.indexMap.find(key); iter != shard.indexMap.end()) {
+				returnValues.reserve(iter->second.size());
+				for (auto& value: iter->second) {
+					returnValues.emplace_back(value);
+				}
+			}
+			return returnValues;
+		}
+
+		/// @brief Removes a key, and collects the ids that were under it.
+		/// @param key the key.
+		/// @return jsonifier::vector<snowflake> the ids.
+		inline jsonifier::vector<snowflake> extract(const key_type& key) {
+			jsonifier::vector<snowflake> returnValues{};
+			auto& shard = getShard(key);
+			std::unique_lock lock{ shard.indexMutex };
+			if (auto iter = shard.indexMap.find(key); iter != shard.indexMap.end()) {
+				returnValues.reserve(iter->second.size());
+				for (auto& value: iter->second) {
+					returnValues.emplace_back(value);
+				}
+				shard.indexMap.erase(key);
+			}
+			return returnValues;
+		}
+
+		/// @brief Collects the number of ids under a key.
+		/// @param key the key.
+		inline uint64_t count(const key_type& key) const {
+			auto& shard = getShard(key);
+			std::shared_lock lock{ shard.indexMutex };
+			if (auto iter = shard.indexMap.find(key); iter != shard.indexMap.end()) {
+				return iter->second.size();
+			}
+			return 0;
+		}
+
+	  protected:
+		/// @brief A shard of the index, padded out to its own cache line.
+		struct alignas(64) index_shard {
+			unordered_map<key_type, unordered_set<snowflake>> indexMap{};
+			mutable std::shared_mutex indexMutex{};
+		};
+
+		std::array<index_shard, shardCount> shards{};
+
+		inline index_shard& getShard(const key_type& key) const {
+			static constexpr uint64_t shardBits{ static_cast<uint64_t>(std::countr_zero(shardCount)) };
+			uint64_t hash{ key_hasher<key_type>::getHashKey(key) };
+			return const_cast<index_shard&>(shards[shardBits == 0 ? 0 : hash >> (64 - shardBits)]);
+		}
+	};
+
+	/**@}*/
+
+}
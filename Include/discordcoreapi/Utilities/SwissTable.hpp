@@ -0,0 +1,435 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// SwissTable.hpp - Header for the group-probed hash table behind the id-keyed unordered_maps and unordered_sets.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file SwissTable.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/ISADetection.hpp>
+#include <discordcoreapi/Utilities/Hash.hpp>
+#include <algorithm>
+#include <bit>
+
+namespace discord_core_api {
+
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// @brief The key types that unordered_map and unordered_set store in a swiss_table - ids, whose hashes are a single mixHash.
+	template<typename value_type>
+	concept swiss_key_t = std::same_as<value_type, snowflake> || std::same_as<value_type, two_id_key> || std::same_as<value_type, uint64_t>;
+
+	/// @brief An iterator over a swiss_table's occupied slots - one over a const table only hands out const references.
+	/// @tparam value_type_internal_new the table type, const-qualified for a const_iterator.
+	template<typename value_type_internal_new> class swiss_iterator {
+	  public:
+		using iterator_category	  = std::forward_iterator_tag;
+		using value_type_internal = value_type_internal_new;
+		using value_type		  = typename value_type_internal::value_type;
+		using reference			  = std::conditional_t<std::is_const_v<value_type_internal>, const value_type&, value_type&>;
+		using pointer			  = std::conditional_t<std::is_const_v<value_type_internal>, const value_type*, value_type*>;
+		using pointer_internal	  = value_type_internal*;
+		using size_type			  = uint64_t;
+		using group_type		  = discord_core_internal::control_group;
+
+		inline swiss_iterator() = default;
+
+		inline swiss_iterator(pointer_internal valueNew, size_type currentIndexNew) : value{ valueNew }, currentIndex{ currentIndexNew } {
+			skipEmptySlots();
+		};
+
+		inline swiss_iterator& operator++() {
+			++currentIndex;
+			skipEmptySlots();
+			return *this;
+		}
+
+		inline swiss_iterator operator+(size_type amountToAdd) const {
+			swiss_iterator returnValue{ *this };
+			for (size_type x = 0; x < amountToAdd; ++x) {
+				++returnValue;
+			}
+			return returnValue;
+		}
+
+		inline pointer getRawPtr() {
+			return &value->data[currentIndex];
+		}
+
+		inline bool operator==(const swiss_iterator& other) const {
+			return currentIndex == other.currentIndex;
+		}
+
+		inline pointer operator->() {
+			return &value->data[currentIndex];
+		}
+
+		inline reference operator*() {
+			return value->data[currentIndex];
+		}
+
+	  protected:
+		pointer_internal value{};
+		size_type currentIndex{};
+
+		/// @brief Moves forward to the next occupied slot, stepping over entirely unoccupied groups at once.
+		inline void skipEmptySlots() {
+			while (value && currentIndex < value->capacityVal && value->controlBytes[currentIndex] < 0) {
+				if (currentIndex % group_type::width == 0 && group_type{ value->controlBytes.data() + currentIndex }.matchFull() == 0) {
+					currentIndex += group_type::width;
+				} else {
+					++currentIndex;
+				}
+			}
+		}
+	};
+
+	/// @brief An open-addressing hash table, with one control byte per slot that holds either 7 bits of the slot's hash or an empty/deleted marker - so that a whole
+	/// group of slots is probed at once, with the widest simd registers available, and keys are only compared for the slots whose fragment matches.
+	/// @tparam key_type_new the type of the key.
+	/// @tparam value_type_new the type stored in each slot - a std::pair of key and value, for maps, or the key itself, for sets.
+	template<swiss_key_t key_type_new, typename value_type_new> class swiss_table : protected jsonifier_internal::alloc_wrapper<value_type_new> {
+	  public:
+		using key_type		   = key_type_new;
+		using value_type	   = value_type_new;
+		using allocator_type   = jsonifier_internal::alloc_wrapper<value_type>;
+		using allocator_traits = std::allocator_traits<allocator_type>;
+		using size_type		   = uint64_t;
+		using difference_type  = int64_t;
+		using pointer		   = typename allocator_traits::pointer;
+		using const_pointer	   = typename allocator_traits::const_pointer;
+		using reference		   = value_type&;
+		using const_reference  = const value_type&;
+		using iterator		   = swiss_iterator<swiss_table>;
+		using const_iterator   = swiss_iterator<const swiss_table>;
+		using group_type	   = discord_core_internal::control_group;
+
+		friend iterator;
+		friend const_iterator;
+
+		inline swiss_table(){};
+
+		inline swiss_table& operator=(swiss_table&& other) noexcept {
+			if (this != &other) {
+				reset();
+				swap(other);
+			}
+			return *this;
+		}
+
+		inline swiss_table(swiss_table&& other) noexcept {
+			*this = std::move(other);
+		}
+
+		inline swiss_table& operator=(const swiss_table& other) {
+			if (this != &other) {
+				reset();
+				reserve(other.size());
+				for (size_type x = 0; x < other.capacityVal; ++x) {
+					if (other.controlBytes[x] >= 0) {
+						insertUnique(value_type{ other.data[x] });
+					}
+				}
+			}
+			return *this;
+		}
+
+		inline swiss_table(const swiss_table& other) {
+			*this = other;
+		}
+
+		template<typename key_type_newer> inline const_iterator find(key_type_newer&& key) const {
+			return { this, findIndex(toKey(std::forward<key_type_newer>(key))) };
+		}
+
+		template<typename key_type_newer> inline iterator find(key_type_newer&& key) {
+			return { this, findIndex(toKey(std::forward<key_type_newer>(key))) };
+		}
+
+		template<typename key_type_newer> inline bool contains(key_type_newer&& key) const {
+			return findIndex(toKey(std::forward<key_type_newer>(key))) != capacityVal;
+		}
+
+		inline iterator erase(iterator iter) {
+			auto currentIndex = static_cast<size_type>(iter.getRawPtr() - data);
+			eraseIndex(currentIndex);
+			return { this, currentIndex + 1 };
+		}
+
+		template<typename key_type_newer>
+			requires(!std::same_as<std::remove_cvref_t<key_type_newer>, iterator>)
+		inline iterator erase(key_type_newer&& key) {
+			auto currentIndex = findIndex(toKey(std::forward<key_type_newer>(key)));
+			if (currentIndex == capacityVal) {
+				return end();
+			}
+			eraseIndex(currentIndex);
+			return { this, currentIndex + 1 };
+		}
+
+		inline const_iterator begin() const {
+			return { this, sizeVal > 0 ? 0 : capacityVal };
+		}
+
+		inline const_iterator end() const {
+			return { this, capacityVal };
+		}
+
+		inline iterator begin() {
+			return { this, sizeVal > 0 ? 0 : capacityVal };
+		}
+
+		inline iterator end() {
+			return { this, capacityVal };
+		}
+
+		inline size_type size() const {
+			return sizeVal;
+		}
+
+		inline bool empty() const {
+			return sizeVal == 0;
+		}
+
+		inline void reserve(size_type sizeNew) {
+			size_type capacityNew{ std::bit_ceil(std::max<size_type>(group_type::width, sizeNew + sizeNew / 7 + 1)) };
+			if (capacityNew > capacityVal) {
+				rehash(capacityNew);
+			}
+		}
+
+		inline void swap(swiss_table& other) {
+			std::swap(controlBytes, other.controlBytes);
+			std::swap(capacityVal, other.capacityVal);
+			std::swap(growthLeft, other.growthLeft);
+			std::swap(sizeVal, other.sizeVal);
+			std::swap(data, other.data);
+		}
+
+		inline size_type capacity() const {
+			return capacityVal;
+		}
+
+		inline bool operator==(const swiss_table& other) const {
+			if (sizeVal != other.sizeVal) {
+				return false;
+			}
+			for (size_type x = 0; x < capacityVal; ++x) {
+				if (controlBytes[x] >= 0) {
+					auto otherIndex = other.findIndex(getKey(data[x]));
+					if (otherIndex == other.capacityVal || !(other.data[otherIndex] == data[x])) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		inline void clear() {
+			for (size_type x = 0; x < capacityVal; ++x) {
+				if (controlBytes[x] >= 0) {
+					allocator_traits::destroy(*this, data + x);
+				}
+			}
+			std::fill(controlBytes.begin(), controlBytes.end(), emptyControl);
+			growthLeft = maxLoad(capacityVal);
+			sizeVal	   = 0;
+		}
+
+		inline ~swiss_table() {
+			reset();
+		};
+
+	  protected:
+		static constexpr int8_t deletedControl{ -2 };
+		static constexpr int8_t emptyControl{ -128 };
+
+		jsonifier::vector<int8_t> controlBytes{};
+		size_type capacityVal{};
+		size_type growthLeft{};
+		size_type sizeVal{};
+		value_type* data{};
+
+		template<typename key_type_newer> inline static decltype(auto) toKey(key_type_newer&& key) {
+			if constexpr (std::same_as<std::remove_cvref_t<key_type_newer>, key_type>) {
+				return std::forward<key_type_newer>(key);
+			} else {
+				return static_cast<key_type>(std::forward<key_type_newer>(key));
+			}
+		}
+
+		inline static const key_type& getKey(const value_type& value) {
+			if constexpr (std::same_as<value_type, key_type>) {
+				return value;
+			} else {
+				return value.first;
+			}
+		}
+
+		inline static uint64_t hashKey(const key_type& key) {
+			return key_hasher<key_type>::getHashKey(key);
+		}
+
+		inline static int8_t fragment(uint64_t hash) {
+			return static_cast<int8_t>(hash & 0x7F);
+		}
+
+		/// @brief The number of slots that may be occupied before growing - 7/8ths of them, so that every probe sequence is guaranteed to end at an empty slot.
+		inline static size_type maxLoad(size_type capacityNew) {
+			return capacityNew - capacityNew / 8;
+		}
+
+		/// @brief Collects the index of a key's slot, or capacityVal if it isn't present - probing whole groups, in triangular steps, until one holds an empty slot.
+		inline size_type findIndex(const key_type& key) const {
+			if (sizeVal == 0) {
+				return capacityVal;
+			}
+			const uint64_t hash{ hashKey(key) };
+			const int8_t fragmentNew{ fragment(hash) };
+			const size_type groupMask{ capacityVal / group_type::width - 1 };
+			size_type groupIndex{ (hash >> 7) & groupMask };
+			for (size_type x = 1;; ++x) {
+				const size_type groupStart{ groupIndex * group_type::width };
+				group_type group{ controlBytes.data() + groupStart };
+				for (uint64_t matches{ group.match(fragmentNew) }; matches != 0; matches &= matches - 1) {
+					size_type currentIndex{ groupStart + group_type::lowestIndex(matches) };
+					if (getKey(data[currentIndex]) == key) {
+						return currentIndex;
+					}
+				}
+				if (group.matchEmpty() != 0) {
+					return capacityVal;
+				}
+				groupIndex = (groupIndex + x) & groupMask;
+			}
+		}
+
+		/// @brief Collects the index of the first empty or deleted slot along a hash's probe sequence.
+		inline size_type findInsertIndex(uint64_t hash) const {
+			const size_type groupMask{ capacityVal / group_type::width - 1 };
+			size_type groupIndex{ (hash >> 7) & groupMask };
+			for (size_type x = 1;; ++x) {
+				const size_type groupStart{ groupIndex * group_type::width };
+				if (uint64_t matches{ group_type{ controlBytes.data() + groupStart }.matchEmptyOrDeleted() }; matches != 0) {
+					return groupStart + group_type::lowestIndex(matches);
+				}
+				groupIndex = (groupIndex + x) & groupMask;
+			}
+		}
+
+		/// @brief Inserts a key, or finds it if it is already present - in which case a map's value is overwritten, as with the other unordered_map.
+		template<typename key_type_newer, typename... mapped_type_new> inline iterator emplaceInternal(key_type_newer&& key, mapped_type_new&&... value) {
+			decltype(auto) keyNew = toKey(std::forward<key_type_newer>(key));
+			if (auto currentIndex = findIndex(keyNew); currentIndex != capacityVal) {
+				if constexpr (!std::same_as<value_type, key_type> && sizeof...(mapped_type_new) > 0) {
+					data[currentIndex].second = typename value_type::second_type{ std::forward<mapped_type_new>(value)... };
+				}
+				return { this, currentIndex };
+			}
+			if constexpr (std::same_as<value_type, key_type>) {
+				return { this, insertUnique(value_type{ std::forward<decltype(keyNew)>(keyNew) }) };
+			} else {
+				return { this,
+					insertUnique(value_type{ std::forward<decltype(keyNew)>(keyNew), typename value_type::second_type{ std::forward<mapped_type_new>(value)... } }) };
+			}
+		}
+
+		/// @brief Inserts a value whose key is known not to be present, growing or purging deleted slots first if need be.
+		inline size_type insertUnique(value_type&& value) {
+			if (growthLeft == 0) {
+				rehash(capacityVal == 0 ? group_type::width : (sizeVal < maxLoad(capacityVal) / 2 ? capacityVal : capacityVal * 2));
+			}
+			const uint64_t hash{ hashKey(getKey(value)) };
+			const size_type currentIndex{ findInsertIndex(hash) };
+			if (controlBytes[currentIndex] == emptyControl) {
+				--growthLeft;
+			}
+			allocator_traits::construct(*this, data + currentIndex, std::move(value));
+			controlBytes[currentIndex] = fragment(hash);
+			++sizeVal;
+			return currentIndex;
+		}
+
+		/// @brief Empties a slot - marking it as empty if its group has never been full, since then no probe sequence can have passed over it, and as deleted
+		/// otherwise.
+		inline void eraseIndex(size_type currentIndex) {
+			allocator_traits::destroy(*this, data + currentIndex);
+			--sizeVal;
+			if (group_type{ controlBytes.data() + currentIndex / group_type::width * group_type::width }.matchEmpty() != 0) {
+				controlBytes[currentIndex] = emptyControl;
+				++growthLeft;
+			} else {
+				controlBytes[currentIndex] = deletedControl;
+			}
+		}
+
+		inline void rehash(size_type capacityNew) {
+			jsonifier::vector<int8_t> oldControlBytes{ std::move(controlBytes) };
+			auto oldCapacity = capacityVal;
+			auto oldPtr		 = data;
+			controlBytes	 = jsonifier::vector<int8_t>{};
+			controlBytes.resize(capacityNew);
+			std::fill(controlBytes.begin(), controlBytes.end(), emptyControl);
+			data		= allocator_traits::allocate(*this, capacityNew);
+			capacityVal = capacityNew;
+			growthLeft	= maxLoad(capacityNew) - sizeVal;
+			for (size_type x = 0; x < oldCapacity; ++x) {
+				if (oldControlBytes[x] >= 0) {
+					const uint64_t hash{ hashKey(getKey(oldPtr[x])) };
+					const size_type currentIndex{ findInsertIndex(hash) };
+					allocator_traits::construct(*this, data + currentIndex, std::move(oldPtr[x]));
+					allocator_traits::destroy(*this, oldPtr + x);
+					controlBytes[currentIndex] = fragment(hash);
+				}
+			}
+			if (oldPtr && oldCapacity) {
+				allocator_traits::deallocate(*this, oldPtr, oldCapacity);
+			}
+		}
+
+		inline void reset() {
+			if (data) {
+				for (size_type x = 0; x < capacityVal; ++x) {
+					if (controlBytes[x] >= 0) {
+						allocator_traits::destroy(*this, data + x);
+					}
+				}
+				allocator_traits::deallocate(*this, data, capacityVal);
+			}
+			controlBytes.clear();
+			growthLeft	= 0;
+			capacityVal = 0;
+			sizeVal		= 0;
+			data		= nullptr;
+		}
+	};
+
+	/**@}*/
+
+}
@@ -31,6 +31,8 @@
 
 #include <discordcoreapi/Utilities/RingBuffer.hpp>
 #include <discordcoreapi/Utilities/EventEntities.hpp>
+#include <discordcoreapi/Utilities/MappedFile.hpp>
+#include <discordcoreapi/Utilities/Metrics.hpp>
 
 #if !defined(OPENSSL_NO_DEPRECATED)
 	#define OPENSSL_NO_DEPRECATED
@@ -38,6 +40,10 @@
 
 #include <openssl/err.h>
 #include <openssl/ssl.h>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <deque>
 
 #if defined(_WIN32)
 	#if defined(EWOULDBLOCK)
@@ -301,12 +307,302 @@ namespace discord_core_api {
 			addrinfo* ptr{ &value };
 		};
 
+		/// @brief A single resolved socket address.
+		struct resolved_address {
+			sockaddr_storage address{};
+			socklen_t length{};
+			int32_t family{};
+		};
+
+		/// @brief A process-wide resolver, which caches lookups for a fixed time-to-live, coalesces concurrent lookups of the same name, and keeps handing out
+		/// expired entries while they are refreshed in the background - so that reconnect storms neither repeat lookups nor stall on a slow resolver. lookups run on
+		/// a small, fixed pool of threads, and failures are remembered for a shorter time-to-live, so that an unreachable resolver isn't hammered either.
+		class dns_resolver {
+		  public:
+			using address_list = jsonifier::vector<resolved_address>;
+
+			/// @brief Sets how long resolved addresses are considered fresh for.
+			/// @param timeToLiveNew the new time-to-live.
+			inline static void setTimeToLive(milliseconds timeToLiveNew) {
+				timeToLive.store(timeToLiveNew, std::memory_order_release);
+			}
+
+			/// @brief Sets how long a failed lookup is remembered for, before the name is looked up again.
+			/// @param timeToLiveNew the new time-to-live.
+			inline static void setNegativeTimeToLive(milliseconds timeToLiveNew) {
+				negativeTimeToLive.store(timeToLiveNew, std::memory_order_release);
+			}
+
+			/// @brief Resolves a host, interleaving the address families in the order that connection attempts should be made in (rfc 8305).
+			/// @param host the host to resolve.
+			/// @param port the port that will be connected to.
+			/// @param sockType the socket type, SOCK_STREAM or SOCK_DGRAM.
+			/// @param timeOut how long to wait for a lookup that isn't cached.
+			/// @return address_list the addresses, which is empty if the lookup failed or didn't finish in time.
+			inline static address_list resolve(jsonifier::string_view host, uint16_t port, int32_t sockType = SOCK_STREAM, milliseconds timeOut = milliseconds{ 10000 }) {
+				auto result = resolveAsync(host, port, sockType);
+				if (result.wait_for(timeOut) != std::future_status::ready) {
+					return {};
+				}
+				return result.get();
+			}
+
+			/// @brief Resolves a host without blocking - the returned future is already satisfied if the addresses were cached.
+			/// @param host the host to resolve.
+			/// @param port the port that will be connected to.
+			/// @param sockType the socket type, SOCK_STREAM or SOCK_DGRAM.
+			/// @return std::shared_future<address_list> a future for the addresses.
+			inline static std::shared_future<address_list> resolveAsync(jsonifier::string_view host, uint16_t port, int32_t sockType = SOCK_STREAM) {
+				jsonifier::string key{ static_cast<jsonifier::string>(host) + ":" + jsonifier::toString(port) + ":" + jsonifier::toString(sockType) };
+				std::unique_lock lock{ accessMutex };
+				// an expired failure is a miss, rather than something to keep handing out.
+				if (auto result = cache.find(key); result != cache.end() && (result->second.expiry > hrclock::now() || result->second.addresses.size() > 0)) {
+					if (result->second.expiry > hrclock::now()) {
+						metrics::dns.cacheHits.add();
+					} else {
+						metrics::dns.staleHits.add();
+						if (!inFlight.contains(key)) {
+							launchLookup(key, static_cast<jsonifier::string>(host), port, sockType);
+						}
+					}
+					std::promise<address_list> promise{};
+					promise.set_value(result->second.addresses);
+					return promise.get_future().share();
+				}
+				if (auto result = inFlight.find(key); result != inFlight.end()) {
+					return result->second;
+				}
+				return launchLookup(key, static_cast<jsonifier::string>(host), port, sockType);
+			}
+
+		  protected:
+			struct cache_entry {
+				hrclock::time_point expiry{};
+				address_list addresses{};
+			};
+
+			inline static constexpr uint64_t workerCount{ 4 };
+
+			inline static unordered_map<jsonifier::string, std::shared_future<address_list>> inFlight{};
+			inline static std::atomic<milliseconds> negativeTimeToLive{ milliseconds{ 5000 } };
+			inline static std::atomic<milliseconds> timeToLive{ milliseconds{ 60000 } };
+			inline static unordered_map<jsonifier::string, cache_entry> cache{};
+			inline static std::deque<std::function<void()>> lookups{};
+			inline static std::condition_variable_any lookupsCondition{};
+			inline static std::mutex lookupsMutex{};
+			inline static std::mutex accessMutex{};
+			inline static jsonifier::vector<std::jthread> workers{};
+
+			/// @brief Queues a lookup onto the resolver's threads, starting them on first use - must be called with the access mutex held.
+			inline static std::shared_future<address_list> launchLookup(const jsonifier::string& key, jsonifier::string host, uint16_t port, int32_t sockType) {
+				auto promise = std::make_shared<std::promise<address_list>>();
+				std::shared_future<address_list> returnValue{ promise->get_future().share() };
+				inFlight[key] = returnValue;
+				std::unique_lock lock{ lookupsMutex };
+				lookups.emplace_back([=]() {
+					auto addresses = lookup(host, port, sockType);
+					{
+						std::unique_lock lockNew{ accessMutex };
+						cache[key] = cache_entry{ hrclock::now() + (addresses.size() > 0 ? timeToLive : negativeTimeToLive).load(std::memory_order_acquire), addresses };
+						inFlight.erase(key);
+					}
+					promise->set_value(std::move(addresses));
+				});
+				if (workers.size() == 0) {
+					for (uint64_t x = 0; x < workerCount; ++x) {
+						workers.emplace_back([](std::stop_token token) {
+							runLookups(token);
+						});
+					}
+				}
+				lock.unlock();
+				lookupsCondition.notify_one();
+				return returnValue;
+			}
+
+			inline static void runLookups(std::stop_token token) {
+				while (!token.stop_requested()) {
+					std::function<void()> currentLookup{};
+					{
+						std::unique_lock lock{ lookupsMutex };
+						if (!lookupsCondition.wait(lock, token, [] {
+								return lookups.size() > 0;
+							})) {
+							return;
+						}
+						currentLookup = std::move(lookups.front());
+						lookups.pop_front();
+					}
+					currentLookup();
+				}
+			}
+
+			inline static address_list lookup(const jsonifier::string& host, uint16_t port, int32_t sockType) {
+				addrinfo hints{};
+				hints.ai_family	  = AF_UNSPEC;
+				hints.ai_socktype = sockType;
+				hints.ai_flags	  = AI_ADDRCONFIG;
+				addrinfo* results{};
+				auto startTime = hrclock::now();
+				if (getaddrinfo(host.data(), jsonifier::toString(port).data(), &hints, &results) || !results) {
+					message_printer::printError<print_message_type::general>(reportError("dns_resolver::lookup(), for: " + host));
+					metrics::dns.failedLookups.add();
+					return {};
+				}
+				metrics::dns.lookups.record(std::chrono::duration_cast<nanoseconds>(hrclock::now() - startTime));
+				address_list ipv6Addresses{}, ipv4Addresses{}, returnValue{};
+				for (auto current = results; current; current = current->ai_next) {
+					if (current->ai_family != AF_INET && current->ai_family != AF_INET6) {
+						continue;
+					}
+					resolved_address newAddress{};
+					std::memcpy(&newAddress.address, current->ai_addr, current->ai_addrlen);
+					newAddress.length = static_cast<socklen_t>(current->ai_addrlen);
+					newAddress.family = current->ai_family;
+					(current->ai_family == AF_INET6 ? ipv6Addresses : ipv4Addresses).emplace_back(newAddress);
+				}
+				// alternate the families, starting with whichever one the system resolver preferred.
+				bool preferIpv6{ ipv6Addresses.size() > 0 && (ipv4Addresses.size() == 0 || results->ai_family == AF_INET6) };
+				freeaddrinfo(results);
+				auto& firstFamily  = preferIpv6 ? ipv6Addresses : ipv4Addresses;
+				auto& secondFamily = preferIpv6 ? ipv4Addresses : ipv6Addresses;
+				for (uint64_t x = 0; x < std::max(firstFamily.size(), secondFamily.size()); ++x) {
+					if (x < firstFamily.size()) {
+						returnValue.emplace_back(firstFamily[x]);
+					}
+					if (x < secondFamily.size()) {
+						returnValue.emplace_back(secondFamily[x]);
+					}
+				}
+				return returnValue;
+			}
+		};
+
+		inline bool setSocketBlocking(SOCKET socket, bool blocking) {
+#if defined(_WIN32)
+			u_long value{ blocking ? 0ul : 1ul };
+			return ioctlsocket(socket, FIONBIO, &value) != SOCKET_ERROR;
+#else
+			auto flags = fcntl(socket, F_GETFL, 0);
+			return fcntl(socket, F_SETFL, blocking ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK)) != SOCKET_ERROR;
+#endif
+		}
+
+		/// @brief Connects a stream socket to the first of the given addresses that answers, starting a new attempt every attemptDelay while the earlier ones are
+		/// still pending (rfc 8305, "happy eyeballs").
+		/// @param addresses the addresses to attempt, in order.
+		/// @param attemptDelay how long to wait on an attempt before racing the next address against it.
+		/// @param timeOut how long to wait overall.
+		/// @return SOCKET the connected socket, in blocking mode, or INVALID_SOCKET.
+		inline SOCKET connectToFirstAvailable(const dns_resolver::address_list& addresses, milliseconds attemptDelay = milliseconds{ 250 },
+			milliseconds timeOut = milliseconds{ 10000 }) {
+			jsonifier::vector<pollfd> attempts{};
+			SOCKET returnValue{ static_cast<SOCKET>(INVALID_SOCKET) };
+			uint64_t nextAddress{};
+			auto startTime = hrclock::now();
+			while (returnValue == static_cast<SOCKET>(INVALID_SOCKET) && hrclock::now() - startTime < timeOut) {
+				if (nextAddress < addresses.size()) {
+					auto& address	 = addresses[nextAddress++];
+					SOCKET newSocket = ::socket(address.family, SOCK_STREAM, IPPROTO_TCP);
+					if (isValidSocket(newSocket) && setSocketBlocking(newSocket, false)) {
+						if (::connect(newSocket, reinterpret_cast<const sockaddr*>(&address.address), static_cast<int32_t>(address.length)) == 0) {
+							returnValue = newSocket;
+							break;
+						} else if (errno == EINPROGRESS || errno == EWOULDBLOCK) {
+							pollfd newAttempt{};
+							newAttempt.fd	  = newSocket;
+							newAttempt.events = POLLOUT;
+							attempts.emplace_back(newAttempt);
+						} else {
+							close(newSocket);
+						}
+					} else if (isValidSocket(newSocket)) {
+						close(newSocket);
+					}
+				}
+				if (attempts.size() == 0) {
+					if (nextAddress >= addresses.size()) {
+						break;
+					}
+					continue;
+				}
+				auto remainingTime = std::chrono::duration_cast<milliseconds>(timeOut - (hrclock::now() - startTime));
+				auto waitTime	   = nextAddress < addresses.size() ? std::min(attemptDelay, remainingTime) : remainingTime;
+				if (poll(attempts.data(), static_cast<u_long>(attempts.size()), static_cast<int32_t>(std::max(waitTime.count(), int64_t{ 0 }))) == SOCKET_ERROR) {
+					break;
+				}
+				for (uint64_t x = 0; x < attempts.size();) {
+					if (attempts[x].revents == 0) {
+						++x;
+						continue;
+					}
+					int32_t error{};
+					socklen_t errorSize{ sizeof(error) };
+					if (getsockopt(attempts[x].fd, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &errorSize) == 0 && error == 0 &&
+						!(attempts[x].revents & (POLLERR | POLLHUP | POLLNVAL))) {
+						returnValue = attempts[x].fd;
+						attempts.erase(attempts.begin() + static_cast<int64_t>(x));
+						break;
+					}
+					close(attempts[x].fd);
+					attempts.erase(attempts.begin() + static_cast<int64_t>(x));
+				}
+			}
+			for (auto& value: attempts) {
+				close(value.fd);
+			}
+			if (returnValue != static_cast<SOCKET>(INVALID_SOCKET)) {
+				metrics::dns.connects.record(std::chrono::duration_cast<nanoseconds>(hrclock::now() - startTime));
+				if (!setSocketBlocking(returnValue, true)) {
+					close(returnValue);
+					return static_cast<SOCKET>(INVALID_SOCKET);
+				}
+			}
+			return returnValue;
+		}
+
+		struct ssl_session_wrapper {
+			struct ssl_session_deleter {
+				inline void operator()(SSL_SESSION* other) {
+					if (other) {
+						SSL_SESSION_free(other);
+						other = nullptr;
+					}
+				}
+			};
+
+			inline ssl_session_wrapper() = default;
+
+			inline ssl_session_wrapper& operator=(ssl_session_wrapper&& other) noexcept {
+				ptr = std::move(other.ptr);
+				return *this;
+			}
+
+			inline ssl_session_wrapper(ssl_session_wrapper&& other) noexcept {
+				*this = std::move(other);
+			}
+
+			inline ssl_session_wrapper(SSL_SESSION* other) {
+				ptr.reset(other);
+			}
+
+			inline operator SSL_SESSION*() {
+				return ptr.get();
+			}
+
+		  protected:
+			unique_ptr<SSL_SESSION, ssl_session_deleter> ptr{};
+		};
+
 		class ssl_context_holder {
 		  public:
 			inline static ssl_ctx_wrapper context{};
 			inline static std::mutex accessMutex{};
 
-			inline static bool initialize() {
+			/// @brief Creates the shared context that every tls connection is made from.
+			/// @param enableKernelTls whether or not to hand record encryption off to the kernel, where it's supported.
+			/// @return bool whether or not the context was created successfully.
+			inline static bool initialize(bool enableKernelTls = false) {
 				if (ssl_context_holder::context = SSL_CTX_new(TLS_client_method()); !ssl_context_holder::context) {
 					return false;
 				}
@@ -315,14 +611,86 @@ namespace discord_core_api {
 					return false;
 				}
 
+				// we keep the sessions ourselves, keyed by host, so that every connection to the same host can resume them.
+				SSL_CTX_set_session_cache_mode(ssl_context_holder::context, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+				SSL_CTX_sess_set_new_cb(ssl_context_holder::context, &ssl_context_holder::storeSession);
+
 #if defined(SSL_OP_IGNORE_UNEXPECTED_EOF)
 				auto originalOptions{ SSL_CTX_get_options(ssl_context_holder::context) | SSL_OP_IGNORE_UNEXPECTED_EOF };
 				if (SSL_CTX_set_options(ssl_context_holder::context, SSL_OP_IGNORE_UNEXPECTED_EOF) != originalOptions) {
 					return false;
 				}
 #endif
+				if (enableKernelTls) {
+					if (isKernelTlsAvailable()) {
+#if defined(SSL_OP_ENABLE_KTLS)
+						// OpenSSL only attempts the handoff after each handshake, and keeps going in user space if the kernel declines the cipher.
+						SSL_CTX_set_options(ssl_context_holder::context, SSL_OP_ENABLE_KTLS);
+#endif
+					} else {
+						message_printer::printError<print_message_type::general>("ssl_context_holder::initialize() error: kernel tls is unavailable, falling back to user-space tls.");
+					}
+				}
 				return true;
 			}
+
+			/// @brief Checks whether this build of OpenSSL, and the running kernel, can offload tls records.
+			/// @return bool true if kernel tls can be used.
+			inline static bool isKernelTlsAvailable() {
+#if defined(__linux__) && defined(SSL_OP_ENABLE_KTLS)
+	#if !defined(TCP_ULP)
+		#define TCP_ULP 31
+	#endif
+				// attaching the "tls" upper-layer protocol to an unconnected socket fails with ENOTCONN if the kernel supports it (loading the module as
+				// needed), and with ENOENT if it doesn't.
+				auto probeSocket = ::socket(AF_INET, SOCK_STREAM, 0);
+				if (probeSocket == -1) {
+					return false;
+				}
+				auto result		= setsockopt(probeSocket, SOL_TCP, TCP_ULP, "tls", sizeof("tls"));
+				auto errorValue = errno;
+				::close(probeSocket);
+				return result == 0 || errorValue == ENOTCONN;
+#else
+				return false;
+#endif
+			}
+
+			/// @brief Attaches the cached session for a host to a new connection, if there is one.
+			/// @param ssl the connection that is about to perform its handshake.
+			/// @param host the host that it is connecting to.
+			inline static void applySession(SSL* ssl, jsonifier::string_view host) {
+				std::unique_lock lock{ sessionMutex };
+				if (auto result = sessions.find(static_cast<jsonifier::string>(host)); result != sessions.end()) {
+					SSL_SESSION* session{ result->second };
+					if (!SSL_SESSION_is_resumable(session)) {
+						sessions.erase(result);
+						return;
+					}
+					SSL_set_session(ssl, session);
+					// tls 1.3 tickets are meant to be used only once - fresh ones arrive with every handshake.
+					if (SSL_SESSION_get_protocol_version(session) == TLS1_3_VERSION) {
+						sessions.erase(result);
+					}
+				}
+			}
+
+		  protected:
+			inline static unordered_map<jsonifier::string, ssl_session_wrapper> sessions{};
+			inline static std::mutex sessionMutex{};
+
+			/// @brief Called by OpenSSL whenever a server hands us a new session or session ticket.
+			inline static int32_t storeSession(SSL* ssl, SSL_SESSION* session) {
+				auto host = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
+				if (!host || !SSL_SESSION_is_resumable(session)) {
+					return 0;
+				}
+				std::unique_lock lock{ sessionMutex };
+				sessions[jsonifier::string{ host }] = ssl_session_wrapper{ session };
+				metrics::tls.sessionsCached.add();
+				// returning 1 keeps the reference that OpenSSL handed us, which the wrapper now owns.
+				return 1;
+			}
 		};
 
 		template<typename value_type> class ssl_data_interface {
@@ -343,7 +711,7 @@ namespace discord_core_api {
 
 			template<typename value_type_new> inline void writeData(jsonifier::string_view_base<value_type_new> dataToWrite, bool priority) {
 				if (static_cast<value_type*>(this)->areWeStillConnected()) {
-					if (dataToWrite.size() > 0 && static_cast<value_type*>(this)->ssl) {
+					if (dataToWrite.size() > 0 && (static_cast<value_type*>(this)->ssl || !static_cast<value_type*>(this)->isItTls)) {
 						if (priority && dataToWrite.size() < maxBufferSize) {
 							outputBuffer.clear();
 							outputBuffer.writeData(dataToWrite.data(), dataToWrite.size());
@@ -397,6 +765,8 @@ namespace discord_core_api {
 			bool writeWantRead{};
 			bool readWantWrite{};
 			bool readWantRead{};
+			bool isItKernelTls{};
+			bool isItTls{ true };
 			ssl_wrapper ssl{};
 
 			tcp_connection& operator=(tcp_connection&& other)	   = default;
@@ -404,8 +774,15 @@ namespace discord_core_api {
 			tcp_connection& operator=(const tcp_connection& other) = default;
 			tcp_connection(const tcp_connection& other)			   = default;
 
-			inline tcp_connection(const jsonifier::string& baseUrlNew, const uint16_t portNew) {
+			/// @brief Resolves and connects to a host.
+			/// @param baseUrlNew the url or host to connect to.
+			/// @param portNew the port to connect to.
+			/// @param isItTlsNew whether to negotiate tls over the connection.
+			/// @param resolveTimeOut how long to wait on a lookup that isn't cached - at zero, a pending lookup fails the connection straight away, and the
+			/// caller's next reconnect attempt picks up its result.
+			inline tcp_connection(const jsonifier::string& baseUrlNew, const uint16_t portNew, bool isItTlsNew = true, milliseconds resolveTimeOut = milliseconds{ 10000 }) {
 				jsonifier::string addressString{};
+				isItTls = isItTlsNew;
 				auto httpsFind = baseUrlNew.find("https://");
 				auto comFind   = baseUrlNew.find(".com");
 				auto orgFind   = baseUrlNew.find(".org");
@@ -418,32 +795,40 @@ namespace discord_core_api {
 				} else {
 					addressString = baseUrlNew;
 				}
-				addrinfo_wrapper hints{}, address{};
-				hints->ai_family   = AF_INET;
-				hints->ai_socktype = SOCK_STREAM;
-				hints->ai_protocol = IPPROTO_TCP;
-
-				if (getaddrinfo(addressString.data(), jsonifier::toString(portNew).data(), hints, address)) {
-					message_printer::printError<print_message_type::general>(reportError("tcp_connection::getaddrinfo(), to: " + baseUrlNew));
+				auto pendingAddresses = dns_resolver::resolveAsync(addressString, portNew);
+				if (pendingAddresses.wait_for(resolveTimeOut) != std::future_status::ready) {
+					message_printer::printError<print_message_type::general>("tcp_connection::dns_resolver::resolveAsync(), to: " + baseUrlNew + ", still resolving.");
 					currentStatus = connection_status::CONNECTION_Error;
 					socket		  = INVALID_SOCKET;
 					return;
 				}
-
-				if (socket = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol); !isValidSocket(socket.operator SOCKET())) {
-					message_printer::printError<print_message_type::general>(reportError("tcp_connection::SOCKET(), to: " + baseUrlNew));
+				auto addresses = pendingAddresses.get();
+				if (addresses.size() == 0) {
+					message_printer::printError<print_message_type::general>("tcp_connection::dns_resolver::resolve(), to: " + baseUrlNew + ", failed to resolve.");
 					currentStatus = connection_status::CONNECTION_Error;
 					socket		  = INVALID_SOCKET;
 					return;
 				}
 
-				if (::connect(socket, address->ai_addr, static_cast<int32_t>(address->ai_addrlen)) == SOCKET_ERROR) {
-					message_printer::printError<print_message_type::general>(reportError("tcp_connection::connect(), to: " + baseUrlNew));
+				if (socket = connectToFirstAvailable(addresses); !isValidSocket(socket.operator SOCKET())) {
+					message_printer::printError<print_message_type::general>(reportError("tcp_connection::connectToFirstAvailable(), to: " + baseUrlNew));
 					currentStatus = connection_status::CONNECTION_Error;
 					socket		  = INVALID_SOCKET;
 					return;
 				}
 
+				if (!isItTls) {
+					// plain-text connections are only ever made to local peers, such as a rest proxy.
+					if (!setSocketBlocking(socket, false)) {
+						message_printer::printError<print_message_type::general>(reportError("tcp_connection::connect::setSocketBlocking(), to: " + baseUrlNew));
+						currentStatus = connection_status::CONNECTION_Error;
+						socket		  = INVALID_SOCKET;
+						return;
+					}
+					currentStatus = connection_status::NO_Error;
+					return;
+				}
+
 				std::unique_lock lock{ ssl_context_holder::accessMutex };
 				if (ssl = SSL_new(ssl_context_holder::context); !ssl) {
 					message_printer::printError<print_message_type::general>(
@@ -474,14 +859,30 @@ namespace discord_core_api {
 					return;
 				}
 
+				ssl_context_holder::applySession(ssl, addressString);
+
+				auto handshakeStartTime = hrclock::now();
 				if (auto result{ SSL_connect(ssl) }; result != 1) {
 					message_printer::printError<print_message_type::general>(reportSSLError("tcp_connection::connect::SSL_connect(), to: " + baseUrlNew) + "\n" +
 						reportError("tcp_connection::connect::SSL_connect(), to: " + baseUrlNew));
+					metrics::tls.failedHandshakes.add();
 					currentStatus = connection_status::CONNECTION_Error;
 					socket		  = INVALID_SOCKET;
 					ssl			  = nullptr;
 					return;
 				}
+				auto handshakeTime = std::chrono::duration_cast<nanoseconds>(hrclock::now() - handshakeStartTime);
+				if (SSL_session_reused(ssl)) {
+					metrics::tls.resumedHandshakes.record(handshakeTime);
+				} else {
+					metrics::tls.fullHandshakes.record(handshakeTime);
+				}
+#if defined(SSL_OP_ENABLE_KTLS)
+				if (BIO_get_ktls_send(SSL_get_wbio(ssl))) {
+					isItKernelTls = true;
+					metrics::tls.kernelTlsConnections.add();
+				}
+#endif
 
 #if defined(_WIN32)
 				u_long value02{ 1 };
@@ -572,8 +973,119 @@ namespace discord_core_api {
 				return currentStatus;
 			}
 
+			/// @brief Writes a file straight from the page cache to the socket, through SSL_sendfile, when the kernel has taken over this connection's
+			/// record layer - and otherwise writes the file's mapped contents, as streamData() does.
+			/// @param file the file to be written.
+			/// @param waitTimeInMs how long to wait for the socket to become ready, each time that it isn't.
+			/// @return bool whether or not the entire file was written.
+			inline bool streamFile(const mapped_file& file, int32_t waitTimeInMs = 10000) {
+#if defined(SSL_OP_ENABLE_KTLS)
+				if (isItTls && isItKernelTls && file.getFileDescriptor() != -1) {
+					uint64_t writtenBytes{};
+					while (writtenBytes < file.size()) {
+						if (!areWeStillConnected()) {
+							return false;
+						}
+						auto result{ SSL_sendfile(ssl, file.getFileDescriptor(), static_cast<off_t>(writtenBytes), file.size() - writtenBytes, 0) };
+						if (result > 0) {
+							writtenBytes += static_cast<uint64_t>(result);
+							metrics::tls.sendfileBytes.add(static_cast<uint64_t>(result));
+							continue;
+						}
+						int16_t eventsToWaitFor{};
+						switch (SSL_get_error(ssl, static_cast<int32_t>(result))) {
+							case SSL_ERROR_WANT_WRITE: {
+								eventsToWaitFor = POLLOUT;
+								break;
+							}
+							case SSL_ERROR_WANT_READ: {
+								eventsToWaitFor = POLLIN;
+								break;
+							}
+							default: {
+								message_printer::printError<print_message_type::general>(reportSSLError("tcp_connection::streamFile()") + "\n" + reportError("tcp_connection::streamFile()"));
+								currentStatus = connection_status::WRITE_Error;
+								return false;
+							}
+						}
+						pollfd fdEvent{};
+						fdEvent.fd	   = socket;
+						fdEvent.events = eventsToWaitFor;
+						if (poll(&fdEvent, 1, waitTimeInMs) <= 0) {
+							currentStatus = connection_status::WRITE_Error;
+							return false;
+						}
+					}
+					return true;
+				}
+#endif
+				return streamData(file.view(), waitTimeInMs);
+			}
+
+			/// @brief Writes data straight to the socket, bypassing the output buffer, and waits out any backpressure along the way.
+			/// @param dataToWrite the data to be written, which only needs to stay alive for the duration of the call.
+			/// @param waitTimeInMs how long to wait for the socket to become ready, each time that it isn't.
+			/// @return bool whether or not all of the data was written.
+			inline bool streamData(jsonifier::string_view dataToWrite, int32_t waitTimeInMs = 10000) {
+				while (dataToWrite.size() > 0) {
+					if (!areWeStillConnected()) {
+						return false;
+					}
+					// one tls record's worth at a time, and a failed SSL_write has to be retried with the same arguments.
+					uint64_t bytesToWrite{ std::min(dataToWrite.size(), static_cast<uint64_t>(static_cast<value_type*>(this)->maxBufferSize)) };
+					uint64_t writtenBytes{};
+					int16_t eventsToWaitFor{};
+					if (!isItTls) {
+						auto result{ ::send(socket, dataToWrite.data(), static_cast<int32_t>(bytesToWrite), 0) };
+						if (result == SOCKET_ERROR) {
+							if (errno != EWOULDBLOCK) {
+								currentStatus = connection_status::WRITE_Error;
+								return false;
+							}
+							eventsToWaitFor = POLLOUT;
+						} else {
+							writtenBytes = static_cast<uint64_t>(result);
+						}
+					} else {
+						size_t writtenBytesNew{};
+						auto returnData{ SSL_write_ex(ssl, dataToWrite.data(), bytesToWrite, &writtenBytesNew) };
+						switch (SSL_get_error(ssl, returnData)) {
+							case SSL_ERROR_NONE: {
+								writtenBytes = writtenBytesNew;
+								break;
+							}
+							case SSL_ERROR_WANT_READ: {
+								eventsToWaitFor = POLLIN;
+								break;
+							}
+							case SSL_ERROR_WANT_WRITE: {
+								eventsToWaitFor = POLLOUT;
+								break;
+							}
+							default: {
+								message_printer::printError<print_message_type::general>(reportSSLError("tcp_connection::streamData()") + "\n" + reportError("tcp_connection::streamData()"));
+								currentStatus = connection_status::WRITE_Error;
+								return false;
+							}
+						}
+					}
+					if (eventsToWaitFor != 0) {
+						pollfd fdEvent{};
+						fdEvent.fd	   = socket;
+						fdEvent.events = eventsToWaitFor;
+						if (poll(&fdEvent, 1, waitTimeInMs) <= 0) {
+							currentStatus = connection_status::WRITE_Error;
+							return false;
+						}
+						continue;
+					}
+					dataToWrite = jsonifier::string_view{ dataToWrite.data() + writtenBytes, dataToWrite.size() - writtenBytes };
+				}
+				return true;
+			}
+
 			inline bool areWeStillConnected() {
-				if (socket.operator bool() && socket.operator SOCKET() != INVALID_SOCKET && currentStatus == connection_status::NO_Error && ssl.operator bool()) {
+				if (socket.operator bool() && socket.operator SOCKET() != INVALID_SOCKET && currentStatus == connection_status::NO_Error && (ssl.operator bool() || !isItTls)) {
 					pollfd fdEvent = {};
 					fdEvent.fd	   = socket;
 					fdEvent.events = POLLOUT;
@@ -594,6 +1106,9 @@ namespace discord_core_api {
 				writeWantWrite = false;
 				if (static_cast<value_type*>(this)->outputBuffer.getUsedSpace() > 0 && areWeStillConnected()) {
 					uint64_t bytesToWrite{ static_cast<value_type*>(this)->outputBuffer.getCurrentTail()->getUsedSpace() };
+					if (!isItTls) {
+						return processPlainWriteData(bytesToWrite);
+					}
 
 					size_t writtenBytes{};
 					auto returnData{ SSL_write_ex(ssl, static_cast<value_type*>(this)->outputBuffer.readData().data(), bytesToWrite, &writtenBytes) };
@@ -627,6 +1142,9 @@ namespace discord_core_api {
 				readWantRead  = false;
 				readWantWrite = false;
 				if (!static_cast<value_type*>(this)->inputBuffer.isItFull() && areWeStillConnected()) {
+					if (!isItTls) {
+						return processPlainReadData();
+					}
 					do {
 						size_t readBytes{};
 						uint64_t bytesToRead{ static_cast<value_type*>(this)->maxBufferSize };
@@ -765,6 +1283,51 @@ namespace discord_core_api {
 
 		  protected:
 			inline tcp_connection() = default;
+
+			inline bool processPlainWriteData(uint64_t bytesToWrite) {
+				// the data has already left the ring buffer at this point, so a partial write has to be finished here.
+				auto dataToWrite = static_cast<value_type*>(this)->outputBuffer.readData();
+				uint64_t writtenBytes{};
+				while (writtenBytes < bytesToWrite) {
+					auto result{ ::send(socket, reinterpret_cast<const char*>(dataToWrite.data() + writtenBytes), static_cast<int32_t>(bytesToWrite - writtenBytes), 0) };
+					if (result == SOCKET_ERROR) {
+						if (errno != EWOULDBLOCK) {
+							return false;
+						}
+						pollfd fdEvent{};
+						fdEvent.fd	   = socket;
+						fdEvent.events = POLLOUT;
+						if (poll(&fdEvent, 1, 1000) <= 0) {
+							return false;
+						}
+						continue;
+					}
+					writtenBytes += static_cast<uint64_t>(result);
+				}
+				return true;
+			}
+
+			inline bool processPlainReadData() {
+				while (!static_cast<value_type*>(this)->inputBuffer.isItFull()) {
+					auto readBytes{ ::recv(socket, reinterpret_cast<char*>(static_cast<value_type*>(this)->inputBuffer.getCurrentHead()->getCurrentHead()),
+						static_cast<int32_t>(static_cast<value_type*>(this)->maxBufferSize), 0) };
+					if (readBytes > 0) {
+						static_cast<value_type*>(this)->inputBuffer.getCurrentHead()->modifyReadOrWritePosition(ring_buffer_access_type::write, static_cast<uint64_t>(readBytes));
+						static_cast<value_type*>(this)->inputBuffer.modifyReadOrWritePosition(ring_buffer_access_type::write, 1);
+						static_cast<value_type*>(this)->bytesRead += readBytes;
+						static_cast<value_type*>(this)->handleBuffer();
+					} else if (readBytes == 0) {
+						socket = INVALID_SOCKET;
+						return true;
+					} else if (errno == EWOULDBLOCK) {
+						readWantRead = true;
+						return true;
+					} else {
+						return false;
+					}
+				}
+				return true;
+			}
 		};
 	}
 
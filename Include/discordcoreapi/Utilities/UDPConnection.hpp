@@ -65,18 +65,61 @@ namespace discord_core_api {
 				*this = std::move(other);
 			};
 
+			/// @brief Resolves and connects (or, as a server, binds) a udp socket.
+			/// @param baseUrlNew the host to connect to.
+			/// @param portNew the port to connect to, or to listen on.
+			/// @param streamTypeNew the role of the connection.
+			/// @param token the handle of the co_routine that is connecting, whose stop requests cut the resolution short.
+			/// @param resolveTimeOut how long to wait on a lookup that isn't cached.
 			inline udp_connection(const jsonifier::string& baseUrlNew, uint16_t portNew, stream_type streamTypeNew,
-				std::coroutine_handle<discord_core_api::co_routine<void, false>::promise_type>* token) {
+				std::coroutine_handle<discord_core_api::co_routine<void, false>::promise_type>* token, milliseconds resolveTimeOut = milliseconds{ 10000 }) {
 				resampleVector.resize(maxBufferSize);
 				streamType = streamTypeNew;
 				baseUrl	   = baseUrlNew;
 				port	   = portNew;
+				// resolve through the shared cache, and only hand getaddrinfo() the resulting numeric address - the socket then takes that address's family. the
+				// lookup is waited on in slices, so that a stop request doesn't have to sit out a slow resolver.
+				int32_t family{ AF_INET6 };
+				jsonifier::string numericHost{};
+				if (streamType != stream_type::server) {
+					auto pendingAddresses = dns_resolver::resolveAsync(baseUrlNew, portNew, SOCK_DGRAM);
+					auto startTime		  = hrclock::now();
+					while (pendingAddresses.wait_for(100ms) != std::future_status::ready) {
+						if (token->promise().stopRequested() || hrclock::now() - startTime >= resolveTimeOut) {
+							message_printer::printError<print_message_type::websocket>("connect::dns_resolver::resolveAsync(), to: " + baseUrlNew + ", still resolving.");
+							currentStatus = connection_status::CONNECTION_Error;
+							socket		  = INVALID_SOCKET;
+							return;
+						}
+					}
+					for (auto& value: pendingAddresses.get()) {
+						if (value.family == AF_INET) {
+							numericHost.resize(INET_ADDRSTRLEN);
+							inet_ntop(AF_INET, &reinterpret_cast<const sockaddr_in*>(&value.address)->sin_addr, numericHost.data(), INET_ADDRSTRLEN);
+						} else if (value.family == AF_INET6) {
+							numericHost.resize(INET6_ADDRSTRLEN);
+							inet_ntop(AF_INET6, &reinterpret_cast<const sockaddr_in6*>(&value.address)->sin6_addr, numericHost.data(), INET6_ADDRSTRLEN);
+						} else {
+							continue;
+						}
+						numericHost.resize(std::strlen(numericHost.data()));
+						family = value.family;
+						break;
+					}
+					if (numericHost.empty()) {
+						message_printer::printError<print_message_type::websocket>("connect::dns_resolver::resolve(), to: " + baseUrlNew + ", failed to resolve.");
+						currentStatus = connection_status::CONNECTION_Error;
+						socket		  = INVALID_SOCKET;
+						return;
+					}
+				}
 				addrinfo_wrapper hints{};
-				hints->ai_family   = AF_INET;
+				hints->ai_family   = family;
 				hints->ai_socktype = SOCK_DGRAM;
 				hints->ai_protocol = IPPROTO_UDP;
+				hints->ai_flags	   = streamType == stream_type::server ? AI_PASSIVE : AI_NUMERICHOST;
 
-				if (socket = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP); socket.operator SOCKET() == INVALID_SOCKET) {
+				if (socket = ::socket(family, SOCK_DGRAM, IPPROTO_UDP); socket.operator SOCKET() == INVALID_SOCKET) {
 					message_printer::printError<print_message_type::websocket>(reportError("connect::SOCKET(), to: " + baseUrlNew));
 					currentStatus = connection_status::CONNECTION_Error;
 					socket		  = INVALID_SOCKET;
@@ -91,6 +134,17 @@ namespace discord_core_api {
 					return;
 				}
 
+				if (streamType == stream_type::server) {
+					// the server listens on both families, so that its clients can reach it through whichever one they resolve it to.
+					int32_t v6Only{};
+					if (setsockopt(socket, IPPROTO_IPV6, IPV6_V6ONLY, reinterpret_cast<const char*>(&v6Only), sizeof(v6Only)) < 0) {
+						message_printer::printError<print_message_type::websocket>(reportError("connect::setsockopt(), to: " + baseUrlNew));
+						currentStatus = connection_status::CONNECTION_Error;
+						socket		  = INVALID_SOCKET;
+						return;
+					}
+				}
+
 #if defined _WIN32
 				u_long value02{ 1 };
 				if (ioctlsocket(socket, FIONBIO, &value02)) {
@@ -109,7 +163,7 @@ namespace discord_core_api {
 #endif
 
 				if (streamType == stream_type::none) {
-					if (getaddrinfo(baseUrlNew.data(), jsonifier::toString(portNew).data(), hints, address)) {
+					if (getaddrinfo(numericHost.data(), jsonifier::toString(portNew).data(), hints, address)) {
 						message_printer::printError<print_message_type::websocket>(reportError("connect::getaddrinfo(), to: " + baseUrlNew));
 						currentStatus = connection_status::CONNECTION_Error;
 						socket		  = INVALID_SOCKET;
@@ -122,7 +176,7 @@ namespace discord_core_api {
 						return;
 					}
 				} else if (streamType == stream_type::client) {
-					if (getaddrinfo(baseUrlNew.data(), jsonifier::toString(portNew).data(), hints, address)) {
+					if (getaddrinfo(numericHost.data(), jsonifier::toString(portNew).data(), hints, address)) {
 						message_printer::printError<print_message_type::websocket>(reportError("connect::getaddrinfo(), to: " + baseUrlNew));
 						currentStatus = connection_status::CONNECTION_Error;
 						socket		  = INVALID_SOCKET;
@@ -143,7 +197,6 @@ namespace discord_core_api {
 						std::this_thread::sleep_for(1ns);
 					}
 				} else {
-					hints->ai_flags = AI_PASSIVE;
 					if (getaddrinfo(nullptr, jsonifier::toString(portNew).data(), hints, address)) {
 						message_printer::printError<print_message_type::websocket>(reportError("connect::getaddrinfo(), to: " + baseUrlNew));
 						currentStatus = connection_status::CONNECTION_Error;
@@ -29,6 +29,7 @@
 /// \file unordered_map.hpp
 #pragma once
 
+#include <discordcoreapi/Utilities/SwissTable.hpp>
 #include <discordcoreapi/Utilities/Hash.hpp>
 #include <discordcoreapi/Utilities/UniquePtr.hpp>
 
@@ -359,4 +360,50 @@ namespace discord_core_api {
 	};
 
 
-}
\ No newline at end of file
+
+	/// @brief An unordered_map keyed by ids, stored in a swiss_table rather than in the linearly-probed table above.
+	template<swiss_key_t key_type_new, typename value_type_new> class unordered_map<key_type_new, value_type_new>
+		: public swiss_table<key_type_new, std::pair<key_type_new, value_type_new>> {
+	  public:
+		using base_type		 = swiss_table<key_type_new, std::pair<key_type_new, value_type_new>>;
+		using key_type		 = key_type_new;
+		using value_type	 = std::pair<key_type_new, value_type_new>;
+		using mapped_type	 = value_type_new;
+		using size_type		 = typename base_type::size_type;
+		using iterator		 = typename base_type::iterator;
+		using const_iterator = typename base_type::const_iterator;
+
+		inline unordered_map(){};
+
+		inline unordered_map(std::initializer_list<value_type> list) {
+			this->reserve(list.size());
+			for (auto& value: list) {
+				emplace(value.first, value.second);
+			}
+		};
+
+		template<typename... Args> iterator emplace(Args&&... value) {
+			return this->emplaceInternal(std::forward<Args>(value)...);
+		}
+
+		template<typename key_type_newer> inline mapped_type& operator[](key_type_newer&& key) {
+			return this->emplaceInternal(std::forward<key_type_newer>(key))->second;
+		}
+
+		template<typename key_type_newer> inline const mapped_type& at(key_type_newer&& key) const {
+			auto iter = this->find(std::forward<key_type_newer>(key));
+			if (iter == this->end()) {
+				throw std::runtime_error{ "Sorry, but an object by that key doesn't exist in this map." };
+			}
+			return iter->second;
+		}
+
+		template<typename key_type_newer> inline mapped_type& at(key_type_newer&& key) {
+			auto iter = this->find(std::forward<key_type_newer>(key));
+			if (iter == this->end()) {
+				throw std::runtime_error{ "Sorry, but an object by that key doesn't exist in this map." };
+			}
+			return iter->second;
+		}
+	};
+}
@@ -29,6 +29,7 @@
 /// \file UnorderedSet.hpp
 #pragma once
 
+#include <discordcoreapi/Utilities/SwissTable.hpp>
 #include <discordcoreapi/Utilities/Hash.hpp>
 
 namespace discord_core_api {
@@ -354,4 +355,38 @@ namespace discord_core_api {
 			}
 		}
 	};
+
+	/// @brief An unordered_set of ids, stored in a swiss_table rather than in the linearly-probed table above.
+	template<swiss_key_t value_type_new> class unordered_set<value_type_new> : public swiss_table<value_type_new, value_type_new> {
+	  public:
+		using base_type		 = swiss_table<value_type_new, value_type_new>;
+		using key_type		 = value_type_new;
+		using value_type	 = value_type_new;
+		using mapped_type	 = value_type;
+		using const_reference = const value_type&;
+		using size_type		 = typename base_type::size_type;
+		using iterator		 = typename base_type::iterator;
+		using const_iterator = typename base_type::const_iterator;
+
+		inline unordered_set(){};
+
+		inline unordered_set(std::initializer_list<value_type> list) {
+			this->reserve(list.size());
+			for (auto& value: list) {
+				emplace(value);
+			}
+		};
+
+		template<typename args> iterator emplace(args&& value) {
+			return this->emplaceInternal(std::forward<args>(value));
+		}
+
+		template<typename key_type_new> inline const_reference at(key_type_new&& key) const {
+			auto iter = this->find(std::forward<key_type_new>(key));
+			if (iter == this->end()) {
+				throw std::runtime_error{ "Sorry, but an object by that key doesn't exist in this map." };
+			}
+			return *iter;
+		}
+	};
 }
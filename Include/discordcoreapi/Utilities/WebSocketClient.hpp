@@ -32,6 +32,7 @@
 #include <discordcoreapi/Utilities/AudioDecoder.hpp>
 #include <discordcoreapi/FoundationEntities.hpp>
 #include <discordcoreapi/Utilities/EventEntities.hpp>
+#include <discordcoreapi/Utilities/EventQueue.hpp>
 #include <discordcoreapi/Utilities/TCPConnection.hpp>
 #include <discordcoreapi/Utilities/Etf.hpp>
 #include <thread>
@@ -288,6 +289,12 @@ namespace discord_core_api {
 			bool serverUpdateCollected{};
 			bool stateUpdateCollected{};
 			snowflake userId{};
+
+			/// @brief Parses a dispatched event into its data package and invokes its event - run on the event's ordered queue, rather than on the shard's thread.
+			/// @param eventType the type of the event, as collected by event_converter.
+			/// @param dataNew the event's payload.
+			/// @param onComplete invoked once the event's delegates have all finished, to release the queue's next event.
+			static void dispatchEvent(uint64_t eventType, jsonifier::string_view_base<uint8_t> dataNew, ordered_event_queue::completion_type onComplete);
 		};
 
 		class base_socket_agent {
@@ -302,7 +309,7 @@ namespace discord_core_api {
 			~base_socket_agent();
 
 		  protected:
-			unordered_map<uint64_t, websocket_client> shardMap{};
+			dense_map<uint64_t, websocket_client> shardMap{};
 			std::deque<connection_package> connections{};
 			std::atomic_bool* doWeQuit{};
 			std::jthread taskThread{};
@@ -0,0 +1,191 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// ZlibDecoder.hpp - Header for the gzip/deflate decoder class.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file ZlibDecoder.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/Base.hpp>
+#include <discordcoreapi/Utilities/UniquePtr.hpp>
+#include <zlib.h>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/**
+		 * \addtogroup discord_core_internal
+		 * @{
+		 */
+
+		/// @brief Content codings that can be decoded from an Https response body.
+		enum class content_encoding : uint8_t {
+			identity = 0,///< No encoding.
+			gzip	 = 1,///< Gzip (rfc 1952).
+			deflate	 = 2,///< Zlib-wrapped deflate (rfc 1950), with a fallback to raw deflate.
+		};
+
+		/// @brief A streaming wrapper class for the zlib inflater, which can be reset and re-used for every response on a given connection.
+		struct zlib_decoder_wrapper {
+			/// @brief Deleter for z_stream instances.
+			struct z_stream_deleter {
+				/// @brief Operator to destroy a z_stream instance.
+				/// @param other the z_stream pointer to be deleted.
+				inline void operator()(z_stream* other) {
+					if (other) {
+						inflateEnd(other);
+						delete other;
+						other = nullptr;
+					}
+				}
+			};
+
+			inline zlib_decoder_wrapper() = default;
+
+			/// @brief Prepares the decoder for a new response body.
+			/// @param encodingNew the content coding of the upcoming body.
+			/// @return true if the inflater was (re)initialized successfully.
+			inline bool begin(content_encoding encodingNew) {
+				encoding	 = encodingNew;
+				areWeDone	 = false;
+				didWeOutput	 = false;
+				isItRaw		 = false;
+				bytesIn		 = 0;
+				bytesOut	 = 0;
+				decodeTime	 = nanoseconds{};
+				if (encoding == content_encoding::identity) {
+					return true;
+				}
+				// 15 window bits, +16 for a gzip wrapper, otherwise a zlib wrapper.
+				return initialize(encoding == content_encoding::gzip ? 15 + 16 : 15);
+			}
+
+			/// @brief Decodes a section of the body and appends the decoded bytes to the output string.
+			/// @param dataToDecode the encoded bytes, as they were received.
+			/// @param outputBuffer the string to append the decoded data to.
+			/// @return true if decoding succeeded (or has already finished), false on a stream error.
+			template<typename value_type> inline bool decodeData(jsonifier::string_view_base<value_type> dataToDecode, jsonifier::string& outputBuffer) {
+				if (areWeDone || dataToDecode.size() == 0) {
+					return true;
+				}
+				auto startTime = hrclock::now();
+				bytesIn += dataToDecode.size();
+				ptr->next_in  = reinterpret_cast<Bytef*>(const_cast<std::remove_const_t<value_type>*>(dataToDecode.data()));
+				ptr->avail_in = static_cast<uInt>(dataToDecode.size());
+				while (ptr->avail_in > 0 && !areWeDone) {
+					ptr->next_out  = reinterpret_cast<Bytef*>(buffer.data());
+					ptr->avail_out = static_cast<uInt>(buffer.size());
+					auto result	   = inflate(ptr.get(), Z_NO_FLUSH);
+					if (result == Z_DATA_ERROR && encoding == content_encoding::deflate && !isItRaw && !didWeOutput && bytesIn == dataToDecode.size()) {
+						// some servers send raw deflate despite advertising the zlib wrapper - retry once without it.
+						isItRaw = true;
+						if (!initialize(-15)) {
+							return false;
+						}
+						ptr->next_in  = reinterpret_cast<Bytef*>(const_cast<std::remove_const_t<value_type>*>(dataToDecode.data()));
+						ptr->avail_in = static_cast<uInt>(dataToDecode.size());
+						continue;
+					}
+					if (result != Z_OK && result != Z_STREAM_END && result != Z_BUF_ERROR) {
+						message_printer::printError<print_message_type::https>("zlib_decoder_wrapper::decodeData() error: " +
+							jsonifier::string{ ptr->msg ? ptr->msg : "unknown zlib error" });
+						decodeTime += std::chrono::duration_cast<nanoseconds>(hrclock::now() - startTime);
+						return false;
+					}
+					uint64_t writtenBytes{ buffer.size() - ptr->avail_out };
+					if (writtenBytes > 0) {
+						outputBuffer += jsonifier::string_view{ buffer.data(), writtenBytes };
+						bytesOut += writtenBytes;
+						didWeOutput = true;
+					}
+					if (result == Z_STREAM_END) {
+						areWeDone = true;
+					} else if (result == Z_BUF_ERROR) {
+						break;
+					}
+				}
+				decodeTime += std::chrono::duration_cast<nanoseconds>(hrclock::now() - startTime);
+				return true;
+			}
+
+			/// @brief Whether or not the end of the compressed stream has been reached.
+			inline bool isItDone() const {
+				return areWeDone;
+			}
+
+			/// @brief The number of encoded bytes fed into the decoder since the last call to begin().
+			inline uint64_t getBytesIn() const {
+				return bytesIn;
+			}
+
+			/// @brief The number of decoded bytes produced since the last call to begin().
+			inline uint64_t getBytesOut() const {
+				return bytesOut;
+			}
+
+			/// @brief The time spent inside of inflate() since the last call to begin().
+			inline nanoseconds getDecodeTime() const {
+				return decodeTime;
+			}
+
+		  protected:
+			std::array<char, 1024 * 16> buffer{};///< Re-usable scratch space for inflated data.
+			unique_ptr<z_stream, z_stream_deleter> ptr{};///< Unique pointer to the z_stream instance.
+			content_encoding encoding{};///< The current content coding.
+			nanoseconds decodeTime{};///< Time spent decoding the current body.
+			uint64_t bytesOut{};///< Decoded bytes for the current body.
+			uint64_t bytesIn{};///< Encoded bytes for the current body.
+			bool didWeOutput{};///< Has the current body produced any output yet?
+			bool isItRaw{};///< Did we fall back to raw deflate for the current body?
+			bool areWeDone{};///< Has the current body reached Z_STREAM_END?
+
+			/// @brief Allocates the inflater on first use, and resets it with the given window bits afterwards.
+			/// @param windowBits the zlib window bits, selecting the stream wrapper.
+			/// @return true if the inflater is ready for use.
+			inline bool initialize(int32_t windowBits) {
+				if (!ptr) {
+					ptr.reset(new z_stream{});
+					if (inflateInit2(ptr.get(), windowBits) != Z_OK) {
+						message_printer::printError<print_message_type::https>("zlib_decoder_wrapper::initialize() error: Failed to initialize the inflater.");
+						ptr.reset(nullptr);
+						return false;
+					}
+					return true;
+				}
+				if (inflateReset2(ptr.get(), windowBits) != Z_OK) {
+					message_printer::printError<print_message_type::https>("zlib_decoder_wrapper::initialize() error: Failed to reset the inflater.");
+					return false;
+				}
+				return true;
+			}
+		};
+
+		/**@}*/
+
+	}
+
+}
@@ -220,7 +220,7 @@ namespace discord_core_api {
 	  public:
 		friend class voice_connection;
 
-		voice_connection_bridge(unordered_map<uint64_t, unique_ptr<voice_user>>* voiceUsersPtrNew, jsonifier::string_base<uint8_t>& encryptionKeyNew, stream_type streamType,
+		voice_connection_bridge(dense_map<uint64_t, unique_ptr<voice_user>>* voiceUsersPtrNew, jsonifier::string_base<uint8_t>& encryptionKeyNew, stream_type streamType,
 			const jsonifier::string& baseUrlNew, const uint16_t portNew, snowflake guildIdNew,
 			std::coroutine_handle<discord_core_api::co_routine<void, false>::promise_type>* tokenNew);
 
@@ -236,7 +236,7 @@ namespace discord_core_api {
 
 	  protected:
 		std::coroutine_handle<discord_core_api::co_routine<void, false>::promise_type>* token{};
-		unordered_map<uint64_t, unique_ptr<voice_user>>* voiceUsersPtr{};
+		dense_map<uint64_t, unique_ptr<voice_user>>* voiceUsersPtr{};
 		jsonifier::string_base<uint8_t> decryptedDataString{};
 		std::array<opus_int16, 23040> downSampledVector{};
 		jsonifier::string_base<uint8_t> encryptionKey{};
@@ -306,7 +306,7 @@ namespace discord_core_api {
 		std::atomic<voice_active_state> prevActiveState{ voice_active_state::stopped };
 		std::atomic<voice_active_state> activeState{ voice_active_state::connecting };
 		discord_core_internal::voice_connection_data voiceConnectionData{};
-		unordered_map<uint64_t, unique_ptr<voice_user>> voiceUsers{};
+		dense_map<uint64_t, unique_ptr<voice_user>> voiceUsers{};
 		discord_core_internal::opus_encoder_wrapper encoder{};
 		discord_core_internal::websocket_client* baseShard{};
 		unique_ptr<voice_connection_bridge> streamSocket{};
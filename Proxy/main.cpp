@@ -0,0 +1,68 @@
+// main.cpp - Entry point for the rest proxy.
+// Oct 18, 2026
+// https://discordcoreapi.com
+
+#include <discordcoreapi/Index.hpp>
+#include <discordcoreapi/Utilities/RestProxy.hpp>
+#include <csignal>
+#include <fstream>
+#include <cstdlib>
+
+discord_core_api::rest_proxy* proxyPtr{};
+
+void signalHandler(int32_t) {
+	if (proxyPtr) {
+		proxyPtr->stop();
+	}
+}
+
+/// @brief Collects the bot token - from the DCA_BOT_TOKEN environment variable, or else from the file named by DCA_BOT_TOKEN_FILE - so that it never
+/// appears on the command line, where other users of the machine can read it.
+/// @return std::string the token, which is empty if neither was set.
+std::string getBotToken() {
+	if (auto token = std::getenv("DCA_BOT_TOKEN"); token && *token) {
+		return token;
+	}
+	std::string token{};
+	if (auto tokenFile = std::getenv("DCA_BOT_TOKEN_FILE"); tokenFile && *tokenFile) {
+		std::ifstream stream{ tokenFile };
+		std::getline(stream, token);
+		while (!token.empty() && std::isspace(static_cast<unsigned char>(token.back()))) {
+			token.pop_back();
+		}
+	}
+	return token;
+}
+
+// usage: DCA_BOT_TOKEN=<bot token> DiscordCoreAPIProxy [bind address] [port], or DCA_BOT_TOKEN_FILE=<path> in place of DCA_BOT_TOKEN.
+int32_t main(int32_t argc, char** argv) {
+	auto botToken = getBotToken();
+	if (botToken.empty()) {
+		std::cerr << "Usage: DCA_BOT_TOKEN=<bot token> " << argv[0] << " [bind address] [port]" << std::endl;
+		std::cerr << "The token can also be read from a file, named by DCA_BOT_TOKEN_FILE." << std::endl;
+		return 1;
+	}
+	discord_core_api::discord_core_client_config clientConfig{};
+	clientConfig.logOptions.logGeneralSuccessMessages = true;
+	clientConfig.logOptions.logGeneralErrorMessages	  = true;
+	clientConfig.logOptions.logHttpsErrorMessages	  = true;
+	discord_core_api::config_manager configManager{ clientConfig };
+	discord_core_api::message_printer::initialize(configManager);
+	discord_core_api::rest_proxy_options options{};
+	options.botToken = botToken.c_str();
+	if (argc > 1) {
+		options.bindAddress = argv[1];
+	}
+	if (argc > 2) {
+		options.port = static_cast<uint16_t>(std::stoul(argv[2]));
+	}
+	discord_core_api::rest_proxy proxy{ options };
+	if (!proxy.isItListening()) {
+		return 1;
+	}
+	proxyPtr = &proxy;
+	std::signal(SIGINT, &signalHandler);
+	std::signal(SIGTERM, &signalHandler);
+	proxy.run();
+	return 0;
+};
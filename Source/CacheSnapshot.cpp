@@ -0,0 +1,528 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// CacheSnapshot.cpp - Source file for the memory-mapped snapshot of the caches.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file CacheSnapshot.cpp
+
+#include <discordcoreapi/CacheSnapshot.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/// @brief Appends fixed-width values and length-prefixed strings to a record.
+		class snapshot_encoder {
+		  public:
+			inline snapshot_encoder(jsonifier::string& bufferNew) : buffer{ bufferNew } {};
+
+			template<typename value_type>
+				requires(std::is_arithmetic_v<value_type> || std::is_enum_v<value_type>)
+			inline void write(value_type value) {
+				auto currentSize = buffer.size();
+				buffer.resize(currentSize + sizeof(value_type));
+				std::memcpy(buffer.data() + currentSize, &value, sizeof(value_type));
+			}
+
+			inline void write(snowflake value) {
+				write(value.operator const uint64_t&());
+			}
+
+			inline void write(jsonifier::string_view value) {
+				write(static_cast<uint32_t>(value.size()));
+				auto currentSize = buffer.size();
+				buffer.resize(currentSize + value.size());
+				std::memcpy(buffer.data() + currentSize, value.data(), value.size());
+			}
+
+			inline void write(const icon_hash& value) {
+				write(jsonifier::string_view{ static_cast<jsonifier::string>(value) });
+			}
+
+			inline void write(const jsonifier::vector<snowflake>& values) {
+				write(static_cast<uint32_t>(values.size()));
+				for (auto& value: values) {
+					write(value);
+				}
+			}
+
+		  protected:
+			jsonifier::string& buffer;
+		};
+
+		/// @brief Reads back what a snapshot_encoder wrote, throwing if a record is shorter than it claims to be.
+		class snapshot_decoder {
+		  public:
+			inline snapshot_decoder(jsonifier::string_view bufferNew) : buffer{ bufferNew } {};
+
+			template<typename value_type>
+				requires(std::is_arithmetic_v<value_type> || std::is_enum_v<value_type>)
+			inline void read(value_type& value) {
+				checkRemaining(sizeof(value_type));
+				std::memcpy(&value, buffer.data() + currentOffset, sizeof(value_type));
+				currentOffset += sizeof(value_type);
+			}
+
+			inline void read(snowflake& value) {
+				uint64_t newValue{};
+				read(newValue);
+				value = newValue;
+			}
+
+			inline void read(jsonifier::string& value) {
+				uint32_t size{};
+				read(size);
+				checkRemaining(size);
+				value = static_cast<jsonifier::string>(buffer.substr(currentOffset, size));
+				currentOffset += size;
+			}
+
+			inline void read(icon_hash& value) {
+				jsonifier::string newValue{};
+				read(newValue);
+				value = jsonifier::string_view{ newValue.data(), newValue.size() };
+			}
+
+			inline void read(jsonifier::vector<snowflake>& values) {
+				uint32_t size{};
+				read(size);
+				checkRemaining(static_cast<uint64_t>(size) * sizeof(uint64_t));
+				values.resize(size);
+				for (auto& value: values) {
+					read(value);
+				}
+			}
+
+			inline void read(copy_on_write_vector<snowflake>& values) {
+				jsonifier::vector<snowflake> valuesNew{};
+				read(valuesNew);
+				values = std::move(valuesNew);
+			}
+
+		  protected:
+			jsonifier::string_view buffer{};
+			uint64_t currentOffset{};
+
+			inline void checkRemaining(uint64_t size) const {
+				if (currentOffset + size > buffer.size()) {
+					throw dca_exception{ "Sorry, but that snapshot record is truncated." };
+				}
+			}
+		};
+
+		inline void encode(snapshot_encoder& encoder, const guild_cache_data& value) {
+			encoder.write(value.id);
+			encoder.write(value.name);
+			encoder.write(value.ownerId);
+			encoder.write(value.memberCount);
+			encoder.write(static_cast<uint64_t>(value.joinedAt));
+			encoder.write(value.flags);
+			encoder.write(value.icon);
+			encoder.write(value.banner);
+			encoder.write(value.splash);
+			encoder.write(value.discovery);
+			encoder.write(value.discoverySplash);
+			encoder.write(value.channels.get());
+			encoder.write(value.emoji.get());
+			encoder.write(value.roles.get());
+		}
+
+		inline void decode(snapshot_decoder& decoder, guild_cache_data& value) {
+			uint64_t joinedAt{};
+			decoder.read(value.id);
+			decoder.read(value.name);
+			decoder.read(value.ownerId);
+			decoder.read(value.memberCount);
+			decoder.read(joinedAt);
+			value.joinedAt = joinedAt;
+			decoder.read(value.flags);
+			decoder.read(value.icon);
+			decoder.read(value.banner);
+			decoder.read(value.splash);
+			decoder.read(value.discovery);
+			decoder.read(value.discoverySplash);
+			decoder.read(value.channels);
+			decoder.read(value.emoji);
+			decoder.read(value.roles);
+		}
+
+		inline void encode(snapshot_encoder& encoder, const channel_cache_data& value) {
+			encoder.write(value.id);
+			encoder.write(value.guildId);
+			encoder.write(value.parentId);
+			encoder.write(value.ownerId);
+			encoder.write(value.type);
+			encoder.write(value.flags);
+			encoder.write(value.position);
+			encoder.write(value.memberCount);
+			encoder.write(value.name);
+			encoder.write(value.topic);
+			encoder.write(static_cast<uint32_t>(value.permissionOverwrites.size()));
+			for (auto& overwrite: value.permissionOverwrites) {
+				encoder.write(overwrite.id);
+				encoder.write(overwrite.type);
+				encoder.write(overwrite.allow.operator uint64_t());
+				encoder.write(overwrite.deny.operator uint64_t());
+			}
+		}
+
+		inline void decode(snapshot_decoder& decoder, channel_cache_data& value) {
+			decoder.read(value.id);
+			decoder.read(value.guildId);
+			decoder.read(value.parentId);
+			decoder.read(value.ownerId);
+			decoder.read(value.type);
+			decoder.read(value.flags);
+			decoder.read(value.position);
+			decoder.read(value.memberCount);
+			decoder.read(value.name);
+			decoder.read(value.topic);
+			uint32_t overwriteCount{};
+			decoder.read(overwriteCount);
+			for (uint32_t x = 0; x < overwriteCount; ++x) {
+				over_write_data overwrite{};
+				uint64_t allow{};
+				uint64_t deny{};
+				decoder.read(overwrite.id);
+				decoder.read(overwrite.type);
+				decoder.read(allow);
+				decoder.read(deny);
+				overwrite.allow = allow;
+				overwrite.deny	= deny;
+				value.permissionOverwrites.emplace_back(std::move(overwrite));
+			}
+		}
+
+		inline void encode(snapshot_encoder& encoder, const role_cache_data& value) {
+			encoder.write(value.id);
+			encoder.write(value.guildId);
+			encoder.write(value.permissionsVal.operator uint64_t());
+			encoder.write(value.position);
+			encoder.write(value.flags);
+			encoder.write(value.color);
+			encoder.write(value.name);
+			encoder.write(value.unicodeEmoji);
+		}
+
+		inline void decode(snapshot_decoder& decoder, role_cache_data& value) {
+			uint64_t permissionsVal{};
+			decoder.read(value.id);
+			decoder.read(value.guildId);
+			decoder.read(permissionsVal);
+			value.permissionsVal = permissionsVal;
+			decoder.read(value.position);
+			decoder.read(value.flags);
+			decoder.read(value.color);
+			decoder.read(value.name);
+			decoder.read(value.unicodeEmoji);
+		}
+
+		inline void encode(snapshot_encoder& encoder, const user_cache_data& value) {
+			encoder.write(value.id);
+			encoder.write(value.flags);
+			encoder.write(value.premiumType);
+			encoder.write(value.accentColor);
+			encoder.write(value.userName);
+			encoder.write(value.globalName);
+			encoder.write(value.discriminator);
+			encoder.write(value.avatar);
+			encoder.write(value.avatarDecoration);
+			encoder.write(value.banner);
+		}
+
+		inline void decode(snapshot_decoder& decoder, user_cache_data& value) {
+			decoder.read(value.id);
+			decoder.read(value.flags);
+			decoder.read(value.premiumType);
+			decoder.read(value.accentColor);
+			decoder.read(value.userName);
+			decoder.read(value.globalName);
+			decoder.read(value.discriminator);
+			decoder.read(value.avatar);
+			decoder.read(value.avatarDecoration);
+			decoder.read(value.banner);
+		}
+
+		inline void encode(snapshot_encoder& encoder, const guild_member_cache_data& value) {
+			encoder.write(value.guildId);
+			encoder.write(value.user.id);
+			encoder.write(value.permissionsVal.operator uint64_t());
+			encoder.write(static_cast<uint64_t>(value.joinedAt));
+			encoder.write(value.flags);
+			encoder.write(value.nick);
+			encoder.write(value.avatar);
+			encoder.write(value.roles);
+		}
+
+		inline void decode(snapshot_decoder& decoder, guild_member_cache_data& value) {
+			uint64_t permissionsVal{};
+			uint64_t joinedAt{};
+			decoder.read(value.guildId);
+			decoder.read(value.user.id);
+			decoder.read(permissionsVal);
+			value.permissionsVal = permissionsVal;
+			decoder.read(joinedAt);
+			value.joinedAt = joinedAt;
+			decoder.read(value.flags);
+			decoder.read(value.nick);
+			decoder.read(value.avatar);
+			decoder.read(value.roles);
+		}
+
+		inline bool operator<(const snapshot_record& lhs, const snapshot_record& rhs) {
+			return lhs.idOne < rhs.idOne || (lhs.idOne == rhs.idOne && lhs.idTwo < rhs.idTwo);
+		}
+
+		inline uint64_t alignSnapshotOffset(uint64_t offset) {
+			return (offset + 7) & ~uint64_t{ 7 };
+		}
+
+	}
+
+	bool cache_snapshot::open(jsonifier::string_view filePath) {
+		using namespace discord_core_internal;
+		std::unique_lock lock{ snapshotMutex };
+		isItOpen.store(false, std::memory_order_release);
+		file = mapped_file{};
+		sections = {};
+		try {
+			file = mapped_file{ filePath };
+		} catch (const dca_exception&) {
+			// no snapshot yet - this is the first run.
+			return false;
+		}
+		auto fileData = file.view();
+		snapshot_header header{};
+		if (fileData.size() < sizeof(snapshot_header) + sizeof(snapshot_section_header) * snapshotSectionCount) {
+			file = mapped_file{};
+			return false;
+		}
+		std::memcpy(&header, fileData.data(), sizeof(header));
+		if (header.magic != snapshotMagic || header.version != snapshotVersion || header.sectionCount != snapshotSectionCount) {
+			message_printer::printError<print_message_type::general>("cache_snapshot::open() error: Ignoring an incompatible snapshot at: " + static_cast<jsonifier::string>(filePath));
+			file = mapped_file{};
+			return false;
+		}
+		for (uint64_t x = 0; x < snapshotSectionCount; ++x) {
+			snapshot_section_header sectionHeader{};
+			std::memcpy(&sectionHeader, fileData.data() + sizeof(snapshot_header) + x * sizeof(snapshot_section_header), sizeof(sectionHeader));
+			if (sectionHeader.indexOffset % alignof(snapshot_record) != 0 || sectionHeader.recordCount > fileData.size() / sizeof(snapshot_record) ||
+				sectionHeader.indexOffset + sectionHeader.recordCount * sizeof(snapshot_record) > fileData.size() ||
+				sectionHeader.dataOffset + sectionHeader.dataSize > fileData.size()) {
+				message_printer::printError<print_message_type::general>("cache_snapshot::open() error: Ignoring a corrupt snapshot at: " + static_cast<jsonifier::string>(filePath));
+				sections = {};
+				file	 = mapped_file{};
+				return false;
+			}
+			auto& section		= sections[x];
+			section.records		= reinterpret_cast<const snapshot_record*>(fileData.data() + sectionHeader.indexOffset);
+			section.recordCount = sectionHeader.recordCount;
+			section.data		= fileData.substr(sectionHeader.dataOffset, sectionHeader.dataSize);
+			section.consumed	= makeUnique<std::atomic_uint8_t[]>(sectionHeader.recordCount);
+		}
+		isItOpen.store(true, std::memory_order_release);
+		return true;
+	}
+
+	void cache_snapshot::close() {
+		std::unique_lock lock{ snapshotMutex };
+		isItOpen.store(false, std::memory_order_release);
+		sections = {};
+		file	 = mapped_file{};
+	}
+
+	jsonifier::string_view cache_snapshot::findAndConsume(discord_core_internal::snapshot_section sectionNew, uint64_t idOne, uint64_t idTwo) {
+		std::shared_lock lock{ snapshotMutex };
+		if (!isItOpen.load(std::memory_order_acquire)) {
+			return {};
+		}
+		auto& section = sections[static_cast<uint64_t>(sectionNew)];
+		discord_core_internal::snapshot_record key{ idOne, idTwo };
+		auto iter = std::lower_bound(section.records, section.records + section.recordCount, key);
+		if (iter == section.records + section.recordCount || iter->idOne != idOne || iter->idTwo != idTwo) {
+			return {};
+		}
+		if (section.consumed[static_cast<uint64_t>(iter - section.records)].exchange(1, std::memory_order_acq_rel) != 0) {
+			return {};
+		}
+		if (iter->offset + iter->size > section.data.size()) {
+			return {};
+		}
+		return section.data.substr(iter->offset, iter->size);
+	}
+
+	void cache_snapshot::carryForward(cache_snapshot_writer& writer) {
+		std::shared_lock lock{ snapshotMutex };
+		if (!isItOpen.load(std::memory_order_acquire)) {
+			return;
+		}
+		for (uint64_t x = 0; x < discord_core_internal::snapshotSectionCount; ++x) {
+			auto& section = sections[x];
+			for (uint64_t y = 0; y < section.recordCount; ++y) {
+				auto& record = section.records[y];
+				if (section.consumed[y].load(std::memory_order_acquire) == 0 && record.offset + record.size <= section.data.size()) {
+					writer.addEncoded(static_cast<discord_core_internal::snapshot_section>(x), record.idOne, record.idTwo, section.data.substr(record.offset, record.size));
+				}
+			}
+		}
+	}
+
+	template<typename value_type> std::optional<value_type> cache_snapshot::take(snowflake idOne, snowflake idTwo) {
+		if (!isItOpen.load(std::memory_order_acquire)) {
+			return std::nullopt;
+		}
+		// the view stays valid after findAndConsume() returns, as the snapshot is only unmapped during shutdown.
+		auto encodedData = findAndConsume(discord_core_internal::snapshotSectionFor<value_type>, idOne.operator const uint64_t&(), idTwo.operator const uint64_t&());
+		if (encodedData.size() == 0) {
+			return std::nullopt;
+		}
+		try {
+			discord_core_internal::snapshot_decoder decoder{ encodedData };
+			value_type returnValue{};
+			decode(decoder, returnValue);
+			return returnValue;
+		} catch (const dca_exception& error) {
+			message_printer::printError<print_message_type::general>(error.what());
+			return std::nullopt;
+		}
+	}
+
+	template DiscordCoreAPI_Dll std::optional<guild_member_cache_data> cache_snapshot::take<guild_member_cache_data>(snowflake, snowflake);
+	template DiscordCoreAPI_Dll std::optional<channel_cache_data> cache_snapshot::take<channel_cache_data>(snowflake, snowflake);
+	template DiscordCoreAPI_Dll std::optional<guild_cache_data> cache_snapshot::take<guild_cache_data>(snowflake, snowflake);
+	template DiscordCoreAPI_Dll std::optional<role_cache_data> cache_snapshot::take<role_cache_data>(snowflake, snowflake);
+	template DiscordCoreAPI_Dll std::optional<user_cache_data> cache_snapshot::take<user_cache_data>(snowflake, snowflake);
+
+	template<typename value_type> inline void addToSection(std::vector<discord_core_internal::snapshot_record>& records, jsonifier::string& data, const value_type& value,
+		uint64_t idOne, uint64_t idTwo) {
+		discord_core_internal::snapshot_record record{ idOne, idTwo, data.size() };
+		discord_core_internal::snapshot_encoder encoder{ data };
+		encode(encoder, value);
+		record.size = data.size() - record.offset;
+		records.emplace_back(record);
+	}
+
+	void cache_snapshot_writer::add(const guild_member_cache_data& guildMember) {
+		auto& section = sections[static_cast<uint64_t>(discord_core_internal::snapshot_section::guild_members)];
+		addToSection(section.records, section.data, guildMember, guildMember.guildId.operator const uint64_t&(), guildMember.user.id.operator const uint64_t&());
+	}
+
+	void cache_snapshot_writer::add(const channel_cache_data& channel) {
+		auto& section = sections[static_cast<uint64_t>(discord_core_internal::snapshot_section::channels)];
+		addToSection(section.records, section.data, channel, channel.id.operator const uint64_t&(), 0);
+	}
+
+	void cache_snapshot_writer::add(const guild_cache_data& guild) {
+		auto& section = sections[static_cast<uint64_t>(discord_core_internal::snapshot_section::guilds)];
+		addToSection(section.records, section.data, guild, guild.id.operator const uint64_t&(), 0);
+	}
+
+	void cache_snapshot_writer::add(const role_cache_data& role) {
+		auto& section = sections[static_cast<uint64_t>(discord_core_internal::snapshot_section::roles)];
+		addToSection(section.records, section.data, role, role.id.operator const uint64_t&(), 0);
+	}
+
+	void cache_snapshot_writer::add(const user_cache_data& user) {
+		auto& section = sections[static_cast<uint64_t>(discord_core_internal::snapshot_section::users)];
+		addToSection(section.records, section.data, user, user.id.operator const uint64_t&(), 0);
+	}
+
+	void cache_snapshot_writer::addEncoded(discord_core_internal::snapshot_section sectionNew, uint64_t idOne, uint64_t idTwo, jsonifier::string_view encodedData) {
+		auto& section = sections[static_cast<uint64_t>(sectionNew)];
+		auto currentSize = section.data.size();
+		section.records.emplace_back(discord_core_internal::snapshot_record{ idOne, idTwo, currentSize, encodedData.size() });
+		section.data.resize(currentSize + encodedData.size());
+		std::memcpy(section.data.data() + currentSize, encodedData.data(), encodedData.size());
+	}
+
+	bool cache_snapshot_writer::write(jsonifier::string_view filePath) {
+		using namespace discord_core_internal;
+		std::array<snapshot_section_header, snapshotSectionCount> sectionHeaders{};
+		uint64_t currentOffset{ sizeof(snapshot_header) + sizeof(snapshot_section_header) * snapshotSectionCount };
+		for (uint64_t x = 0; x < snapshotSectionCount; ++x) {
+			auto& section = sections[x];
+			// stable, so that of any duplicates, the copy that was added first - the cache's, rather than a carried-forward one - is the one that's kept.
+			std::stable_sort(section.records.begin(), section.records.end());
+			section.records.erase(std::unique(section.records.begin(), section.records.end(),
+									  [](const snapshot_record& lhs, const snapshot_record& rhs) {
+										  return lhs.idOne == rhs.idOne && lhs.idTwo == rhs.idTwo;
+									  }),
+				section.records.end());
+			sectionHeaders[x].recordCount = section.records.size();
+			sectionHeaders[x].indexOffset = alignSnapshotOffset(currentOffset);
+			sectionHeaders[x].dataOffset  = sectionHeaders[x].indexOffset + section.records.size() * sizeof(snapshot_record);
+			sectionHeaders[x].dataSize	  = section.data.size();
+			currentOffset				  = sectionHeaders[x].dataOffset + sectionHeaders[x].dataSize;
+		}
+		snapshot_header header{ snapshotMagic, snapshotVersion, static_cast<uint32_t>(snapshotSectionCount) };
+		jsonifier::string filePathNew{ static_cast<jsonifier::string>(filePath) };
+		jsonifier::string tempPath{ filePathNew + ".tmp" };
+		{
+			std::ofstream outputStream{ tempPath.data(), std::ios::binary | std::ios::trunc };
+			if (!outputStream) {
+				message_printer::printError<print_message_type::general>("cache_snapshot_writer::write() error: Failed to open: " + tempPath);
+				return false;
+			}
+			uint64_t writtenBytes{};
+			auto writeBytes = [&](const void* bytes, uint64_t size) {
+				outputStream.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+				writtenBytes += size;
+			};
+			auto padTo = [&](uint64_t offset) {
+				static constexpr char padding[8]{};
+				writeBytes(padding, offset - writtenBytes);
+			};
+			writeBytes(&header, sizeof(header));
+			writeBytes(sectionHeaders.data(), sizeof(snapshot_section_header) * snapshotSectionCount);
+			for (uint64_t x = 0; x < snapshotSectionCount; ++x) {
+				padTo(sectionHeaders[x].indexOffset);
+				writeBytes(sections[x].records.data(), sections[x].records.size() * sizeof(snapshot_record));
+				writeBytes(sections[x].data.data(), sections[x].data.size());
+			}
+			if (!outputStream.flush()) {
+				message_printer::printError<print_message_type::general>("cache_snapshot_writer::write() error: Failed to write: " + tempPath);
+				return false;
+			}
+		}
+		// the previous snapshot may still be mapped, which would keep it from being replaced on windows.
+		cache_snapshot::close();
+		std::error_code errorCode{};
+		std::filesystem::rename(tempPath.data(), filePathNew.data(), errorCode);
+		if (errorCode) {
+			message_printer::printError<print_message_type::general>("cache_snapshot_writer::write() error: Failed to replace: " + filePathNew);
+			return false;
+		}
+		return true;
+	}
+
+	std::array<cache_snapshot::section_state, discord_core_internal::snapshotSectionCount> cache_snapshot::sections{};
+	std::shared_mutex cache_snapshot::snapshotMutex{};
+	std::atomic_bool cache_snapshot::isItOpen{};
+	mapped_file cache_snapshot::file{};
+}
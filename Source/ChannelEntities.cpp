@@ -97,7 +97,8 @@ namespace discord_core_api {
 	}
 
 	channel_cache_data& channel_cache_data::operator=(const channel_data& other) {
-		if (other.permissionOverwrites.size() > 0) {
+		using projection = cache_projection<channel_cache_data>;
+		if (projection::keeps(channel_cache_fields::permission_overwrites) && other.permissionOverwrites.size() > 0) {
 			permissionOverwrites = other.permissionOverwrites;
 		}
 		if (static_cast<int64_t>(other.flags) != 0) {
@@ -105,25 +106,25 @@ namespace discord_core_api {
 		}
 		setFlagValue(channel_flags::managed, other.managed);
 		setFlagValue(channel_flags::nsfw, other.nsfw);
-		if (other.memberCount != 0) {
+		if (projection::keeps(channel_cache_fields::member_count) && other.memberCount != 0) {
 			memberCount = other.memberCount;
 		}
-		if (other.parentId != 0) {
+		if (projection::keeps(channel_cache_fields::parent_id) && other.parentId != 0) {
 			parentId = other.parentId;
 		}
-		if (other.position != 0) {
+		if (projection::keeps(channel_cache_fields::position) && other.position != 0) {
 			position = other.position;
 		}
 		if (other.guildId != 0) {
 			guildId = other.guildId;
 		}
-		if (other.ownerId != 0) {
+		if (projection::keeps(channel_cache_fields::owner_id) && other.ownerId != 0) {
 			ownerId = other.ownerId;
 		}
-		if (other.topic != "") {
+		if (projection::keeps(channel_cache_fields::topic) && other.topic != "") {
 			topic = other.topic;
 		}
-		if (other.name != "") {
+		if (projection::keeps(channel_cache_fields::name) && other.name != "") {
 			name = other.name;
 		}
 		if (other.id != 0) {
@@ -138,7 +139,8 @@ namespace discord_core_api {
 	}
 
 	channel_cache_data& channel_cache_data::operator=(channel_data&& other) noexcept {
-		if (other.permissionOverwrites.size() > 0) {
+		using projection = cache_projection<channel_cache_data>;
+		if (projection::keeps(channel_cache_fields::permission_overwrites) && other.permissionOverwrites.size() > 0) {
 			permissionOverwrites = std::move(other.permissionOverwrites);
 		}
 		if (static_cast<int64_t>(other.flags) != 0) {
@@ -146,25 +148,25 @@ namespace discord_core_api {
 		}
 		setFlagValue(channel_flags::managed, other.managed);
 		setFlagValue(channel_flags::nsfw, other.nsfw);
-		if (other.memberCount != 0) {
+		if (projection::keeps(channel_cache_fields::member_count) && other.memberCount != 0) {
 			memberCount = other.memberCount;
 		}
-		if (other.topic != "") {
+		if (projection::keeps(channel_cache_fields::topic) && other.topic != "") {
 			topic = std::move(other.topic);
 		}
-		if (other.name != "") {
+		if (projection::keeps(channel_cache_fields::name) && other.name != "") {
 			name = std::move(other.name);
 		}
-		if (other.parentId != 0) {
+		if (projection::keeps(channel_cache_fields::parent_id) && other.parentId != 0) {
 			parentId = other.parentId;
 		}
-		if (other.position != 0) {
+		if (projection::keeps(channel_cache_fields::position) && other.position != 0) {
 			position = other.position;
 		}
 		if (other.guildId != 0) {
 			guildId = other.guildId;
 		}
-		if (other.ownerId != 0) {
+		if (projection::keeps(channel_cache_fields::owner_id) && other.ownerId != 0) {
 			ownerId = other.ownerId;
 		}
 		if (other.id != 0) {
@@ -218,6 +220,12 @@ namespace discord_core_api {
 	void channels::initialize(discord_core_internal::https_client* client, config_manager* configManagerNew) {
 		channels::doWeCacheChannelsBool = configManagerNew->doWeCacheChannels();
 		channels::httpsClient			= client;
+		channels::cache.setEvictionPolicy(configManagerNew->getCacheOptions().channelPolicy);
+		channels::cache.setEvictionHandler([](const channel_cache_data& channel) {
+			if (channel.guildId != 0) {
+				guildChannelIndex.erase(channel.guildId, channel.id);
+			}
+		});
 	}
 
 	co_routine<channel_data> channels::getChannelAsync(const get_channel_data dataPackage) {
@@ -227,8 +235,8 @@ namespace discord_core_api {
 		workload.relativePath  = "/channels/" + dataPackage.channelId;
 		workload.callStack	   = "channels::getChannelAsync()";
 		channel_data data{ dataPackage.channelId };
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
+		if (auto cachedData = cache.find(data.id)) {
+			data = *cachedData;
 		}
 		channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
 		if (doWeCacheChannelsBool) {
@@ -238,13 +246,26 @@ namespace discord_core_api {
 	}
 
 	channel_cache_data channels::getCachedChannel(const get_channel_data dataPackage) {
-		if (channels::cache.contains(dataPackage.channelId)) {
-			return cache[dataPackage.channelId];
+		if (auto cachedData = channels::cache.find(dataPackage.channelId)) {
+			return *cachedData;
+		} else if (auto snapshotData = cache_snapshot::take<channel_cache_data>(dataPackage.channelId)) {
+			insertChannel(*snapshotData);
+			return *snapshotData;
 		} else {
 			return getChannelAsync({ .channelId = dataPackage.channelId }).get();
 		}
 	}
 
+	cache_view<channel_cache_data> channels::getCachedChannelView(const get_channel_data dataPackage) {
+		if (auto cachedData = cache.view(dataPackage.channelId)) {
+			return cachedData;
+		}
+		if (auto snapshotData = cache_snapshot::take<channel_cache_data>(dataPackage.channelId)) {
+			insertChannel(std::move(*snapshotData));
+		}
+		return cache.view(dataPackage.channelId);
+	}
+
 	co_routine<channel_data> channels::modifyChannelAsync(const modify_channel_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Patch_Channel };
 		co_await newThreadAwaitable<channel_data>();
@@ -256,8 +277,8 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		channel_data data{ dataPackage.channelId };
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
+		if (auto cachedData = cache.find(data.id)) {
+			data = *cachedData;
 		}
 		channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
 		if (doWeCacheChannelsBool) {
@@ -418,14 +439,32 @@ namespace discord_core_api {
 	}
 
 	void channels::removeChannel(const channel_cache_data& channelId) {
+		if (auto cachedData = channels::cache.view(channelId); cachedData && cachedData->guildId != 0) {
+			guildChannelIndex.erase(cachedData->guildId, cachedData->id);
+		}
+		cache_snapshot::discard<channel_cache_data>(channelId.id);
 		channels::cache.erase(channelId);
 	};
 
+	void channels::removeChannels(snowflake guildId) {
+		for (auto& value: guildChannelIndex.extract(guildId)) {
+			channel_cache_data channel{};
+			channel.id = value;
+			cache_snapshot::discard<channel_cache_data>(channel.id);
+			channels::cache.erase(channel);
+		}
+	}
+
+	jsonifier::vector<snowflake> channels::getCachedChannelIds(snowflake guildId) {
+		return guildChannelIndex.collect(guildId);
+	}
+
 	bool channels::doWeCacheChannels() {
 		return channels::doWeCacheChannelsBool;
 	}
 
 	object_cache<channel_cache_data> channels::cache{};
+	secondary_index<snowflake> channels::guildChannelIndex{};
 	discord_core_internal::https_client* channels::httpsClient{};
 	bool channels::doWeCacheChannelsBool{};
 }
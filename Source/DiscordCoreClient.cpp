@@ -83,18 +83,16 @@ namespace discord_core_api {
 
 	void signalHandler(int32_t value) noexcept {
 		switch (value) {
-			case SIGTERM: {
-				message_printer::printError<print_message_type::general>("SIGTERM ERROR.");
-				exit(EXIT_FAILURE);
+			case SIGTERM:
+			case SIGINT: {
+				// only flag the shutdown here - runBot() returns from its loop, and writes the cache snapshot, outside of the signal's context.
+				doWeQuit.store(true, std::memory_order_release);
+				return;
 			}
 			case SIGSEGV: {
 				message_printer::printError<print_message_type::general>("SIGSEGV ERROR.");
 				exit(EXIT_FAILURE);
 			}
-			case SIGINT: {
-				message_printer::printError<print_message_type::general>("SIGINT ERROR.");
-				exit(EXIT_SUCCESS);
-			}
 			case SIGILL: {
 				message_printer::printError<print_message_type::general>("SIGILL ERROR.");
 				exit(EXIT_FAILURE);
@@ -120,7 +118,7 @@ namespace discord_core_api {
 		std::signal(SIGABRT, &signalHandler);
 		std::signal(SIGFPE, &signalHandler);
 		message_printer::initialize(configManager);
-		if (!discord_core_internal::ssl_context_holder::initialize()) {
+		if (!discord_core_internal::ssl_context_holder::initialize(configManager.doWeUseKernelTls())) {
 			message_printer::printError<print_message_type::general>("Failed to initialize the SSL_CTX structure!");
 			return;
 		}
@@ -128,7 +126,7 @@ namespace discord_core_api {
 			message_printer::printError<print_message_type::general>("Lib_sodium failed to initialize!");
 			return;
 		}
-		httpsClient = makeUnique<discord_core_internal::https_client>(jsonifier::string{ configManager.getBotToken() });
+		httpsClient = makeUnique<discord_core_internal::https_client>(jsonifier::string{ configManager.getBotToken() }, configManager.getHttpsOptions());
 		application_commands::initialize(httpsClient.get());
 		auto_moderation_rules::initialize(httpsClient.get());
 		channels::initialize(httpsClient.get(), &configManager);
@@ -144,6 +142,10 @@ namespace discord_core_api {
 		threads::initialize(httpsClient.get());
 		web_hooks::initialize(httpsClient.get());
 		users::initialize(httpsClient.get(), &configManager);
+		permission_engine::initialize(&configManager);
+		if (configManager.getCacheOptions().snapshotPath != "") {
+			cache_snapshot::open(configManager.getCacheOptions().snapshotPath);
+		}
 	}
 
 	const config_manager& discord_core_client::getConfigManager() const {
@@ -167,11 +169,35 @@ namespace discord_core_api {
 			while (!doWeQuit.load(std::memory_order_acquire)) {
 				std::this_thread::sleep_for(1ms);
 			}
+			writeCacheSnapshot();
 		} catch (const dca_exception& error) {
 			message_printer::printError<print_message_type::general>(error.what());
 		}
 	}
 
+	bool discord_core_client::writeCacheSnapshot() {
+		static std::atomic_bool wasItWritten{};
+		auto instance = getInstance();
+		if (!instance || instance->configManager.getCacheOptions().snapshotPath == "" || wasItWritten.exchange(true, std::memory_order_acq_rel)) {
+			return false;
+		}
+		cache_snapshot_writer writer{};
+		auto addToWriter = [&](const auto& value) {
+			writer.add(value);
+		};
+		guilds::getCache().visit(addToWriter);
+		channels::cache.visit(addToWriter);
+		roles::cache.visit(addToWriter);
+		users::cache.visit(addToWriter);
+		if (guild_members::doWeUseCompactGuildMembersBool) {
+			guild_members::compactCache.visit(addToWriter);
+		} else {
+			guild_members::cache.visit(addToWriter);
+		}
+		cache_snapshot::carryForward(writer);
+		return writer.write(instance->configManager.getCacheOptions().snapshotPath);
+	}
+
 	void discord_core_client::registerFunction(const jsonifier::vector<jsonifier::string>& functionNames, unique_ptr<base_function> baseFunction,
 		create_application_command_data commandData, bool alwaysRegister) {
 		commandData.alwaysRegister = alwaysRegister;
@@ -313,6 +339,7 @@ namespace discord_core_api {
 	}
 
 	discord_core_client::~discord_core_client() {
+		eventQueue.stopAndWait();
 		instancePtr.release();
 	}
 
@@ -181,9 +181,9 @@ namespace jsonifier {
 
 namespace discord_core_api {
 
-	template<> unordered_map<jsonifier::string, unbounded_message_block<message_data>*> object_collector<message_data>::objectsBuffersMap;
+	template<> dense_map<jsonifier::string, unbounded_message_block<message_data>*> object_collector<message_data>::objectsBuffersMap;
 
-	template<> unordered_map<jsonifier::string, unbounded_message_block<reaction_data>*> object_collector<reaction_data>::objectsBuffersMap;
+	template<> dense_map<jsonifier::string, unbounded_message_block<reaction_data>*> object_collector<reaction_data>::objectsBuffersMap;
 
 	on_input_event_creation_data::on_input_event_creation_data(jsonifier::jsonifier_core& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
 		parserNew.parseJson(*static_cast<event_data*>(this), dataToParse);
@@ -242,23 +242,31 @@ namespace discord_core_api {
 
 	on_channel_creation_data::on_channel_creation_data(jsonifier::jsonifier_core& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
 		parserNew.parseJson(*static_cast<event_data*>(this), dataToParse);
+		discord_core_internal::https_response_cache::invalidate("/channels/" + value.id);
+		discord_core_internal::https_response_cache::invalidate("/guilds/" + value.guildId + "/channels");
 		if (auto result = parserNew.getErrors(); result.size() > 0) {
 			for (auto& valueNew: result) {
 				message_printer::printError<print_message_type::general>(valueNew.reportError());
 			}
 		}
+		permission_engine::insertChannel(value.guildId, value);
 		if (channels::doWeCacheChannels()) {
 			channels::insertChannel(static_cast<channel_cache_data>(value));
 		}
 		if (guilds::doWeCacheGuilds()) {
-			if (guilds::getCache().contains(value.guildId)) {
-				guilds::getCache()[value.guildId].channels.emplace_back(value.id);
-			}
+			guilds::getCache().update(value.guildId, [&](guild_cache_data& guild) {
+				if (cache_projection<guild_cache_data>::keeps(guild_cache_fields::channels)) {
+					guild.channels.emplace_back(value.id);
+				}
+			});
 		}
 	}
 
 	on_channel_update_data::on_channel_update_data(jsonifier::jsonifier_core& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
 		parserNew.parseJson(*static_cast<updated_event_data*>(this), dataToParse);
+		discord_core_internal::https_response_cache::invalidate("/channels/" + value.id);
+		discord_core_internal::https_response_cache::invalidate("/guilds/" + value.guildId + "/channels");
+		permission_engine::insertChannel(value.guildId, value);
 		if (channels::doWeCacheChannels()) {
 			oldValue = channels::getCachedChannel({ .channelId = value.id });
 			channels::insertChannel(static_cast<channel_cache_data>(value));
@@ -267,22 +275,25 @@ namespace discord_core_api {
 
 	on_channel_deletion_data::on_channel_deletion_data(jsonifier::jsonifier_core& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
 		parserNew.parseJson(*static_cast<event_data*>(this), dataToParse);
+		discord_core_internal::https_response_cache::invalidate("/channels/" + value.id);
+		discord_core_internal::https_response_cache::invalidate("/guilds/" + value.guildId + "/channels");
 		if (auto result = parserNew.getErrors(); result.size() > 0) {
 			for (auto& valueNew: result) {
 				message_printer::printError<print_message_type::general>(valueNew.reportError());
 			}
 		}
+		permission_engine::removeChannel(value.guildId, value.id);
 		if (channels::doWeCacheChannels()) {
 			channels::removeChannel(static_cast<channel_cache_data>(value));
 		}
 		if (guilds::doWeCacheGuilds()) {
-			if (guilds::getCache().contains(value.guildId)) {
-				for (uint64_t x = 0; x < guilds::getCache().operator[](value.guildId).channels.size(); ++x) {
-					if (guilds::getCache().operator[](value.guildId).channels.at(x) == static_cast<uint64_t>(value.id)) {
-						guilds::getCache().operator[](value.guildId).channels.erase(guilds::getCache().operator[](value.guildId).channels.begin() + static_cast<int64_t>(x));
+			guilds::getCache().update(value.guildId, [&](guild_cache_data& guild) {
+				for (uint64_t x = 0; x < guild.channels.size(); ++x) {
+					if (guild.channels.at(x) == static_cast<uint64_t>(value.id)) {
+						guild.channels.erase(guild.channels.begin() + static_cast<int64_t>(x));
 					}
 				}
-			}
+			});
 		}
 	}
 
@@ -356,6 +367,7 @@ namespace discord_core_api {
 				message_printer::printError<print_message_type::general>(valueNew.reportError());
 			}
 		}
+		permission_engine::insertGuild(value);
 		if (guild_members::doWeCacheGuildMembers()) {
 			for (auto& valueNew: value.members) {
 				try {
@@ -417,25 +429,26 @@ namespace discord_core_api {
 
 	on_guild_update_data::on_guild_update_data(jsonifier::jsonifier_core& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
 		parserNew.parseJson(*static_cast<updated_event_data*>(this), dataToParse);
+		discord_core_internal::https_response_cache::invalidate("/guilds/" + value.id);
 		if (guilds::doWeCacheGuilds()) {
 			oldValue = guilds::getCachedGuild({ value.id });
 			guilds::insertGuild(static_cast<guild_cache_data>(value));
 		}
+		permission_engine::updateGuild(value);
 	}
 
 	on_guild_deletion_data::on_guild_deletion_data(jsonifier::jsonifier_core& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
 		parserNew.parseJson(*static_cast<event_data*>(this), dataToParse);
+		discord_core_internal::https_response_cache::invalidateRelated("/guilds/" + value.id);
 		if (auto result = parserNew.getErrors(); result.size() > 0) {
 			for (auto& valueNew: result) {
 				message_printer::printError<print_message_type::general>(valueNew.reportError());
 			}
 		}
-		for (auto& valueNew: value.members) {
-			guild_members::removeGuildMember(valueNew);
-		}
-		for (auto& valueNew: value.channels) {
-			channels::removeChannel(valueNew);
-		}
+		permission_engine::removeGuild(value.id);
+		guild_members::removeGuildMembers(value.id);
+		guild_members::removeVoiceStates(value.id);
+		channels::removeChannels(value.id);
 		for (auto& valueNew: value.roles) {
 			roles::removeRole(valueNew);
 		}
@@ -451,14 +464,6 @@ namespace discord_core_api {
 				message_printer::printError<print_message_type::general>(valueNew.reportError());
 			}
 		}
-		if (guilds::getCache().contains(value.guildId)) {
-			for (uint64_t x = 0; x < guilds::getCache().operator[](value.guildId).members.size(); ++x) {
-				if (guilds::getCache().operator[](value.guildId).members.at(x) == static_cast<uint64_t>(value.user.id)) {
-					guilds::getCache().operator[](value.guildId).members.erase(guilds::getCache().operator[](value.guildId).members.begin() + static_cast<int64_t>(x));
-					--guilds::getCache()[value.guildId].memberCount;
-				}
-			}
-		}
 	}
 
 	on_guild_ban_remove_data::on_guild_ban_remove_data(jsonifier::jsonifier_core& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
@@ -477,12 +482,16 @@ namespace discord_core_api {
 				message_printer::printError<print_message_type::general>(valueNew.reportError());
 			}
 		}
-		if (guilds::getCache().contains(value.guildId)) {
-			guilds::getCache()[value.guildId].emoji.clear();
-			for (auto& valueNew: value.emojis) {
-				guilds::getCache()[value.guildId].emoji.emplace_back(valueNew.id);
+		guilds::getCache().update(value.guildId, [&](guild_cache_data& guild) {
+			guild.emoji.clear();
+			if (cache_projection<guild_cache_data>::keeps(guild_cache_fields::emoji)) {
+				jsonifier::vector<snowflake> emoji{};
+				for (auto& valueNew: value.emojis) {
+					emoji.emplace_back(valueNew.id);
+				}
+				guild.emoji = std::move(emoji);
 			}
-		}
+		});
 	}
 
 	on_guild_stickers_update_data::on_guild_stickers_update_data(jsonifier::jsonifier_core& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
@@ -510,14 +519,14 @@ namespace discord_core_api {
 				message_printer::printError<print_message_type::general>(valueNew.reportError());
 			}
 		}
+		permission_engine::insertGuildMember(value.guildId, value);
 		if (guild_members::doWeCacheGuildMembers()) {
 			guild_members::insertGuildMember(static_cast<guild_member_cache_data>(value));
 		}
 		if (guilds::doWeCacheGuilds()) {
-			if (guilds::getCache().contains(value.guildId)) {
-				++guilds::getCache()[value.guildId].memberCount;
-				guilds::getCache()[value.guildId].members.emplace_back(value.user.id);
-			}
+			guilds::getCache().update(value.guildId, [&](guild_cache_data& guild) {
+				++guild.memberCount;
+			});
 		}
 	}
 
@@ -528,24 +537,23 @@ namespace discord_core_api {
 				message_printer::printError<print_message_type::general>(valueNew.reportError());
 			}
 		}
+		permission_engine::removeGuildMember(value.guildId, value.user.id);
 		if (guild_members::doWeCacheGuildMembers()) {
 			guild_member_data guildMember = guild_members::getCachedGuildMember({ .guildMemberId = value.user.id, .guildId = value.guildId });
 			guild_members::removeGuildMember(guildMember);
 		}
 		if (guilds::doWeCacheGuilds()) {
-			if (guilds::getCache().contains(value.guildId)) {
-				for (uint64_t x = 0; x < guilds::getCache().operator[](value.guildId).members.size(); ++x) {
-					if (guilds::getCache().operator[](value.guildId).members.at(x) == static_cast<uint64_t>(value.user.id)) {
-						guilds::getCache().operator[](value.guildId).members.erase(guilds::getCache().operator[](value.guildId).members.begin() + static_cast<int64_t>(x));
-						--guilds::getCache()[value.guildId].memberCount;
-					}
+			guilds::getCache().update(value.guildId, [&](guild_cache_data& guild) {
+				if (guild.memberCount > 0) {
+					--guild.memberCount;
 				}
-			}
+			});
 		}
 	}
 
 	on_guild_member_update_data::on_guild_member_update_data(jsonifier::jsonifier_core& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
 		parserNew.parseJson(*static_cast<updated_event_data*>(this), dataToParse);
+		permission_engine::insertGuildMember(value.guildId, value);
 		if (guild_members::doWeCacheGuildMembers()) {
 			oldValue = guild_members::getCachedGuildMember({ .guildMemberId = value.user.id, .guildId = value.guildId });
 			guild_members::insertGuildMember(static_cast<guild_member_cache_data>(value));
@@ -559,27 +567,38 @@ namespace discord_core_api {
 				message_printer::printError<print_message_type::general>(valueNew.reportError());
 			}
 		}
+		for (auto& valueNew: value.members) {
+			permission_engine::insertGuildMember(value.guildId, valueNew);
+		}
 	}
 
 	on_role_creation_data::on_role_creation_data(jsonifier::jsonifier_core& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
 		parserNew.parseJson(*static_cast<event_data*>(this), dataToParse);
+		discord_core_internal::https_response_cache::invalidate("/guilds/" + value.guildId + "/roles");
+		discord_core_internal::https_response_cache::invalidate("/guilds/" + value.guildId);
 		if (auto result = parserNew.getErrors(); result.size() > 0) {
 			for (auto& valueNew: result) {
 				message_printer::printError<print_message_type::general>(valueNew.reportError());
 			}
 		}
+		permission_engine::insertRole(value.guildId, value.role);
 		if (roles::doWeCacheRoles()) {
 			roles::insertRole(static_cast<role_cache_data>(value.role));
 		}
 		if (guilds::doWeCacheGuilds()) {
-			if (guilds::getCache().contains(value.guildId)) {
-				guilds::getCache()[value.guildId].roles.emplace_back(value.role.id);
-			}
+			guilds::getCache().update(value.guildId, [&](guild_cache_data& guild) {
+				if (cache_projection<guild_cache_data>::keeps(guild_cache_fields::roles)) {
+					guild.roles.emplace_back(value.role.id);
+				}
+			});
 		}
 	}
 
 	on_role_update_data::on_role_update_data(jsonifier::jsonifier_core& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
 		parserNew.parseJson(*static_cast<updated_event_data*>(this), dataToParse);
+		discord_core_internal::https_response_cache::invalidate("/guilds/" + value.guildId + "/roles");
+		discord_core_internal::https_response_cache::invalidate("/guilds/" + value.guildId);
+		permission_engine::insertRole(value.guildId, value.role);
 		if (roles::doWeCacheRoles()) {
 			oldValue = roles::getCachedRole({ .guildId = value.guildId, .roleId = value.role.id });
 			roles::insertRole(static_cast<role_cache_data>(value.role));
@@ -588,22 +607,25 @@ namespace discord_core_api {
 
 	on_role_deletion_data::on_role_deletion_data(jsonifier::jsonifier_core& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
 		parserNew.parseJson(*static_cast<event_data*>(this), dataToParse);
+		discord_core_internal::https_response_cache::invalidate("/guilds/" + value.guildId + "/roles");
+		discord_core_internal::https_response_cache::invalidate("/guilds/" + value.guildId);
 		if (auto result = parserNew.getErrors(); result.size() > 0) {
 			for (auto& valueNew: result) {
 				message_printer::printError<print_message_type::general>(valueNew.reportError());
 			}
 		}
+		permission_engine::removeRole(value.guildId, value.role.id);
 		if (roles::doWeCacheRoles()) {
 			roles::removeRole(static_cast<role_cache_data>(value.role));
 		}
 		if (guilds::doWeCacheGuilds()) {
-			if (guilds::getCache().contains(value.guildId)) {
-				for (uint64_t x = 0; x < guilds::getCache().operator[](value.guildId).roles.size(); ++x) {
-					if (guilds::getCache().operator[](value.guildId).roles.at(x) == static_cast<uint64_t>(value.role.id)) {
-						guilds::getCache().operator[](value.guildId).roles.erase(guilds::getCache().operator[](value.guildId).roles.begin() + static_cast<int64_t>(x));
+			guilds::getCache().update(value.guildId, [&](guild_cache_data& guild) {
+				for (uint64_t x = 0; x < guild.roles.size(); ++x) {
+					if (guild.roles.at(x) == static_cast<uint64_t>(value.role.id)) {
+						guild.roles.erase(guild.roles.begin() + static_cast<int64_t>(x));
 					}
 				}
-			}
+			});
 		}
 	}
 
@@ -777,9 +799,9 @@ namespace discord_core_api {
 			case interaction_type::Application_Command_Autocomplete: {
 				eventData->responseType	   = input_event_response_type::unset;
 				eventData->interactionData = makeUnique<interaction_data>(value);
-				unique_ptr<on_auto_complete_entry_data> autocompleteEntryData{ makeUnique<on_auto_complete_entry_data>(parser, dataToParse) };
+				auto autocompleteEntryData{ std::make_shared<on_auto_complete_entry_data>(parser, dataToParse) };
 				autocompleteEntryData->value = *eventData;
-				discord_core_client::getInstance()->getEventManager().onAutoCompleteEntryEvent(*autocompleteEntryData);
+				discord_core_client::getInstance()->getEventManager().onAutoCompleteEntryEvent(std::move(autocompleteEntryData));
 				break;
 			}
 			case interaction_type::Ping: {
@@ -0,0 +1,108 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// EventQueue.cpp - Source file for the per-guild ordered event queues.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file EventQueue.cpp
+
+#include <discordcoreapi/Utilities/EventQueue.hpp>
+#include <discordcoreapi/CoRoutine.hpp>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		bool ordered_event_queue::enqueue(uint64_t key, task_type&& task) {
+			if (!acceptingTasks.load(std::memory_order_acquire)) {
+				return false;
+			}
+			auto& shard = getShard(key);
+			std::unique_lock lock{ shard.queueMutex };
+			if (auto iter = shard.queues.find(key); iter != shard.queues.end()) {
+				iter->second.emplace_back(std::move(task));
+				return true;
+			}
+			shard.queues[key].emplace_back(std::move(task));
+			lock.unlock();
+			drainQueue(key);
+			return true;
+		}
+
+		void ordered_event_queue::stopAndWait() {
+			acceptingTasks.store(false, std::memory_order_release);
+			while (activeKeys() > 0) {
+				std::this_thread::sleep_for(1ms);
+			}
+		}
+
+		uint64_t ordered_event_queue::activeKeys() const {
+			uint64_t returnValue{};
+			for (auto& value: shards) {
+				std::unique_lock lock{ value.queueMutex };
+				returnValue += value.queues.size();
+			}
+			return returnValue;
+		}
+
+		detached_task ordered_event_queue::drainQueue(uint64_t key) {
+			runQueue(key);
+			co_return;
+		}
+
+		void ordered_event_queue::runQueue(uint64_t key) {
+			auto& shard = getShard(key);
+			while (true) {
+				task_type task{};
+				{
+					std::unique_lock lock{ shard.queueMutex };
+					auto iter = shard.queues.find(key);
+					if (iter->second.empty()) {
+						shard.queues.erase(iter);
+						return;
+					}
+					task = std::move(iter->second.front());
+					iter->second.pop_front();
+				}
+				auto state		= std::make_shared<task_state>();
+				auto onComplete = [this, key, state]() {
+					if (!state->completed.exchange(true, std::memory_order_acq_rel) && state->arrivals.fetch_add(1, std::memory_order_acq_rel) == 1) {
+						drainQueue(key);
+					}
+				};
+				try {
+					task(onComplete);
+				} catch (const std::exception& error) {
+					message_printer::printError<print_message_type::general>(error.what());
+					onComplete();
+				}
+				// the task is still running asynchronously - its completion will relaunch the drain.
+				if (state->arrivals.fetch_add(1, std::memory_order_acq_rel) == 0) {
+					return;
+				}
+			}
+		}
+	}
+}
@@ -70,14 +70,15 @@ namespace discord_core_api {
 
 		https_workload_data& https_workload_data::operator=(https_workload_data&& other) noexcept {
 			if (this != &other) {
-				headersToInsert = std::move(other.headersToInsert);
-				relativePath	= std::move(other.relativePath);
-				callStack		= std::move(other.callStack);
-				baseUrl			= std::move(other.baseUrl);
-				content			= std::move(other.content);
-				workloadClass	= other.workloadClass;
-				workloadType	= other.workloadType;
-				payloadType		= other.payloadType;
+				multipartContent = std::move(other.multipartContent);
+				headersToInsert	 = std::move(other.headersToInsert);
+				relativePath	 = std::move(other.relativePath);
+				callStack		 = std::move(other.callStack);
+				baseUrl			 = std::move(other.baseUrl);
+				content			 = std::move(other.content);
+				workloadClass	 = other.workloadClass;
+				workloadType	 = other.workloadType;
+				payloadType		 = other.payloadType;
 			}
 			return *this;
 		}
@@ -123,7 +123,17 @@ namespace discord_core_api {
 		return discord_core_client::getInstance();
 	}
 
+	template<typename value_type> inline jsonifier::vector<snowflake> collectIds(const jsonifier::vector<value_type>& values) {
+		jsonifier::vector<snowflake> returnData{};
+		returnData.reserve(values.size());
+		for (auto& value: values) {
+			returnData.emplace_back(value.id);
+		}
+		return returnData;
+	}
+
 	guild_cache_data& guild_cache_data::operator=(const guild_data& other) {
+		using projection = cache_projection<guild_cache_data>;
 		setFlagValue(guild_flags::Premium_Progress_Bar_Enabled, other.premiumProgressBarEnabled);
 		setFlagValue(guild_flags::Widget_enabled, other.widgetEnabled);
 		setFlagValue(guild_flags::Unavailable, other.unavailable);
@@ -137,40 +147,37 @@ namespace discord_core_api {
 		if (static_cast<int64_t>(other.flags) != 0) {
 			flags = other.flags;
 		}
-		for (auto& value: other.channels) {
-			channels.emplace_back(value.id);
-		}
-		for (auto& value: other.members) {
-			members.emplace_back(value.user.id);
+		if (projection::keeps(guild_cache_fields::channels)) {
+			channels = collectIds(other.channels);
 		}
-		for (auto& value: other.roles) {
-			roles.emplace_back(value.id);
+		if (projection::keeps(guild_cache_fields::roles)) {
+			roles = collectIds(other.roles);
 		}
-		for (auto& value: other.emoji) {
-			emoji.emplace_back(value.id);
+		if (projection::keeps(guild_cache_fields::emoji)) {
+			emoji = collectIds(other.emoji);
 		}
-		if (other.discoverySplash != "") {
+		if (projection::keeps(guild_cache_fields::discovery_splash) && other.discoverySplash != "") {
 			discoverySplash = other.discoverySplash;
 		}
-		if (other.memberCount != 0) {
+		if (projection::keeps(guild_cache_fields::member_count) && other.memberCount != 0) {
 			memberCount = other.memberCount;
 		}
-		if (other.discovery != "") {
+		if (projection::keeps(guild_cache_fields::discovery) && other.discovery != "") {
 			discovery = other.discovery;
 		}
-		if (other.ownerId != 0) {
+		if (projection::keeps(guild_cache_fields::owner_id) && other.ownerId != 0) {
 			ownerId = other.ownerId;
 		}
-		if (other.banner != "") {
+		if (projection::keeps(guild_cache_fields::banner) && other.banner != "") {
 			banner = other.banner;
 		}
-		if (other.splash != "") {
+		if (projection::keeps(guild_cache_fields::splash) && other.splash != "") {
 			splash = other.splash;
 		}
-		if (other.icon != "") {
+		if (projection::keeps(guild_cache_fields::icon) && other.icon != "") {
 			icon = other.icon;
 		}
-		if (other.name != "") {
+		if (projection::keeps(guild_cache_fields::name) && other.name != "") {
 			name = other.name;
 		}
 		if (other.id != 0) {
@@ -184,12 +191,13 @@ namespace discord_core_api {
 	}
 
 	guild_cache_data& guild_cache_data::operator=(guild_data&& other) noexcept {
+		using projection = cache_projection<guild_cache_data>;
 		setFlagValue(guild_flags::Premium_Progress_Bar_Enabled, other.premiumProgressBarEnabled);
 		setFlagValue(guild_flags::Widget_enabled, other.widgetEnabled);
 		setFlagValue(guild_flags::Unavailable, other.unavailable);
 		setFlagValue(guild_flags::Large, other.large);
 		setFlagValue(guild_flags::Owner, other.owner);
-		if (other.discoverySplash != "") {
+		if (projection::keeps(guild_cache_fields::discovery_splash) && other.discoverySplash != "") {
 			discoverySplash = std::move(other.discoverySplash);
 		}
 		if (other.voiceConnection) {
@@ -198,37 +206,34 @@ namespace discord_core_api {
 		if (static_cast<int64_t>(other.flags) != 0) {
 			flags = other.flags;
 		}
-		if (other.discovery != "") {
+		if (projection::keeps(guild_cache_fields::discovery) && other.discovery != "") {
 			discovery = std::move(other.discovery);
 		}
-		for (auto& value: other.channels) {
-			channels.emplace_back(value.id);
+		if (projection::keeps(guild_cache_fields::channels)) {
+			channels = collectIds(other.channels);
 		}
-		for (auto& value: other.members) {
-			members.emplace_back(value.user.id);
+		if (projection::keeps(guild_cache_fields::roles)) {
+			roles = collectIds(other.roles);
 		}
-		for (auto& value: other.roles) {
-			roles.emplace_back(value.id);
+		if (projection::keeps(guild_cache_fields::emoji)) {
+			emoji = collectIds(other.emoji);
 		}
-		for (auto& value: other.emoji) {
-			emoji.emplace_back(value.id);
-		}
-		if (other.memberCount != 0) {
+		if (projection::keeps(guild_cache_fields::member_count) && other.memberCount != 0) {
 			memberCount = other.memberCount;
 		}
-		if (other.banner != "") {
+		if (projection::keeps(guild_cache_fields::banner) && other.banner != "") {
 			banner = std::move(other.banner);
 		}
-		if (other.splash != "") {
+		if (projection::keeps(guild_cache_fields::splash) && other.splash != "") {
 			splash = std::move(other.splash);
 		}
-		if (other.icon != "") {
+		if (projection::keeps(guild_cache_fields::icon) && other.icon != "") {
 			icon = std::move(other.icon);
 		}
-		if (other.name != "") {
+		if (projection::keeps(guild_cache_fields::name) && other.name != "") {
 			name = std::move(other.name);
 		}
-		if (other.ownerId != 0) {
+		if (projection::keeps(guild_cache_fields::owner_id) && other.ownerId != 0) {
 			ownerId = other.ownerId;
 		}
 		if (other.id != 0) {
@@ -249,15 +254,9 @@ namespace discord_core_api {
 				returnData.channels.emplace_back(newChannel);
 			}
 		}
-		for (auto& value: members) {
-			if (guild_members::doWeCacheGuildMembers()) {
-				returnData.members.emplace_back(guild_members::getCachedGuildMember({ .guildMemberId = value, .guildId = id }));
-			} else {
-				guild_member_data newChannel{};
-				newChannel.guildId = id;
-				newChannel.user.id = value;
-				returnData.members.emplace_back(newChannel);
-			}
+		// the index only holds cached guild_members, so each of them can be looked up.
+		for (auto& value: guild_members::getCachedGuildMemberIds(id)) {
+			returnData.members.emplace_back(guild_members::getCachedGuildMember({ .guildMemberId = value, .guildId = id }));
 		}
 		for (auto& value: roles) {
 			if (roles::doWeCacheRoles()) {
@@ -318,6 +317,7 @@ namespace discord_core_api {
 	void guilds::initialize(discord_core_internal::https_client* client, config_manager* configManagerNew) {
 		guilds::doWeCacheGuildsBool = configManagerNew->doWeCacheGuilds();
 		guilds::httpsClient			= client;
+		guilds::cache.setEvictionPolicy(configManagerNew->getCacheOptions().guildPolicy);
 		stopWatchNew.reset();
 	}
 
@@ -373,9 +373,9 @@ namespace discord_core_api {
 
 	jsonifier::vector<guild_data> guilds::getAllGuildsAsync() {
 		jsonifier::vector<guild_data> returnData{};
-		for (auto& value: guilds::cache) {
-			returnData.emplace_back(*value);
-		}
+		guilds::cache.visit([&](const guild_cache_data& value) {
+			returnData.emplace_back(value);
+		});
 		return returnData;
 	}
 
@@ -387,8 +387,8 @@ namespace discord_core_api {
 		workload.callStack	   = "guilds::getGuildAsync()";
 		guild_data data{ dataPackage.guildId };
 		;
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
+		if (auto cachedData = cache.find(data.id)) {
+			data = *cachedData;
 		}
 		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
 		if (doWeCacheGuildsBool) {
@@ -398,13 +398,26 @@ namespace discord_core_api {
 	}
 
 	guild_cache_data guilds::getCachedGuild(const get_guild_data dataPackage) {
-		if (guilds::cache.contains(dataPackage.guildId)) {
-			return cache[dataPackage.guildId];
+		if (auto cachedData = guilds::cache.find(dataPackage.guildId)) {
+			return *cachedData;
+		} else if (auto snapshotData = cache_snapshot::take<guild_cache_data>(dataPackage.guildId)) {
+			insertGuild(*snapshotData);
+			return *snapshotData;
 		} else {
 			return getGuildAsync({ .guildId = dataPackage.guildId }).get();
 		}
 	}
 
+	cache_view<guild_cache_data> guilds::getCachedGuildView(const get_guild_data dataPackage) {
+		if (auto cachedData = cache.view(dataPackage.guildId)) {
+			return cachedData;
+		}
+		if (auto snapshotData = cache_snapshot::take<guild_cache_data>(dataPackage.guildId)) {
+			insertGuild(std::move(*snapshotData));
+		}
+		return cache.view(dataPackage.guildId);
+	}
+
 	co_routine<guild_preview_data> guilds::getGuildPreviewAsync(const get_guild_preview_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Get_Guild_Preview };
 		co_await newThreadAwaitable<guild_preview_data>();
@@ -427,8 +440,8 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		guild_data data{ dataPackage.guildId };
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
+		if (auto cachedData = cache.find(data.id)) {
+			data = *cachedData;
 		}
 		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
 		if (doWeCacheGuildsBool) {
@@ -474,6 +487,26 @@ namespace discord_core_api {
 		co_return returnData;
 	}
 
+	paginator<jsonifier::vector<ban_data>, get_guild_bans_data> guilds::getGuildBansPaginated(get_guild_bans_data dataPackage, uint64_t prefetchWindow) {
+		if (dataPackage.limit == 0) {
+			dataPackage.limit = 1000;
+		}
+		return paginator<jsonifier::vector<ban_data>, get_guild_bans_data>{ dataPackage, &guilds::getGuildBansAsync,
+			[](get_guild_bans_data& dataPackageNew, const jsonifier::vector<ban_data>& page) {
+				if (page.size() < dataPackageNew.limit) {
+					return false;
+				}
+				bool doWeAscend{ dataPackageNew.before == 0 };
+				advanceSnowflakeCursor(doWeAscend ? dataPackageNew.after : dataPackageNew.before, page,
+					[](const ban_data& value) -> const snowflake& {
+						return value.user.id;
+					},
+					doWeAscend);
+				return true;
+			},
+			prefetchWindow };
+	}
+
 	co_routine<ban_data> guilds::getGuildBanAsync(const get_guild_ban_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Get_Guild_Ban };
 		co_await newThreadAwaitable<ban_data>();
@@ -874,6 +907,7 @@ namespace discord_core_api {
 	}
 
 	void guilds::removeGuild(const guild_cache_data& guildId) {
+		cache_snapshot::discard<guild_cache_data>(guildId.id);
 		guilds::cache.erase(guildId);
 	};
 
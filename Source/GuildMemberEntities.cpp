@@ -57,16 +57,17 @@ namespace jsonifier {
 namespace discord_core_api {
 
 	guild_member_cache_data& guild_member_cache_data::operator=(const guild_member_data& other) {
+		using projection = cache_projection<guild_member_cache_data>;
 		if (static_cast<int64_t>(other.flags) != 0) {
 			flags = other.flags;
 		}
 		setFlagValue(guild_member_flags::Pending, other.pending);
 		setFlagValue(guild_member_flags::Deaf, other.deaf);
 		setFlagValue(guild_member_flags::Mute, other.mute);
-		if (other.permissions.operator std::string_view() != "") {
+		if (projection::keeps(guild_member_cache_fields::permissions) && other.permissions.operator std::string_view() != "") {
 			permissionsVal = other.permissions;
 		}
-		if (other.joinedAt != "") {
+		if (projection::keeps(guild_member_cache_fields::joined_at) && other.joinedAt != "") {
 			joinedAt = other.joinedAt;
 		}
 		if (other.user.id != 0) {
@@ -75,13 +76,13 @@ namespace discord_core_api {
 		if (other.guildId != 0) {
 			guildId = other.guildId;
 		}
-		if (other.avatar != "") {
+		if (projection::keeps(guild_member_cache_fields::avatar) && other.avatar != "") {
 			avatar = other.avatar;
 		}
-		if (other.roles.size() > 0) {
+		if (projection::keeps(guild_member_cache_fields::roles) && other.roles.size() > 0) {
 			roles = other.roles;
 		}
-		if (other.nick != "") {
+		if (projection::keeps(guild_member_cache_fields::nick) && other.nick != "") {
 			nick = other.nick;
 		}
 		return *this;
@@ -92,25 +93,26 @@ namespace discord_core_api {
 	}
 
 	guild_member_cache_data& guild_member_cache_data::operator=(guild_member_data&& other) noexcept {
+		using projection = cache_projection<guild_member_cache_data>;
 		if (static_cast<int64_t>(other.flags) != 0) {
 			flags = other.flags;
 		}
 		setFlagValue(guild_member_flags::Pending, other.pending);
 		setFlagValue(guild_member_flags::Deaf, other.deaf);
 		setFlagValue(guild_member_flags::Mute, other.mute);
-		if (other.permissions.operator std::string_view() != "") {
+		if (projection::keeps(guild_member_cache_fields::permissions) && other.permissions.operator std::string_view() != "") {
 			permissionsVal = std::move(other.permissions);
 		}
-		if (other.joinedAt != "") {
+		if (projection::keeps(guild_member_cache_fields::joined_at) && other.joinedAt != "") {
 			joinedAt = std::move(other.joinedAt);
 		}
-		if (other.avatar != "") {
+		if (projection::keeps(guild_member_cache_fields::avatar) && other.avatar != "") {
 			avatar = std::move(other.avatar);
 		}
-		if (other.roles.size() > 0) {
+		if (projection::keeps(guild_member_cache_fields::roles) && other.roles.size() > 0) {
 			roles = std::move(other.roles);
 		}
-		if (other.nick != "") {
+		if (projection::keeps(guild_member_cache_fields::nick) && other.nick != "") {
 			nick = std::move(other.nick);
 		}
 		if (other.user.id != 0) {
@@ -143,9 +145,25 @@ namespace discord_core_api {
 	}
 
 	void guild_members::initialize(discord_core_internal::https_client* client, config_manager* configManagerNew) {
-		guild_members::doWeCacheGuildMembersBool = configManagerNew->doWeCacheGuildMembers();
-		guild_members::doWeCacheVoiceStatesBool	 = configManagerNew->doWeCacheVoiceStates();
-		guild_members::httpsClient				 = client;
+		guild_members::doWeUseCompactGuildMembersBool = configManagerNew->doWeUseCompactGuildMembers();
+		guild_members::doWeCacheGuildMembersBool	  = configManagerNew->doWeCacheGuildMembers();
+		guild_members::doWeCacheVoiceStatesBool		  = configManagerNew->doWeCacheVoiceStates();
+		guild_members::httpsClient					  = client;
+		guild_members::cache.setEvictionPolicy(configManagerNew->getCacheOptions().guildMemberPolicy);
+		guild_members::vsCache.setEvictionPolicy(configManagerNew->getCacheOptions().voiceStatePolicy);
+		// evicted objects have to leave the secondary indices too.
+		guild_members::cache.setEvictionHandler([](const guild_member_cache_data& guildMember) {
+			for (auto& value: guildMember.roles) {
+				roleMemberIndex.erase(two_id_key{ guildMember.guildId, value }, guildMember.user.id);
+			}
+			guildMemberIndex.erase(guildMember.guildId, guildMember.user.id);
+		});
+		guild_members::vsCache.setEvictionHandler([](const voice_state_data_light& voiceState) {
+			if (voiceState.channelId != 0) {
+				channelVoiceStateIndex.erase(two_id_key{ voiceState.guildId, voiceState.channelId }, voiceState.userId);
+			}
+			guildVoiceStateIndex.erase(voiceState.guildId, voiceState.userId);
+		});
 	}
 
 	co_routine<guild_member_data> guild_members::getGuildMemberAsync(const get_guild_member_data dataPackage) {
@@ -158,8 +176,8 @@ namespace discord_core_api {
 		data.user.id = dataPackage.guildMemberId;
 		data.guildId = dataPackage.guildId;
 		two_id_key key{ data };
-		if (cache.contains(key)) {
-			data = cache[key];
+		if (auto cachedData = doWeUseCompactGuildMembersBool ? compactCache.find(data.guildId, data.user.id) : cache.find(key)) {
+			data = *cachedData;
 		}
 		guild_members::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
 		if (doWeCacheGuildMembersBool) {
@@ -173,13 +191,32 @@ namespace discord_core_api {
 		data.user.id = dataPackage.guildMemberId;
 		data.guildId = dataPackage.guildId;
 		two_id_key key{ data };
-		if (cache.contains(key)) {
-			return cache[key];
+		if (auto cachedData = doWeUseCompactGuildMembersBool ? compactCache.find(data.guildId, data.user.id) : cache.find(key)) {
+			return *cachedData;
+		} else if (auto snapshotData = cache_snapshot::take<guild_member_cache_data>(data.guildId, data.user.id)) {
+			insertGuildMember(*snapshotData);
+			return *snapshotData;
 		} else {
 			return getGuildMemberAsync({ .guildMemberId = dataPackage.guildMemberId, .guildId = dataPackage.guildId }).get();
 		}
 	}
 
+	cache_view<guild_member_cache_data> guild_members::getCachedGuildMemberView(const get_guild_member_data dataPackage) {
+		guild_member_cache_data data{};
+		data.user.id = dataPackage.guildMemberId;
+		data.guildId = dataPackage.guildId;
+		if (doWeUseCompactGuildMembersBool) {
+			return {};
+		}
+		if (auto cachedData = cache.view(two_id_key{ data })) {
+			return cachedData;
+		}
+		if (auto snapshotData = cache_snapshot::take<guild_member_cache_data>(data.guildId, data.user.id)) {
+			insertGuildMember(std::move(*snapshotData));
+		}
+		return cache.view(two_id_key{ data });
+	}
+
 	co_routine<jsonifier::vector<guild_member_data>> guild_members::listGuildMembersAsync(const list_guild_members_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Get_Guild_Members };
 		co_await newThreadAwaitable<jsonifier::vector<guild_member_data>>();
@@ -199,6 +236,26 @@ namespace discord_core_api {
 		co_return returnData;
 	}
 
+	paginator<jsonifier::vector<guild_member_data>, list_guild_members_data> guild_members::listGuildMembersPaginated(list_guild_members_data dataPackage,
+		uint64_t prefetchWindow) {
+		if (dataPackage.limit == 0) {
+			dataPackage.limit = 1000;
+		}
+		return paginator<jsonifier::vector<guild_member_data>, list_guild_members_data>{ dataPackage, &guild_members::listGuildMembersAsync,
+			[](list_guild_members_data& dataPackageNew, const jsonifier::vector<guild_member_data>& page) {
+				if (page.size() < static_cast<uint64_t>(dataPackageNew.limit)) {
+					return false;
+				}
+				advanceSnowflakeCursor(dataPackageNew.after, page,
+					[](const guild_member_data& value) -> const snowflake& {
+						return value.user.id;
+					},
+					true);
+				return true;
+			},
+			prefetchWindow };
+	}
+
 	co_routine<jsonifier::vector<guild_member_data>> guild_members::searchGuildMembersAsync(const search_guild_members_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Get_Search_Guild_Members };
 		co_await newThreadAwaitable<jsonifier::vector<guild_member_data>>();
@@ -259,8 +316,8 @@ namespace discord_core_api {
 		data.user.id = dataPackage.guildMemberId;
 		data.guildId = dataPackage.guildId;
 		two_id_key key{ data };
-		if (cache.contains(key)) {
-			data = cache[key];
+		if (auto cachedData = doWeUseCompactGuildMembersBool ? compactCache.find(data.guildId, data.user.id) : cache.find(key)) {
+			data = *cachedData;
 		}
 		guild_members::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
 		if (doWeCacheGuildMembersBool) {
@@ -338,21 +395,91 @@ namespace discord_core_api {
 	}
 
 	voice_state_data_light guild_members::getVoiceStateData(const two_id_key& key) {
-		if (vsCache.contains(key)) {
-			return vsCache[key];
+		if (auto cachedData = vsCache.find(key)) {
+			return *cachedData;
 		} else {
 			return {};
 		}
 	}
 
 	void guild_members::removeGuildMember(const two_id_key& key) {
-		cache.erase(key);
+		for (auto& value: getCachedRoleIds(key)) {
+			roleMemberIndex.erase(two_id_key{ key.idOne, value }, key.idTwo);
+		}
+		guildMemberIndex.erase(key.idOne, key.idTwo);
+		cache_snapshot::discard<guild_member_cache_data>(key.idOne, key.idTwo);
+		if (doWeUseCompactGuildMembersBool) {
+			compactCache.erase(key.idOne, key.idTwo);
+		} else {
+			cache.erase(key);
+		}
 	};
 
 	void guild_members::removeVoiceState(const two_id_key& key) {
+		if (auto cachedData = vsCache.find(key); cachedData && cachedData->channelId != 0) {
+			channelVoiceStateIndex.erase(two_id_key{ key.idOne, cachedData->channelId }, key.idTwo);
+		}
+		guildVoiceStateIndex.erase(key.idOne, key.idTwo);
 		vsCache.erase(key);
 	}
 
+	void guild_members::removeGuildMembers(snowflake guildId) {
+		for (auto& value: guildMemberIndex.extract(guildId)) {
+			removeGuildMember(two_id_key{ guildId, value });
+		}
+	}
+
+	void guild_members::removeVoiceStates(snowflake guildId) {
+		for (auto& value: guildVoiceStateIndex.extract(guildId)) {
+			removeVoiceState(two_id_key{ guildId, value });
+		}
+	}
+
+	jsonifier::vector<snowflake> guild_members::getCachedGuildMemberIds(snowflake guildId) {
+		return guildMemberIndex.collect(guildId);
+	}
+
+	jsonifier::vector<snowflake> guild_members::getCachedGuildMemberIdsWithRole(snowflake guildId, snowflake roleId) {
+		return roleMemberIndex.collect(two_id_key{ guildId, roleId });
+	}
+
+	jsonifier::vector<snowflake> guild_members::getVoiceChannelOccupantIds(snowflake guildId, snowflake channelId) {
+		return channelVoiceStateIndex.collect(two_id_key{ guildId, channelId });
+	}
+
+	void guild_members::indexGuildMember(const guild_member_cache_data& guildMember) {
+		for (auto& value: getCachedRoleIds(two_id_key{ guildMember })) {
+			if (std::find(guildMember.roles.begin(), guildMember.roles.end(), value) == guildMember.roles.end()) {
+				roleMemberIndex.erase(two_id_key{ guildMember.guildId, value }, guildMember.user.id);
+			}
+		}
+		for (auto& value: guildMember.roles) {
+			roleMemberIndex.insert(two_id_key{ guildMember.guildId, value }, guildMember.user.id);
+		}
+		guildMemberIndex.insert(guildMember.guildId, guildMember.user.id);
+	}
+
+	void guild_members::indexVoiceState(const voice_state_data_light& voiceState) {
+		if (auto cachedData = vsCache.find(two_id_key{ voiceState }); cachedData && cachedData->channelId != 0 && cachedData->channelId != voiceState.channelId) {
+			channelVoiceStateIndex.erase(two_id_key{ voiceState.guildId, cachedData->channelId }, voiceState.userId);
+		}
+		if (voiceState.channelId != 0) {
+			channelVoiceStateIndex.insert(two_id_key{ voiceState.guildId, voiceState.channelId }, voiceState.userId);
+		}
+		guildVoiceStateIndex.insert(voiceState.guildId, voiceState.userId);
+	}
+
+	jsonifier::vector<snowflake> guild_members::getCachedRoleIds(const two_id_key& key) {
+		if (doWeUseCompactGuildMembersBool) {
+			if (auto cachedData = compactCache.find(key.idOne, key.idTwo)) {
+				return std::move(cachedData->roles);
+			}
+		} else if (auto cachedData = cache.view(key)) {
+			return cachedData->roles;
+		}
+		return {};
+	}
+
 	bool guild_members::doWeCacheGuildMembers() {
 		return guild_members::doWeCacheGuildMembersBool;
 	}
@@ -361,8 +488,19 @@ namespace discord_core_api {
 		return guild_members::doWeCacheVoiceStatesBool;
 	}
 
+	uint64_t guild_members::getCompactBytesPerMember() {
+		auto memberCount = compactCache.count();
+		return memberCount > 0 ? compactCache.getMemoryUsage() / memberCount : 0;
+	}
+
 	object_cache<voice_state_data_light> guild_members::vsCache{};
 	object_cache<guild_member_cache_data> guild_members::cache{};
+	guild_member_store<> guild_members::compactCache{};
+	secondary_index<two_id_key> guild_members::channelVoiceStateIndex{};
+	secondary_index<two_id_key> guild_members::roleMemberIndex{};
+	secondary_index<snowflake> guild_members::guildVoiceStateIndex{};
+	secondary_index<snowflake> guild_members::guildMemberIndex{};
+	bool guild_members::doWeUseCompactGuildMembersBool{};
 	discord_core_internal::https_client* guild_members::httpsClient{};
 	bool guild_members::doWeCacheGuildMembersBool{};
 	bool guild_members::doWeCacheVoiceStatesBool{};
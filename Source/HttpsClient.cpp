@@ -36,23 +36,28 @@ namespace discord_core_api {
 
 	namespace discord_core_internal {
 
-		https_connection::https_connection(const jsonifier::string& baseUrlNew, const uint16_t portNew)
-			: tcp_connection<https_connection>{ baseUrlNew, portNew } {
+		https_connection::https_connection(const jsonifier::string& baseUrlNew, const uint16_t portNew, bool isItTlsNew)
+			: tcp_connection<https_connection>{ baseUrlNew, portNew, isItTlsNew } {
 		}
 
-		jsonifier::vector<jsonifier::string_view> tokenize(jsonifier::string_view in, const char* sep = "\r\n") {
-			jsonifier::string_view::size_type b = 0;
-			jsonifier::vector<jsonifier::string_view> result{};
+		/// @brief The response headers that are actually read by the library - everything else is skipped while parsing.
+		constexpr jsonifier::string_view recordedHeaders[]{ "content-length", "transfer-encoding", "content-encoding", "location", "x-ratelimit-bucket",
+			"x-ratelimit-reset-after", "x-ratelimit-remaining", "x-ratelimit-retry-after", "x-amz-meta-bitrate", "x-amz-meta-duration" };
 
-			while ((b = in.findFirstNotOf(sep, b)) != jsonifier::string_view::npos) {
-				auto e = in.find(sep, b);
-				if (b + (e - b) > in.size()) {
-					break;
+		bool isItARecordedHeader(jsonifier::string_view key) {
+			for (auto& value: recordedHeaders) {
+				if (value.size() != key.size()) {
+					continue;
+				}
+				uint64_t x{};
+				while (x < key.size() && std::tolower(static_cast<uint8_t>(key[x])) == value[x]) {
+					++x;
+				}
+				if (x == key.size()) {
+					return true;
 				}
-				result.emplace_back(in.substr(b, e - b));
-				b = e;
 			}
-			return result;
+			return false;
 		}
 
 		uint64_t parseCode(jsonifier::string_view string) {
@@ -61,47 +66,84 @@ namespace discord_core_api {
 				return 0;
 			}
 
-			while (std::isspace(string[start])) {
+			while (start < string.size() && std::isspace(string[start])) {
 				start++;
 			}
 
-			uint64_t end = start;
-			while (std::isdigit(string[end])) {
-				end++;
+			uint64_t code{};
+			while (start < string.size() && std::isdigit(string[start])) {
+				code = code * 10 + static_cast<uint64_t>(string[start] - '0');
+				start++;
 			}
-			jsonifier::string_view codeStr = string.substr(start, end - start);
-			uint64_t code				   = jsonifier::strToUint64(codeStr.data());
 			return code;
 		}
 
+		uint64_t parseChunkSize(jsonifier::string_view string) {
+			uint64_t size{};
+			for (auto& value: string) {
+				if (value >= '0' && value <= '9') {
+					size = (size << 4) | static_cast<uint64_t>(value - '0');
+				} else if (value >= 'a' && value <= 'f') {
+					size = (size << 4) | static_cast<uint64_t>(value - 'a' + 10);
+				} else if (value >= 'A' && value <= 'F') {
+					size = (size << 4) | static_cast<uint64_t>(value - 'A' + 10);
+				} else {
+					// chunk extensions (";name=value") and trailing whitespace end the size.
+					break;
+				}
+			}
+			return size;
+		}
+
+		/// @brief The hosts whose responses are text (json, html or javascript), and so are worth compressing - media downloads come from their cdns instead, and
+		/// are already compressed.
+		constexpr jsonifier::string_view compressibleBaseUrls[]{ "https://discord.com/api/v10", "https://www.youtube.com", "https://music.youtube.com",
+			"https://soundcloud.com", "https://api-v2.soundcloud.com" };
+
+		bool isItCompressible(jsonifier::string_view baseUrl) {
+			for (auto& value: compressibleBaseUrls) {
+				if (baseUrl.size() >= value.size() && baseUrl.substr(0, value.size()) == value &&
+					(baseUrl.size() == value.size() || baseUrl[value.size()] == '/')) {
+					return true;
+				}
+			}
+			return false;
+		}
+
 		void https_connection::handleBuffer() {
-			do {
-				inputBufferReal += getInputBuffer();
+			inputBufferReal += getInputBuffer();
+			bool doWeContinue{ true };
+			while (doWeContinue) {
 				switch (data.currentState) {
 					case https_state::Collecting_Headers: {
-						if (!parseHeaders()) {
-							return;
-						}
+						doWeContinue = parseHeaders();
 						break;
 					}
 					case https_state::Collecting_Contents: {
-						if (!parseContents()) {
-							return;
-						}
+						doWeContinue = parseContents();
 						break;
 					}
 					case https_state::Collecting_Chunked_Contents: {
-						if (!parseChunk()) {
-							return;
-						}
+						doWeContinue = parseChunk();
 						break;
 					}
 					case https_state::complete: {
-						inputBufferReal.clear();
+						if (!data.isBodyInBuffer) {
+							inputBufferReal.clear();
+							data.parseOffset = 0;
+						}
 						return;
 					}
 				}
-			} while (inputBufferReal.size() > 0);
+			}
+			// drop whatever has been consumed, so that the buffer only ever holds the unparsed tail.
+			if (data.parseOffset >= inputBufferReal.size()) {
+				inputBufferReal.clear();
+				data.parseOffset = 0;
+			} else if (data.parseOffset > 0) {
+				inputBufferReal.erase(inputBufferReal.begin() + static_cast<int64_t>(data.parseOffset));
+				data.parseOffset = 0;
+			}
 			return;
 		}
 
@@ -129,9 +171,26 @@ namespace discord_core_api {
 
 		https_response_data https_rnr_builder::finalizeReturnValues(rate_limit_data& rateLimitData) {
 			auto connection{ static_cast<https_connection*>(this) };
-			if (connection->data.responseData.size() >= connection->data.contentLength && connection->data.contentLength > 0) {
-				connection->data.responseData = connection->data.responseData.substr(0, connection->data.contentLength);
-			} else {
+			if (connection->data.isBodyInBuffer) {
+				// hand the input buffer itself over as the body, and give the connection the (empty) body buffer to receive into next.
+				if (connection->data.bodyOffset > 0) {
+					connection->inputBufferReal.erase(connection->inputBufferReal.begin() + static_cast<int64_t>(connection->data.bodyOffset));
+				}
+				connection->inputBufferReal.resize(connection->data.contentLength);
+				std::swap(connection->data.responseData, connection->inputBufferReal);
+				connection->inputBufferReal.clear();
+				connection->data.isBodyInBuffer = false;
+				connection->data.bodyOffset		= 0;
+				connection->data.parseOffset	= 0;
+			} else if (connection->data.contentEncoding != content_encoding::identity) {
+				// decoded bodies are exactly as long as the inflater produced, and content-length refers to the encoded size.
+				connection->data.decodeTime = connection->decoder.getDecodeTime();
+				if (!connection->data.didDecodingFail) {
+					metrics::https.decodedBodies.record(connection->data.decodeTime);
+					metrics::https.encodedBodyBytes.add(connection->data.bytesOnWire);
+					metrics::https.decodedBodyBytes.add(connection->data.responseData.size());
+				}
+			} else if (connection->data.isItChunked || connection->data.contentLength == std::numeric_limits<uint64_t>::max()) {
 				auto pos1 = connection->data.responseData.findFirstOf('{');
 				auto pos2 = connection->data.responseData.findLastOf('}');
 				auto pos3 = connection->data.responseData.findFirstOf('[');
@@ -155,6 +214,7 @@ namespace discord_core_api {
 				baseUrlNew = workload.baseUrl.substr(workload.baseUrl.find("https://") + jsonifier::string_view("https://").size(),
 					workload.baseUrl.find(".org") + jsonifier::string_view(".org").size() - jsonifier::string_view("https://").size());
 			}
+			bool doWeAcceptEncoding{ isItCompressible(workload.baseUrl) };
 			jsonifier::string returnString{};
 			if (workload.workloadClass == https_workload_class::Get || workload.workloadClass == https_workload_class::Delete) {
 				if (workload.workloadClass == https_workload_class::Get) {
@@ -165,6 +225,9 @@ namespace discord_core_api {
 				for (auto& [key, value]: workload.headersToInsert) {
 					returnString += key + ": " + value + "\r\n";
 				}
+				if (doWeAcceptEncoding && !workload.headersToInsert.contains("Accept-Encoding")) {
+					returnString += "Accept-Encoding: gzip, deflate\r\n";
+				}
 				returnString += "Pragma: no-cache\r\n";
 				returnString += "Connection: keep-alive\r\n";
 				returnString += "Host: " + baseUrlNew + "\r\n\r\n";
@@ -179,118 +242,220 @@ namespace discord_core_api {
 				for (auto& [key, value]: workload.headersToInsert) {
 					returnString += key + ": " + value + "\r\n";
 				}
+				if (doWeAcceptEncoding && !workload.headersToInsert.contains("Accept-Encoding")) {
+					returnString += "Accept-Encoding: gzip, deflate\r\n";
+				}
 				returnString += "Pragma: no-cache\r\n";
 				returnString += "Connection: keep-alive\r\n";
 				returnString += "Host: " + baseUrlNew + "\r\n";
-				returnString += "Content-Length: " + jsonifier::toString(workload.content.size()) + "\r\n\r\n";
-				returnString += workload.content;
+				if (!workload.multipartContent.empty()) {
+					// the body itself gets streamed out after the headers, straight from its segments.
+					returnString += "Content-Length: " + jsonifier::toString(workload.multipartContent.size()) + "\r\n\r\n";
+				} else {
+					returnString += "Content-Length: " + jsonifier::toString(workload.content.size()) + "\r\n\r\n";
+					returnString += workload.content;
+				}
 			}
 			return returnString;
 		}
 
 		bool https_rnr_builder::parseHeaders() {
 			auto connection{ static_cast<https_connection*>(this) };
-			jsonifier::string& stringViewNew = connection->inputBufferReal;
-			if (stringViewNew.find("\r\n\r\n") != jsonifier::string_view::npos) {
-				auto headers = tokenize(stringViewNew);
-				if (headers.size() && (headers.at(0).find("HTTP/1") != jsonifier::string_view::npos)) {
-					uint64_t parseCodeNew{};
-					try {
-						parseCodeNew = parseCode(headers.at(0));
-					} catch (const std::invalid_argument& error) {
-						message_printer::printError<print_message_type::https>(error.what());
-						connection->data.currentState = https_state::complete;
+			jsonifier::string_view buffer{ connection->inputBufferReal.data() + connection->data.parseOffset,
+				connection->inputBufferReal.size() - connection->data.parseOffset };
+			auto headersEnd = buffer.find("\r\n\r\n", connection->data.headerScanOffset);
+			if (headersEnd == jsonifier::string_view::npos) {
+				// resume the search just before the current end, in case the terminator is split across reads.
+				connection->data.headerScanOffset = buffer.size() >= 3 ? buffer.size() - 3 : 0;
+				return false;
+			}
+			connection->data.parseOffset += headersEnd + 4;
+			connection->data.headerScanOffset = 0;
+			jsonifier::string_view headers{ buffer.data(), headersEnd + 2 };
+			auto lineEnd = headers.find("\r\n");
+			jsonifier::string_view statusLine{ headers.data(), lineEnd };
+			uint64_t parseCodeNew{};
+			if (statusLine.find("HTTP/1") != jsonifier::string_view::npos) {
+				parseCodeNew = parseCode(statusLine);
+			}
+			if (!parseCodeNew) {
+				message_printer::printError<print_message_type::https>("https_rnr_builder::parseHeaders() error: Malformed status line: " + static_cast<jsonifier::string>(statusLine));
+				connection->data.currentState = https_state::complete;
+				return true;
+			}
+			for (uint64_t pos = lineEnd + 2; pos < headers.size(); pos = lineEnd + 2) {
+				lineEnd = headers.find("\r\n", pos);
+				jsonifier::string_view line{ headers.data() + pos, lineEnd - pos };
+				auto sep = line.find(':');
+				if (sep == jsonifier::string_view::npos || !isItARecordedHeader(line.substr(0, sep))) {
+					continue;
+				}
+				jsonifier::string key = static_cast<jsonifier::string>(line.substr(0, sep));
+				for (auto& valueNew: key) {
+					valueNew = static_cast<char>(std::tolower(static_cast<int32_t>(valueNew)));
+				}
+				++sep;
+				while (sep < line.size() && line[sep] == ' ') {
+					++sep;
+				}
+				connection->data.responseHeaders.emplace(key, line.substr(sep));
+			}
+			connection->data.contentEncoding = content_encoding::identity;
+			if (connection->data.responseHeaders.contains("content-encoding")) {
+				jsonifier::string_view encoding{ connection->data.responseHeaders.at("content-encoding") };
+				if (encoding.find("gzip") != jsonifier::string_view::npos) {
+					connection->data.contentEncoding = content_encoding::gzip;
+				} else if (encoding.find("deflate") != jsonifier::string_view::npos) {
+					connection->data.contentEncoding = content_encoding::deflate;
+				}
+			}
+			if (!connection->decoder.begin(connection->data.contentEncoding)) {
+				connection->data.contentEncoding = content_encoding::identity;
+			}
+			connection->data.isItChunked = false;
+			if (connection->data.responseHeaders.contains("transfer-encoding") &&
+				connection->data.responseHeaders.at("transfer-encoding").find("chunked") != jsonifier::string_view::npos) {
+				connection->data.isItChunked = true;
+				connection->data.contentLength = 0;
+			} else if (connection->data.responseHeaders.contains("content-length")) {
+				connection->data.contentLength = jsonifier::strToUint64(connection->data.responseHeaders.at("content-length").data());
+			} else {
+				// no framing at all - the body runs until the connection closes.
+				connection->data.contentLength = std::numeric_limits<uint64_t>::max();
+			}
+			connection->data.responseCode = parseCodeNew;
+			if (connection->data.responseCode == 302) {
+				connection->workload.baseUrl = connection->data.responseHeaders.at("location");
+				connection->disconnect();
+				return false;
+			}
+			if (connection->data.responseCode != 200 && connection->data.responseCode != 201) {
+				connection->data.currentState = https_state::complete;
+			} else if (connection->data.isItChunked) {
+				connection->data.chunkState	  = https_chunk_state::Collecting_Size;
+				connection->data.currentState = https_state::Collecting_Chunked_Contents;
+			} else {
+				connection->data.currentState = https_state::Collecting_Contents;
+			}
+			return true;
+		}
+
+		void https_rnr_builder::appendBody(jsonifier::string_view bodyData) {
+			auto connection{ static_cast<https_connection*>(this) };
+			connection->data.bytesOnWire += bodyData.size();
+			if (connection->data.contentEncoding == content_encoding::identity) {
+				connection->data.responseData += bodyData;
+			} else if (!connection->data.didDecodingFail && !connection->decoder.decodeData(bodyData, connection->data.responseData)) {
+				connection->data.didDecodingFail = true;
+			}
+		}
+
+		void https_rnr_builder::completeBody() {
+			auto connection{ static_cast<https_connection*>(this) };
+			connection->data.currentState = https_state::complete;
+			// an encoded body is only whole once the inflater has reached the end of its stream.
+			if (connection->data.contentEncoding != content_encoding::identity && connection->data.bytesOnWire > 0 &&
+				(connection->data.didDecodingFail || !connection->decoder.isItDone())) {
+				message_printer::printError<print_message_type::https>(connection->workload.callStack + " failed to decode a response body, of " +
+					jsonifier::toString(connection->data.bytesOnWire) + " bytes on the wire.");
+				connection->data.responseCode = static_cast<uint64_t>(https_response_code::https_response_codes::Decoding_Error);
+			}
+		}
+
+		bool https_rnr_builder::completeUnframedBody() {
+			auto connection{ static_cast<https_connection*>(this) };
+			if (connection->data.currentState != https_state::Collecting_Contents || connection->data.contentLength != std::numeric_limits<uint64_t>::max()) {
+				return false;
+			}
+			completeBody();
+			return true;
+		}
+
+		bool https_rnr_builder::parseChunk() {
+			auto connection{ static_cast<https_connection*>(this) };
+			while (true) {
+				jsonifier::string_view buffer{ connection->inputBufferReal.data() + connection->data.parseOffset,
+					connection->inputBufferReal.size() - connection->data.parseOffset };
+				switch (connection->data.chunkState) {
+					case https_chunk_state::Collecting_Size: {
+						auto lineEnd = buffer.find("\r\n");
+						if (lineEnd == jsonifier::string_view::npos) {
+							return false;
+						}
+						connection->data.chunkBytesRemaining = parseChunkSize(buffer.substr(0, lineEnd));
+						connection->data.parseOffset += lineEnd + 2;
+						connection->data.chunkState = connection->data.chunkBytesRemaining > 0 ? https_chunk_state::Collecting_Data : https_chunk_state::Collecting_Trailers;
+						break;
 					}
-					headers.erase(headers.begin());
-					if (headers.size() >= 3 && parseCodeNew) {
-						for (uint64_t x = 0; x < headers.size(); ++x) {
-							jsonifier::string_view::size_type sep = headers.at(x).find(": ");
-							if (sep != jsonifier::string_view::npos) {
-								jsonifier::string key		 = static_cast<jsonifier::string>(headers.at(x).substr(0, sep));
-								jsonifier::string_view value = headers.at(x).substr(sep + 2, headers.at(x).size());
-								for (auto& valueNew: key) {
-									valueNew = static_cast<char>(std::tolower(static_cast<int32_t>(valueNew)));
-								}
-								connection->data.responseHeaders.emplace(key, value);
-							}
+					case https_chunk_state::Collecting_Data: {
+						if (buffer.size() == 0) {
+							return false;
 						}
-						if (connection->data.responseHeaders.contains("content-length")) {
-							connection->data.contentLength = jsonifier::strToUint64(connection->data.responseHeaders.at("content-length").data());
-						} else {
-							connection->data.contentLength = std::numeric_limits<uint32_t>::max();
-							connection->data.currentState  = https_state::Collecting_Chunked_Contents;
+						// decode whatever part of the chunk has arrived, rather than waiting for all of it.
+						uint64_t bytesToTake = std::min(static_cast<uint64_t>(buffer.size()), connection->data.chunkBytesRemaining);
+						appendBody(buffer.substr(0, bytesToTake));
+						connection->data.parseOffset += bytesToTake;
+						connection->data.chunkBytesRemaining -= bytesToTake;
+						if (connection->data.chunkBytesRemaining == 0) {
+							connection->data.chunkState = https_chunk_state::Collecting_Data_End;
 						}
-						connection->data.isItChunked = false;
-						if (connection->data.responseHeaders.contains("transfer-encoding")) {
-							if (connection->data.responseHeaders.at("transfer-encoding").find("chunked") != jsonifier::string_view::npos) {
-								connection->data.isItChunked   = true;
-								connection->data.contentLength = 0;
-								connection->data.currentState  = https_state::Collecting_Chunked_Contents;
-							}
+						break;
+					}
+					case https_chunk_state::Collecting_Data_End: {
+						if (buffer.size() < 2) {
+							return false;
 						}
-						connection->data.responseCode = parseCodeNew;
-						if (connection->data.responseCode == 302) {
-							connection->workload.baseUrl = connection->data.responseHeaders.at("location");
-							connection->disconnect();
+						connection->data.parseOffset += 2;
+						connection->data.chunkState = https_chunk_state::Collecting_Size;
+						break;
+					}
+					case https_chunk_state::Collecting_Trailers: {
+						auto lineEnd = buffer.find("\r\n");
+						if (lineEnd == jsonifier::string_view::npos) {
 							return false;
 						}
-						if (connection->data.responseCode != 200 && connection->data.responseCode != 201 && connection->data.responseCode != std::numeric_limits<uint32_t>::max()) {
-							connection->inputBufferReal.erase(connection->inputBufferReal.begin() + static_cast<int64_t>(stringViewNew.find("\r\n\r\n")) + 4);
-							connection->data.currentState = https_state::complete;
-							return true;
-						} else if (!connection->data.isItChunked) {
-							connection->data.currentState = https_state::Collecting_Contents;
-							connection->inputBufferReal.erase(connection->inputBufferReal.begin() + static_cast<int64_t>(stringViewNew.find("\r\n\r\n")) + 4);
-							return true;
-						} else {
-							connection->inputBufferReal.erase(connection->inputBufferReal.begin() + static_cast<int64_t>(stringViewNew.find("\r\n\r\n")) + 4);
+						connection->data.parseOffset += lineEnd + 2;
+						if (lineEnd == 0) {
+							completeBody();
 							return true;
 						}
+						break;
 					}
 				}
-				return true;
 			}
-			return false;
 		}
 
-		bool https_rnr_builder::parseChunk() {
+		bool https_rnr_builder::parseContents() {
 			auto connection{ static_cast<https_connection*>(this) };
-			jsonifier::string_view stringViewNew01{ connection->inputBufferReal };
-			if (auto finalPosition = stringViewNew01.find("\r\n0\r\n\r\n"); finalPosition != jsonifier::string_view::npos) {
-				uint64_t pos{ 0 };
-				while (pos < stringViewNew01.size()) {
-					uint64_t lineEnd = stringViewNew01.find("\r\n", pos);
-					if (lineEnd == jsonifier::string_view::npos) {
-						break;
-					}
-
-					jsonifier::string_view sizeLine{ stringViewNew01.data() + pos, lineEnd - pos };
-					uint64_t chunkSize = jsonifier::strToUint64<16>(static_cast<jsonifier::string>(sizeLine));
-
-					if (chunkSize == 0) {
-						break;
-					}
-
-					pos = lineEnd + 2;
-
-					jsonifier::string_view newString{ stringViewNew01.data() + pos, chunkSize };
-					connection->data.responseData += newString;
-					pos += chunkSize + 2;
+			uint64_t bytesAvailable = connection->inputBufferReal.size() - connection->data.parseOffset;
+			if (connection->data.contentEncoding == content_encoding::identity && connection->data.contentLength != std::numeric_limits<uint64_t>::max()) {
+				// identity bodies stay where they were received, and get handed over without a copy by finalizeReturnValues().
+				if (bytesAvailable < connection->data.contentLength) {
+					return false;
 				}
+				connection->data.bodyOffset		= connection->data.parseOffset;
+				connection->data.bytesOnWire	= connection->data.contentLength;
+				connection->data.isBodyInBuffer = true;
+				connection->data.parseOffset += connection->data.contentLength;
 				connection->data.currentState = https_state::complete;
 				return true;
 			}
+			uint64_t bytesToTake = std::min(bytesAvailable, connection->data.contentLength - connection->data.bytesOnWire);
+			if (bytesToTake > 0) {
+				appendBody(jsonifier::string_view{ connection->inputBufferReal.data() + connection->data.parseOffset, bytesToTake });
+				connection->data.parseOffset += bytesToTake;
+			}
+			if (connection->data.bytesOnWire >= connection->data.contentLength) {
+				completeBody();
+				return true;
+			}
 			return false;
 		}
 
-		bool https_rnr_builder::parseContents() {
-			auto connection{ static_cast<https_connection*>(this) };
-			if (connection->inputBufferReal.size() >= connection->data.contentLength || !connection->data.contentLength) {
-				connection->data.responseData += jsonifier::string_view{ connection->inputBufferReal.data(), connection->data.contentLength };
-				connection->data.currentState = https_state::complete;
-				return true;
-			} else {
-				return false;
+		void https_connection::releaseBuffer(jsonifier::string&& buffer) {
+			if (inputBufferReal.size() == 0) {
+				inputBufferReal = std::move(buffer);
+				inputBufferReal.clear();
 			}
 		}
 
@@ -342,9 +507,6 @@ namespace discord_core_api {
 				throw dca_exception{ "Failed to gain endpoint access." };
 			}
 			connection->resetValues(std::move(workload), rateLimitData);
-			if (!connection->areWeConnected()) {
-				*static_cast<tcp_connection<https_connection>*>(connection) = https_connection{ connection->workload.baseUrl, static_cast<uint16_t>(443) };
-			}
 		}
 
 		https_connection_stack_holder::~https_connection_stack_holder() {
@@ -355,18 +517,90 @@ namespace discord_core_api {
 			return *connection;
 		}
 
-		https_client::https_client(jsonifier::string_view botTokenNew) : https_client_core(botTokenNew), connectionManager(&rateLimitQueue) {
+		https_client::https_client(jsonifier::string_view botTokenNew, const https_options& options) : https_client_core(botTokenNew), connectionManager(&rateLimitQueue) {
+			https_response_cache::initialize(options);
+			proxyAddress = options.proxyAddress;
+			proxyPort	 = options.proxyPort;
+			coalescedWorkloads.fill(options.coalesceGetRequests);
+			for (auto& value: options.uncoalescedWorkloads) {
+				coalescedWorkloads[static_cast<uint64_t>(value)] = false;
+			}
 			rateLimitQueue.initialize();
 		}
 
+		https_response_data https_client::submitCoalescedWorkload(https_workload_data&& workload) {
+			// the method is always get here, and the query string is part of the relative path.
+			jsonifier::string key{ workload.baseUrl + workload.relativePath };
+			std::promise<https_response_data> promise{};
+			std::shared_future<https_response_data> sharedResult{};
+			bool areWeTheLeader{};
+			{
+				std::unique_lock lock{ inFlightMutex };
+				if (auto result = inFlightRequests.find(key); result != inFlightRequests.end()) {
+					++result->second.waiterCount;
+					sharedResult = result->second.result;
+				} else {
+					sharedResult		  = promise.get_future().share();
+					inFlightRequests[key] = in_flight_request{ sharedResult, 0 };
+					areWeTheLeader		  = true;
+				}
+			}
+			if (!areWeTheLeader) {
+				metrics::https.coalescedRequests.add();
+				https_response_data returnData{ sharedResult.get() };
+				if (returnData.responseCode != 200 && returnData.responseCode != 204 && returnData.responseCode != 201) {
+					throw makeHttpsError(workload, std::move(returnData));
+				}
+				return returnData;
+			}
+			bool areWeReleased{};
+			auto releaseRequest = [&]() {
+				std::unique_lock lock{ inFlightMutex };
+				uint64_t waiterCount{ inFlightRequests[key].waiterCount };
+				inFlightRequests.erase(key);
+				areWeReleased = true;
+				return waiterCount;
+			};
+			// everything from acquiring the connection onwards can throw - and whatever does, the entry must still be erased, and its waiters woken.
+			try {
+				https_connection_stack_holder stackHolder{ connectionManager, std::move(workload) };
+				https_response_data returnData{ httpsRequest(stackHolder.getConnection()) };
+				// only pay for a copy of the response if somebody actually joined the request while it was in flight.
+				if (releaseRequest() > 0) {
+					promise.set_value(returnData);
+				}
+				if (returnData.responseCode != 200 && returnData.responseCode != 204 && returnData.responseCode != 201) {
+					throw makeHttpsError(stackHolder.getConnection().workload, std::move(returnData));
+				}
+				return returnData;
+			} catch (...) {
+				if (!areWeReleased) {
+					releaseRequest();
+					promise.set_exception(std::current_exception());
+				}
+				throw;
+			}
+		}
+
+		https_response_data https_client::forwardWorkload(https_workload_data&& workload) {
+			https_connection_stack_holder stackHolder{ connectionManager, std::move(workload) };
+			return httpsRequest(stackHolder.getConnection());
+		}
+
 		https_response_data https_client::httpsRequest(https_connection& connection) {
 			https_response_data resultData = executeByRateLimitData(connection);
 			return resultData;
 		}
 
 		https_response_data https_client_core::httpsRequestInternal(https_connection& connection) {
-			if (connection.workload.baseUrl == "https://discord.com/api/v10") {
+			if (isItProxied(connection.workload)) {
+				// the proxy holds the token, and applies the rate limits of the bucket that this workload type maps to.
+				connection.workload.headersToInsert.emplace(static_cast<jsonifier::string>(workloadTypeHeader),
+					jsonifier::toString(static_cast<uint64_t>(connection.workload.getWorkloadType())));
+			} else if (connection.workload.baseUrl == "https://discord.com/api/v10") {
 				connection.workload.headersToInsert.emplace("Authorization", "Bot " + botToken);
+			}
+			if (connection.workload.baseUrl == "https://discord.com/api/v10") {
 				connection.workload.headersToInsert.emplace("User-Agent", "DiscordCoreAPI (https://discordcoreapi.com/1.0)");
 				if (connection.workload.payloadType == payload_type::Application_Json) {
 					connection.workload.headersToInsert.emplace("Content-Type", "application/json");
@@ -380,7 +614,7 @@ namespace discord_core_api {
 			}
 			if (!connection.areWeConnected()) {
 				connection.currentBaseUrl = connection.workload.baseUrl;
-				*static_cast<tcp_connection<https_connection>*>(&connection) = https_connection{ connection.workload.baseUrl, static_cast<uint16_t>(443) };
+				connectToHost(connection);
 				if (connection.currentStatus != connection_status::NO_Error || !connection.areWeConnected()) {
 					++connection.currentReconnectTries;
 					connection.disconnect();
@@ -389,14 +623,25 @@ namespace discord_core_api {
 			}
 			auto request = connection.buildRequest(connection.workload);
 			if (connection.areWeConnected()) {
-				connection.writeData(static_cast<jsonifier::string_view>(request), true);
+				if (!connection.workload.multipartContent.empty()) {
+					bool didWeWrite{ connection.streamData(static_cast<jsonifier::string_view>(request)) };
+					connection.workload.multipartContent.forEachSegment([&](jsonifier::string_view segment, const mapped_file* file) {
+						didWeWrite = didWeWrite && (file ? connection.streamFile(*file) : connection.streamData(segment));
+					});
+					if (!didWeWrite && connection.currentStatus == connection_status::NO_Error) {
+						connection.currentStatus = connection_status::WRITE_Error;
+					}
+				} else {
+					connection.writeData(static_cast<jsonifier::string_view>(request), true);
+				}
 				if (connection.currentStatus != connection_status::NO_Error || !connection.areWeConnected()) {
 					++connection.currentReconnectTries;
 					connection.disconnect();
 					return httpsRequestInternal(connection);
 				}
 				auto result = getResponse(connection);
-				if (static_cast<int64_t>(result.responseCode) == -1 || !connection.areWeConnected()) {
+				// a response that completed as its connection closed is kept, rather than being requested again.
+				if (static_cast<int64_t>(result.responseCode) == -1 || (!connection.areWeConnected() && result.currentState != https_state::complete)) {
 					++connection.currentReconnectTries;
 					connection.disconnect();
 					return httpsRequestInternal(connection);
@@ -410,6 +655,18 @@ namespace discord_core_api {
 			}
 		}
 
+		bool https_client_core::isItProxied(const https_workload_data& workload) const {
+			return !proxyAddress.empty() && workload.baseUrl == "https://discord.com/api/v10";
+		}
+
+		void https_client_core::connectToHost(https_connection& connection) {
+			if (!isItProxied(connection.workload)) {
+				*static_cast<tcp_connection<https_connection>*>(&connection) = https_connection{ connection.workload.baseUrl, static_cast<uint16_t>(443) };
+			} else {
+				*static_cast<tcp_connection<https_connection>*>(&connection) = https_connection{ proxyAddress, proxyPort, false };
+			}
+		}
+
 		https_response_data https_client::executeByRateLimitData(https_connection& connection) {
 			https_response_data returnData{};
 			milliseconds timeRemaining{};
@@ -431,7 +688,7 @@ namespace discord_core_api {
 				timeRemaining = targetTime - currentTime;
 				connection.currentRateLimitData->doWeWait.store(false, std::memory_order_release);
 			}
-			if (timeRemaining.count() > 0) {
+			if (timeRemaining.count() > 0 && !isItProxied(connection.workload)) {
 				message_printer::printSuccess<print_message_type::https>("we're waiting on rate-limit: " + jsonifier::toString(timeRemaining.count()));
 				milliseconds targetTime{ currentTime + timeRemaining };
 				while (targetTime > currentTime && targetTime.count() > 0 && currentTime.count() > 0 && timeRemaining.count() > 0) {
@@ -444,13 +701,25 @@ namespace discord_core_api {
 					}
 				}
 			}
+			// the route's generation is taken before the request is sent, so that an invalidation that lands while it is in flight keeps its response out of the
+			// cache.
+			bool isItCacheable{ connection.workload.workloadClass == https_workload_class::Get && https_response_cache::isItCacheable(connection.workload.getWorkloadType()) };
+			jsonifier::string cachedRoute{ isItCacheable ? connection.workload.relativePath : jsonifier::string{} };
+			uint64_t cacheGeneration{ isItCacheable ? https_response_cache::beginRequest(cachedRoute) : 0 };
 			returnData = https_client::httpsRequestInternal(connection);
 			connection.currentRateLimitData->sampledTimeInMs.store(std::chrono::duration_cast<std::chrono::duration<int64_t, std::milli>>(sys_clock::now().time_since_epoch()),
 				std::memory_order_release);
 
 			if (returnData.responseCode == 204 || returnData.responseCode == 201 || returnData.responseCode == 200) {
-				message_printer::printSuccess<print_message_type::https>(
-					connection.workload.callStack + " success: " + static_cast<jsonifier::string>(returnData.responseCode) + ": " + returnData.responseData);
+				if (connection.workload.workloadClass != https_workload_class::Get) {
+					https_response_cache::invalidateRelated(connection.workload.relativePath);
+				} else if (isItCacheable) {
+					https_response_cache::store(cachedRoute, returnData.responseData, cacheGeneration);
+					isItCacheable = false;
+				}
+				message_printer::printSuccess<print_message_type::https>([&] {
+					return connection.workload.callStack + " success: " + static_cast<jsonifier::string>(returnData.responseCode) + ": " + returnData.responseData;
+				});
 			} else if (returnData.responseCode == 429) {
 				if (connection.data.responseHeaders.contains("x-ratelimit-retry-after")) {
 					connection.currentRateLimitData->sRemain.store(seconds{ jsonifier::strToInt64(connection.data.responseHeaders.at("x-ratelimit-retry-after").data()) / 1000LL },
@@ -463,9 +732,29 @@ namespace discord_core_api {
 				connection.resetValues(std::move(connection.workload), connection.currentRateLimitData);
 				returnData = executeByRateLimitData(connection);
 			}
+			if (isItCacheable) {
+				https_response_cache::endRequest(cachedRoute);
+			}
 			return returnData;
 		}
 
+		https_error https_client_core::makeHttpsError(https_workload_data& workload, https_response_data&& returnData) {
+			jsonifier::string errorMessage{};
+			if (workload.callStack != "") {
+				errorMessage += workload.callStack + " ";
+			}
+			errorMessage += "Https error: " + returnData.responseCode.operator jsonifier::string() + "\nThe request: base url: " + workload.baseUrl + "\n";
+			if (!workload.relativePath.empty()) {
+				errorMessage += "Relative Url: " + workload.relativePath + "\n";
+			}
+			https_error theError{ errorMessage };
+			theError.errorCode = returnData.responseCode;
+			// the request and response bodies can be large, so they're only formatted if the error actually gets printed.
+			theError.setBodies(workload.multipartContent.empty() ? std::move(workload.content) : static_cast<jsonifier::string>(workload.multipartContent.getPayloadJson()),
+				std::move(returnData.responseData));
+			return theError;
+		}
+
 		https_response_data https_client_core::recoverFromError(https_connection& connection) {
 			if (connection.currentReconnectTries >= connection.maxReconnectTries) {
 				connection.disconnect();
@@ -487,12 +776,17 @@ namespace discord_core_api {
 						case connection_status::NO_Error: {
 							continue;
 						}
+						case connection_status::POLLHUP_Error: {
+							// a body without any framing runs until the server closes the connection, so its close is the end of the response.
+							if (connection.completeUnframedBody()) {
+								return connection.finalizeReturnValues(*connection.currentRateLimitData);
+							}
+							return recoverFromError(connection);
+						}
 						case connection_status::CONNECTION_Error:
 							[[fallthrough]];
 						case connection_status::POLLERR_Error:
 							[[fallthrough]];
-						case connection_status::POLLHUP_Error:
-							[[fallthrough]];
 						case connection_status::POLLNVAL_Error:
 							[[fallthrough]];
 						case connection_status::READ_Error:
@@ -505,6 +799,9 @@ namespace discord_core_api {
 							return recoverFromError(connection);
 						}
 					}
+				} else if (connection.currentStatus == connection_status::NO_Error && connection.completeUnframedBody()) {
+					// the server sent its close_notify, which ends an unframed body cleanly.
+					return connection.finalizeReturnValues(*connection.currentRateLimitData);
 				} else {
 					return recoverFromError(connection);
 				}
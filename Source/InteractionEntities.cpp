@@ -378,10 +378,11 @@ namespace discord_core_api {
 		auto dataPackage{ dataPackageNew };
 		workload.relativePath = "/interactions/" + dataPackage.interactionPackage.interactionId + "/" + dataPackage.interactionPackage.interactionToken + "/callback";
 		dataPackage.generateExcludedKeys();
+		parser.serializeJson(dataPackage, workload.content);
 		if (dataPackage.data.files.size() > 0) {
-			workload.payloadType = discord_core_internal::payload_type::Multipart_Form;
+			workload.payloadType	  = discord_core_internal::payload_type::Multipart_Form;
+			workload.multipartContent = multipart_body{ std::move(workload.content), dataPackage.data.files };
 		}
-		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "interactions::createInteractionResponseAsync()";
 		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
 		get_interaction_response_data dataPackage01{};
@@ -423,10 +424,11 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Patch;
 		workload.relativePath  = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken + "/messages/@original";
 		dataPackage.generateExcludedKeys();
+		parser.serializeJson(dataPackage, workload.content);
 		if (dataPackage.files.size() > 0) {
-			workload.payloadType = discord_core_internal::payload_type::Multipart_Form;
+			workload.payloadType	  = discord_core_internal::payload_type::Multipart_Form;
+			workload.multipartContent = multipart_body{ std::move(workload.content), dataPackage.files };
 		}
-		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "interactions::editInteractionResponseAsync()";
 		message_data returnData{};
 		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
@@ -451,10 +453,11 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Post;
 		workload.relativePath  = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken;
 		dataPackage.generateExcludedKeys();
+		parser.serializeJson(dataPackage, workload.content);
 		if (dataPackage.files.size() > 0) {
-			workload.payloadType = discord_core_internal::payload_type::Multipart_Form;
+			workload.payloadType	  = discord_core_internal::payload_type::Multipart_Form;
+			workload.multipartContent = multipart_body{ std::move(workload.content), dataPackage.files };
 		}
-		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "interactions::createFollowUpMessageAsync()";
 		message_data returnData{};
 		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
@@ -480,10 +483,11 @@ namespace discord_core_api {
 		workload.relativePath  = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken + "/messages/" +
 			dataPackage.messagePackage.messageId;
 		dataPackage.generateExcludedKeys();
+		parser.serializeJson(dataPackage, workload.content);
 		if (dataPackage.files.size() > 0) {
-			workload.payloadType = discord_core_internal::payload_type::Multipart_Form;
+			workload.payloadType	  = discord_core_internal::payload_type::Multipart_Form;
+			workload.multipartContent = multipart_body{ std::move(workload.content), dataPackage.files };
 		}
-		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "interactions::editFollowUpMessageAsync()";
 		message_data returnData{};
 		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
@@ -508,10 +512,11 @@ namespace discord_core_api {
 		auto dataPackage{ dataPackageNew };
 		workload.relativePath  = "/interactions/" + dataPackage.interactionPackage.interactionId + "/" + dataPackage.interactionPackage.interactionToken + "/callback";
 		dataPackage.generateExcludedKeys();
+		parser.serializeJson(dataPackage, workload.content);
 		if (dataPackage.data.files.size() > 0) {
-			workload.payloadType = discord_core_internal::payload_type::Multipart_Form;
+			workload.payloadType	  = discord_core_internal::payload_type::Multipart_Form;
+			workload.multipartContent = multipart_body{ std::move(workload.content), dataPackage.data.files };
 		}
-		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "interactions::createInteractionResponse()";
 		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
 		get_interaction_response_data dataPackage01{};
@@ -530,10 +535,11 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Patch;
 		workload.relativePath  = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken + "/messages/@original";
 		dataPackage.generateExcludedKeys();
+		parser.serializeJson(dataPackage, workload.content);
 		if (dataPackage.files.size() > 0) {
-			workload.payloadType = discord_core_internal::payload_type::Multipart_Form;
+			workload.payloadType	  = discord_core_internal::payload_type::Multipart_Form;
+			workload.multipartContent = multipart_body{ std::move(workload.content), dataPackage.files };
 		}
-		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "interactions::editInteractionResponse()";
 		message_data returnData{};
 		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
@@ -546,10 +552,11 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Post;
 		workload.relativePath  = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken;
 		dataPackage.generateExcludedKeys();
+		parser.serializeJson(dataPackage, workload.content);
 		if (dataPackage.files.size() > 0) {
-			workload.payloadType = discord_core_internal::payload_type::Multipart_Form;
+			workload.payloadType	  = discord_core_internal::payload_type::Multipart_Form;
+			workload.multipartContent = multipart_body{ std::move(workload.content), dataPackage.files };
 		}
-		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "interactions::createFollowUpMessage()";
 		message_data returnData{};
 		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
@@ -563,10 +570,11 @@ namespace discord_core_api {
 		workload.relativePath  = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken + "/messages/" +
 			dataPackage.messagePackage.messageId;
 		dataPackage.generateExcludedKeys();
+		parser.serializeJson(dataPackage, workload.content);
 		if (dataPackage.files.size() > 0) {
-			workload.payloadType = discord_core_internal::payload_type::Multipart_Form;
+			workload.payloadType	  = discord_core_internal::payload_type::Multipart_Form;
+			workload.multipartContent = multipart_body{ std::move(workload.content), dataPackage.files };
 		}
-		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "interactions::editFollowUpMessage()";
 		message_data returnData{};
 		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
@@ -64,7 +64,7 @@ namespace jsonifier {
 
 namespace discord_core_api {
 
-	template<> unordered_map<jsonifier::string, unbounded_message_block<message_data>*> object_collector<message_data>::objectsBuffersMap{};
+	template<> dense_map<jsonifier::string, unbounded_message_block<message_data>*> object_collector<message_data>::objectsBuffersMap{};
 
 	template<> object_collector<message_data>::object_collector() {
 		collectorId										 = jsonifier::toString(std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch()).count());
@@ -216,6 +216,27 @@ namespace discord_core_api {
 		co_return returnData;
 	}
 
+	paginator<jsonifier::vector<message_data>, get_messages_data> messages::getMessagesPaginated(get_messages_data dataPackage, uint64_t prefetchWindow) {
+		if (dataPackage.limit == 0) {
+			dataPackage.limit = 100;
+		}
+		return paginator<jsonifier::vector<message_data>, get_messages_data>{ dataPackage, &messages::getMessagesAsync,
+			[](get_messages_data& dataPackageNew, const jsonifier::vector<message_data>& page) {
+				// pages around a message don't chain, and a short page is the last one.
+				if (dataPackageNew.aroundThisId != 0 || page.size() < static_cast<uint64_t>(dataPackageNew.limit)) {
+					return false;
+				}
+				bool doWeAscend{ dataPackageNew.afterThisId != 0 };
+				advanceSnowflakeCursor(doWeAscend ? dataPackageNew.afterThisId : dataPackageNew.beforeThisId, page,
+					[](const message_data& value) -> const snowflake& {
+						return value.id;
+					},
+					doWeAscend);
+				return true;
+			},
+			prefetchWindow };
+	}
+
 	co_routine<message_data> messages::getMessageAsync(const get_message_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Get_Message };
 		co_await newThreadAwaitable<message_data>();
@@ -232,11 +253,10 @@ namespace discord_core_api {
 		co_await newThreadAwaitable<message_data>();
 		workload.workloadClass = discord_core_internal::https_workload_class::Post;
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/messages";
+		parser.serializeJson(dataPackage, workload.content);
 		if (dataPackage.files.size() > 0) {
-			workload.payloadType = discord_core_internal::payload_type::Multipart_Form;
-			parser.serializeJson(dataPackage, workload.content);
-		} else {
-			parser.serializeJson(dataPackage, workload.content);
+			workload.payloadType	  = discord_core_internal::payload_type::Multipart_Form;
+			workload.multipartContent = multipart_body{ std::move(workload.content), dataPackage.files };
 		}
 		workload.callStack = "messages::createMessageAsync()";
 		message_data returnData{};
@@ -260,11 +280,10 @@ namespace discord_core_api {
 		co_await newThreadAwaitable<message_data>();
 		workload.workloadClass = discord_core_internal::https_workload_class::Patch;
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId;
+		parser.serializeJson(dataPackage, workload.content);
 		if (dataPackage.files.size() > 0) {
-			workload.payloadType = discord_core_internal::payload_type::Multipart_Form;
-			parser.serializeJson(dataPackage, workload.content);
-		} else {
-			parser.serializeJson(dataPackage, workload.content);
+			workload.payloadType	  = discord_core_internal::payload_type::Multipart_Form;
+			workload.multipartContent = multipart_body{ std::move(workload.content), dataPackage.files };
 		}
 		workload.callStack = "messages::editMessageAsync()";
 		message_data returnData{};
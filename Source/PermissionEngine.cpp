@@ -0,0 +1,429 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// PermissionEngine.cpp - Source file for the incrementally maintained permission tables.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file PermissionEngine.cpp
+
+#include <discordcoreapi/PermissionEngine.hpp>
+#include <discordcoreapi/Utilities/ISADetection.hpp>
+#include <bit>
+
+namespace discord_core_api {
+
+	void permission_engine::initialize(config_manager* configManagerNew) {
+		permission_engine::doWeTrackPermissionsBool = configManagerNew->getCacheOptions().trackPermissions;
+	}
+
+	void permission_engine::insertGuild(const guild_data& guild) {
+		if (!doWeTrackPermissionsBool) {
+			return;
+		}
+		uint64_t guildId{ guild.id.operator const uint64_t&() };
+		auto newGuild	  = makeUnique<discord_core_internal::guild_permission_table>();
+		newGuild->ownerId = guild.ownerId.operator const uint64_t&();
+		for (auto& value: guild.roles) {
+			newGuild->rolePermissions[value.id.operator const uint64_t&()] = value.permissions.operator uint64_t();
+		}
+		for (auto& value: guild.channels) {
+			newGuild->channels[value.id.operator const uint64_t&()] = buildChannelTable(guildId, value.permissionOverwrites);
+		}
+		for (auto& value: guild.members) {
+			auto& roleIds = newGuild->memberRoles[value.user.id.operator const uint64_t&()];
+			for (auto& valueNew: value.roles) {
+				roleIds.emplace_back(valueNew.operator const uint64_t&());
+			}
+		}
+		auto& shard = getShard(guildId);
+		std::unique_lock lock{ shard.shardMutex };
+		shard.guilds[guildId] = std::move(newGuild);
+	}
+
+	void permission_engine::updateGuild(const guild_data& guild) {
+		if (!doWeTrackPermissionsBool) {
+			return;
+		}
+		uint64_t guildId{ guild.id.operator const uint64_t&() };
+		auto& shard = getShard(guildId);
+		std::unique_lock lock{ shard.shardMutex };
+		auto iter = shard.guilds.find(guildId);
+		if (iter == shard.guilds.end()) {
+			return;
+		}
+		if (guild.ownerId != 0) {
+			iter->second->ownerId = guild.ownerId.operator const uint64_t&();
+		}
+		if (guild.roles.size() > 0) {
+			iter->second->rolePermissions.clear();
+			for (auto& value: guild.roles) {
+				iter->second->rolePermissions[value.id.operator const uint64_t&()] = value.permissions.operator uint64_t();
+			}
+		}
+	}
+
+	void permission_engine::removeGuild(snowflake guildId) {
+		auto& shard = getShard(guildId.operator const uint64_t&());
+		std::unique_lock lock{ shard.shardMutex };
+		shard.guilds.erase(guildId.operator const uint64_t&());
+	}
+
+	void permission_engine::insertRole(snowflake guildId, const role_data& role) {
+		if (!doWeTrackPermissionsBool) {
+			return;
+		}
+		auto& shard = getShard(guildId.operator const uint64_t&());
+		std::unique_lock lock{ shard.shardMutex };
+		if (auto iter = shard.guilds.find(guildId.operator const uint64_t&()); iter != shard.guilds.end()) {
+			iter->second->rolePermissions[role.id.operator const uint64_t&()] = role.permissions.operator uint64_t();
+		}
+	}
+
+	void permission_engine::removeRole(snowflake guildId, snowflake roleId) {
+		auto& shard = getShard(guildId.operator const uint64_t&());
+		std::unique_lock lock{ shard.shardMutex };
+		if (auto iter = shard.guilds.find(guildId.operator const uint64_t&()); iter != shard.guilds.end()) {
+			// members still listing the role are left alone - an unknown role simply contributes nothing.
+			iter->second->rolePermissions.erase(roleId.operator const uint64_t&());
+		}
+	}
+
+	void permission_engine::insertChannel(snowflake guildId, const channel_data& channel) {
+		if (!doWeTrackPermissionsBool || guildId == 0) {
+			return;
+		}
+		auto newChannel = buildChannelTable(guildId.operator const uint64_t&(), channel.permissionOverwrites);
+		auto& shard		= getShard(guildId.operator const uint64_t&());
+		std::unique_lock lock{ shard.shardMutex };
+		if (auto iter = shard.guilds.find(guildId.operator const uint64_t&()); iter != shard.guilds.end()) {
+			iter->second->channels[channel.id.operator const uint64_t&()] = std::move(newChannel);
+		}
+	}
+
+	void permission_engine::removeChannel(snowflake guildId, snowflake channelId) {
+		auto& shard = getShard(guildId.operator const uint64_t&());
+		std::unique_lock lock{ shard.shardMutex };
+		if (auto iter = shard.guilds.find(guildId.operator const uint64_t&()); iter != shard.guilds.end()) {
+			iter->second->channels.erase(channelId.operator const uint64_t&());
+		}
+	}
+
+	void permission_engine::insertGuildMember(snowflake guildId, const guild_member_data& guildMember) {
+		if (!doWeTrackPermissionsBool) {
+			return;
+		}
+		std::vector<uint64_t> roleIds{};
+		roleIds.reserve(guildMember.roles.size());
+		for (auto& value: guildMember.roles) {
+			roleIds.emplace_back(value.operator const uint64_t&());
+		}
+		auto& shard = getShard(guildId.operator const uint64_t&());
+		std::unique_lock lock{ shard.shardMutex };
+		if (auto iter = shard.guilds.find(guildId.operator const uint64_t&()); iter != shard.guilds.end()) {
+			iter->second->memberRoles[guildMember.user.id.operator const uint64_t&()] = std::move(roleIds);
+		}
+	}
+
+	void permission_engine::removeGuildMember(snowflake guildId, snowflake userId) {
+		auto& shard = getShard(guildId.operator const uint64_t&());
+		std::unique_lock lock{ shard.shardMutex };
+		if (auto iter = shard.guilds.find(guildId.operator const uint64_t&()); iter != shard.guilds.end()) {
+			iter->second->memberRoles.erase(userId.operator const uint64_t&());
+		}
+	}
+
+	std::optional<uint64_t> permission_engine::computeBase(const guild_member_data& guildMember) {
+		uint64_t guildId{ guildMember.guildId.operator const uint64_t&() };
+		auto& shard = getShard(guildId);
+		std::shared_lock lock{ shard.shardMutex };
+		auto iter = shard.guilds.find(guildId);
+		if (iter == shard.guilds.end()) {
+			return std::nullopt;
+		}
+		return computeBase(*iter->second, guildId, guildMember.user.id.operator const uint64_t&(), guildMember.roles);
+	}
+
+	std::optional<uint64_t> permission_engine::compute(const guild_member_data& guildMember, snowflake channelId) {
+		uint64_t guildId{ guildMember.guildId.operator const uint64_t&() };
+		auto& shard = getShard(guildId);
+		std::shared_lock lock{ shard.shardMutex };
+		auto iter = shard.guilds.find(guildId);
+		if (iter == shard.guilds.end()) {
+			return std::nullopt;
+		}
+		auto channelIter = iter->second->channels.find(channelId.operator const uint64_t&());
+		if (channelIter == iter->second->channels.end()) {
+			return std::nullopt;
+		}
+		uint64_t userId{ guildMember.user.id.operator const uint64_t&() };
+		return applyOverwrites(computeBase(*iter->second, guildId, userId, guildMember.roles), channelIter->second, userId, guildMember.roles);
+	}
+
+	std::optional<uint64_t> permission_engine::compute(snowflake guildId, snowflake userId, snowflake channelId) {
+		auto& shard = getShard(guildId.operator const uint64_t&());
+		std::shared_lock lock{ shard.shardMutex };
+		auto iter = shard.guilds.find(guildId.operator const uint64_t&());
+		if (iter == shard.guilds.end()) {
+			return std::nullopt;
+		}
+		auto memberIter	 = iter->second->memberRoles.find(userId.operator const uint64_t&());
+		auto channelIter = iter->second->channels.find(channelId.operator const uint64_t&());
+		if (memberIter == iter->second->memberRoles.end() || channelIter == iter->second->channels.end()) {
+			return std::nullopt;
+		}
+		return applyOverwrites(computeBase(*iter->second, guildId.operator const uint64_t&(), userId.operator const uint64_t&(), memberIter->second), channelIter->second,
+			userId.operator const uint64_t&(), memberIter->second);
+	}
+
+	std::optional<permission_batch> permission_engine::computeBatch(snowflake guildId, snowflake channelId, const jsonifier::vector<snowflake>& userIds) {
+		using reducer = discord_core_internal::role_bitmap_reducer;
+		auto& shard	  = getShard(guildId.operator const uint64_t&());
+		std::shared_lock lock{ shard.shardMutex };
+		auto iter = shard.guilds.find(guildId.operator const uint64_t&());
+		if (iter == shard.guilds.end()) {
+			return std::nullopt;
+		}
+		auto& guild		 = *iter->second;
+		auto channelIter = guild.channels.find(channelId.operator const uint64_t&());
+		if (channelIter == guild.channels.end()) {
+			return std::nullopt;
+		}
+		auto& channel = channelIter->second;
+
+		permission_batch returnValue{};
+		std::vector<const std::vector<uint64_t>*> memberRoles{};
+		if (userIds.size() > 0) {
+			returnValue.userIds.reserve(userIds.size());
+			memberRoles.reserve(userIds.size());
+			for (auto& value: userIds) {
+				if (auto memberIter = guild.memberRoles.find(value.operator const uint64_t&()); memberIter != guild.memberRoles.end()) {
+					returnValue.userIds.emplace_back(memberIter->first);
+					memberRoles.emplace_back(&memberIter->second);
+				}
+			}
+		} else {
+			returnValue.userIds.reserve(guild.memberRoles.size());
+			memberRoles.reserve(guild.memberRoles.size());
+			for (auto& [key, value]: guild.memberRoles) {
+				returnValue.userIds.emplace_back(key);
+				memberRoles.emplace_back(&value);
+			}
+		}
+
+		// every role that can contribute anything gets a bit - those with guild-wide permissions, and those with an overwrite in this channel.
+		uint64_t guildIdNew{ guildId.operator const uint64_t&() };
+		unordered_map<uint64_t, uint64_t> roleIndices{};
+		for (auto& [key, value]: guild.rolePermissions) {
+			if (key != guildIdNew) {
+				roleIndices.emplace(key, roleIndices.size());
+			}
+		}
+		for (auto& value: channel.roleOverwrites) {
+			if (roleIndices.find(value.id) == roleIndices.end()) {
+				roleIndices.emplace(value.id, roleIndices.size());
+			}
+		}
+		const uint64_t wordCount{ (roleIndices.size() + 63) / 64 };
+		const uint64_t memberCount{ returnValue.userIds.size() };
+		const uint64_t paddedCount{ (memberCount + reducer::membersPerRegister - 1) / reducer::membersPerRegister * reducer::membersPerRegister };
+
+		std::vector<uint64_t> rolePermissions(wordCount * 64);
+		std::vector<uint64_t> roleAllows(wordCount * 64);
+		std::vector<uint64_t> roleDenies(wordCount * 64);
+		for (auto& [key, value]: guild.rolePermissions) {
+			if (key != guildIdNew) {
+				rolePermissions[roleIndices[key]] = value;
+			}
+		}
+		for (auto& value: channel.roleOverwrites) {
+			roleAllows[roleIndices[value.id]] |= value.allow;
+			roleDenies[roleIndices[value.id]] |= value.deny;
+		}
+
+		// the bitmaps are laid out word-major, so that a register's worth of members' words for the same 64 roles sits contiguously.
+		std::vector<uint64_t> roleBitmaps(wordCount * paddedCount);
+		for (uint64_t x = 0; x < memberCount; ++x) {
+			for (auto& value: *memberRoles[x]) {
+				if (auto indexIter = roleIndices.find(value); indexIter != roleIndices.end()) {
+					roleBitmaps[(indexIter->second / 64) * paddedCount + x] |= 1ull << (indexIter->second % 64);
+				}
+			}
+		}
+
+		std::vector<uint64_t> basePermissions(paddedCount);
+		std::vector<uint64_t> allows(paddedCount);
+		std::vector<uint64_t> denies(paddedCount);
+		const bool haveRoleOverwrites{ channel.roleOverwrites.size() > 0 };
+		for (uint64_t x = 0; x < wordCount; ++x) {
+			const uint64_t* bitmapWords{ roleBitmaps.data() + x * paddedCount };
+			for (uint64_t y = 0; y < paddedCount; y += reducer::membersPerRegister) {
+				reducer::reduceRegister(bitmapWords + y, rolePermissions.data() + x * 64, basePermissions.data() + y);
+				if (haveRoleOverwrites) {
+					reducer::reduceRegister(bitmapWords + y, roleAllows.data() + x * 64, allows.data() + y);
+					reducer::reduceRegister(bitmapWords + y, roleDenies.data() + x * 64, denies.data() + y);
+				}
+			}
+		}
+
+		uint64_t everyonePermissions{};
+		if (auto roleIter = guild.rolePermissions.find(guildIdNew); roleIter != guild.rolePermissions.end()) {
+			everyonePermissions = roleIter->second;
+		}
+		returnValue.permissions.resize(memberCount);
+		for (uint64_t x = 0; x < memberCount; ++x) {
+			uint64_t permissions{ basePermissions[x] | everyonePermissions };
+			if (returnValue.userIds[x] == guild.ownerId || (permissions & static_cast<uint64_t>(permission::administrator))) {
+				returnValue.permissions[x] = allPermissions;
+				continue;
+			}
+			permissions = (permissions & ~channel.everyoneDeny) | channel.everyoneAllow;
+			permissions = (permissions & ~denies[x]) | allows[x];
+			for (auto& value: channel.memberOverwrites) {
+				if (value.id == returnValue.userIds[x]) {
+					permissions = (permissions & ~value.deny) | value.allow;
+					break;
+				}
+			}
+			returnValue.permissions[x] = permissions;
+		}
+		return returnValue;
+	}
+
+	bool permission_engine::has(snowflake guildId, snowflake userId, snowflake channelId, permission permissionNew) {
+		if (auto value = compute(guildId, userId, channelId)) {
+			return (*value & static_cast<uint64_t>(permissionNew)) == static_cast<uint64_t>(permissionNew);
+		}
+		return false;
+	}
+
+	uint64_t permission_engine::applyOverwrites(uint64_t basePermissions, const guild_member_data& guildMember, const jsonifier::vector<over_write_data>& overwrites) {
+		if (basePermissions & static_cast<uint64_t>(permission::administrator)) {
+			return allPermissions;
+		}
+		uint64_t permissions{ basePermissions };
+		uint64_t allow{};
+		uint64_t deny{};
+		for (auto& value: overwrites) {
+			if (value.id == guildMember.guildId) {
+				permissions &= ~value.deny.operator uint64_t();
+				permissions |= value.allow.operator uint64_t();
+				break;
+			}
+		}
+		for (auto& value: overwrites) {
+			if (value.type != permission_overwrites_type::role_data) {
+				continue;
+			}
+			for (auto& roleId: guildMember.roles) {
+				if (roleId == value.id) {
+					allow |= value.allow.operator uint64_t();
+					deny |= value.deny.operator uint64_t();
+					break;
+				}
+			}
+		}
+		permissions &= ~deny;
+		permissions |= allow;
+		for (auto& value: overwrites) {
+			if (value.type == permission_overwrites_type::user_data && value.id == guildMember.user.id) {
+				permissions &= ~value.deny.operator uint64_t();
+				permissions |= value.allow.operator uint64_t();
+				break;
+			}
+		}
+		return permissions;
+	}
+
+	bool permission_engine::doWeTrackPermissions() {
+		return permission_engine::doWeTrackPermissionsBool;
+	}
+
+	permission_engine::permission_shard& permission_engine::getShard(uint64_t guildId) {
+		static constexpr uint64_t shardBits{ static_cast<uint64_t>(std::countr_zero(shardCount)) };
+		return shards[key_hasher<uint64_t>::getHashKey(guildId) >> (64 - shardBits)];
+	}
+
+	template<typename role_ids_type>
+	uint64_t permission_engine::computeBase(const discord_core_internal::guild_permission_table& guild, uint64_t guildId, uint64_t userId, const role_ids_type& roleIds) {
+		if (guild.ownerId == userId) {
+			return allPermissions;
+		}
+		uint64_t permissions{};
+		if (auto iter = guild.rolePermissions.find(guildId); iter != guild.rolePermissions.end()) {
+			permissions = iter->second;
+		}
+		for (auto& value: roleIds) {
+			if (auto iter = guild.rolePermissions.find(static_cast<uint64_t>(value)); iter != guild.rolePermissions.end()) {
+				permissions |= iter->second;
+			}
+		}
+		return (permissions & static_cast<uint64_t>(permission::administrator)) ? allPermissions : permissions;
+	}
+
+	template<typename role_ids_type> uint64_t permission_engine::applyOverwrites(uint64_t basePermissions, const discord_core_internal::channel_permission_table& channel,
+		uint64_t userId, const role_ids_type& roleIds) {
+		if (basePermissions & static_cast<uint64_t>(permission::administrator)) {
+			return allPermissions;
+		}
+		uint64_t permissions{ (basePermissions & ~channel.everyoneDeny) | channel.everyoneAllow };
+		uint64_t allow{};
+		uint64_t deny{};
+		for (auto& value: channel.roleOverwrites) {
+			for (auto& roleId: roleIds) {
+				if (static_cast<uint64_t>(roleId) == value.id) {
+					allow |= value.allow;
+					deny |= value.deny;
+					break;
+				}
+			}
+		}
+		permissions = (permissions & ~deny) | allow;
+		for (auto& value: channel.memberOverwrites) {
+			if (value.id == userId) {
+				return (permissions & ~value.deny) | value.allow;
+			}
+		}
+		return permissions;
+	}
+
+	discord_core_internal::channel_permission_table permission_engine::buildChannelTable(uint64_t guildId, const jsonifier::vector<over_write_data>& overwrites) {
+		discord_core_internal::channel_permission_table returnValue{};
+		for (auto& value: overwrites) {
+			discord_core_internal::permission_overwrite_entry entry{ value.allow.operator uint64_t(), value.deny.operator uint64_t(), value.id.operator const uint64_t&() };
+			if (entry.id == guildId) {
+				returnValue.everyoneAllow = entry.allow;
+				returnValue.everyoneDeny  = entry.deny;
+			} else if (value.type == permission_overwrites_type::role_data) {
+				returnValue.roleOverwrites.emplace_back(entry);
+			} else {
+				returnValue.memberOverwrites.emplace_back(entry);
+			}
+		}
+		return returnValue;
+	}
+
+	std::array<permission_engine::permission_shard, permission_engine::shardCount> permission_engine::shards{};
+	bool permission_engine::doWeTrackPermissionsBool{};
+}
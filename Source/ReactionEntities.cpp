@@ -52,7 +52,7 @@ namespace jsonifier {
 
 namespace discord_core_api {
 
-	template<> unordered_map<jsonifier::string, unbounded_message_block<reaction_data>*> object_collector<reaction_data>::objectsBuffersMap{};
+	template<> dense_map<jsonifier::string, unbounded_message_block<reaction_data>*> object_collector<reaction_data>::objectsBuffersMap{};
 
 	template<> object_collector<reaction_data>::object_collector() {
 		collectorId										 = jsonifier::toString(std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch()).count());
@@ -168,6 +168,25 @@ namespace discord_core_api {
 		co_return returnData;
 	}
 
+	paginator<jsonifier::vector<user_data>, get_reactions_data> reactions::getReactionsPaginated(get_reactions_data dataPackage, uint64_t prefetchWindow) {
+		if (dataPackage.limit == 0) {
+			dataPackage.limit = 100;
+		}
+		return paginator<jsonifier::vector<user_data>, get_reactions_data>{ dataPackage, &reactions::getReactionsAsync,
+			[](get_reactions_data& dataPackageNew, const jsonifier::vector<user_data>& page) {
+				if (page.size() < static_cast<uint64_t>(dataPackageNew.limit)) {
+					return false;
+				}
+				advanceSnowflakeCursor(dataPackageNew.afterId, page,
+					[](const user_data& value) -> const snowflake& {
+						return value.id;
+					},
+					true);
+				return true;
+			},
+			prefetchWindow };
+	}
+
 
 	co_routine<void> reactions::deleteAllReactionsAsync(const delete_all_reactions_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Delete_All_Reactions };
@@ -0,0 +1,361 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// RestProxy.cpp - Source file for the rest proxy.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file RestProxy.cpp
+
+#include <discordcoreapi/Utilities/RestProxy.hpp>
+
+namespace discord_core_api {
+
+	/// @brief The request headers that only concern the hop between a process and the proxy, and that the proxy sets again itself.
+	constexpr jsonifier::string_view hopByHopHeaders[]{ "host", "connection", "accept-encoding", "pragma", "authorization", "user-agent" };
+
+	/// @brief The response headers that aren't passed back on - the framing of the body, which the proxy redoes after having decoded it, and the rate limits,
+	/// which only the proxy should be waiting on.
+	constexpr jsonifier::string_view unrelayedResponseHeaders[]{ "content-length", "content-encoding", "transfer-encoding", "connection", "keep-alive" };
+
+	bool isItEqualIgnoringCase(jsonifier::string_view lhs, jsonifier::string_view rhs) {
+		if (lhs.size() != rhs.size()) {
+			return false;
+		}
+		for (uint64_t x = 0; x < lhs.size(); ++x) {
+			if (std::tolower(static_cast<unsigned char>(lhs[x])) != std::tolower(static_cast<unsigned char>(rhs[x]))) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool isItAHopByHopHeader(jsonifier::string_view key) {
+		for (auto& value: hopByHopHeaders) {
+			if (isItEqualIgnoringCase(value, key)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool isItAnUnrelayedResponseHeader(jsonifier::string_view key) {
+		if (key.substr(0, jsonifier::string_view{ "x-ratelimit-" }.size()) == "x-ratelimit-") {
+			return true;
+		}
+		for (auto& value: unrelayedResponseHeaders) {
+			if (isItEqualIgnoringCase(value, key)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/// @brief The reason phrases of the status codes that the proxy answers with itself - relayed responses keep discord's code, with a generic phrase.
+	jsonifier::string_view getReasonPhrase(uint64_t responseCode) {
+		switch (responseCode) {
+			case 403: {
+				return "Forbidden";
+			}
+			case 502: {
+				return "Bad Gateway";
+			}
+			case 503: {
+				return "Service Unavailable";
+			}
+			default: {
+				return "Relayed";
+			}
+		}
+	}
+
+	rest_proxy::rest_proxy(const rest_proxy_options& options) {
+		maxPendingConnections = options.maxPendingConnections;
+		idleTimeout			  = options.idleTimeout;
+		if (!discord_core_internal::ssl_context_holder::initialize(options.enableKernelTls)) {
+			message_printer::printError<print_message_type::general>("Failed to initialize the SSL_CTX structure!");
+			return;
+		}
+		httpsClient = makeUnique<discord_core_internal::https_client>(options.botToken);
+		discord_core_internal::addrinfo_wrapper hints{}, address{};
+		hints->ai_family   = AF_UNSPEC;
+		hints->ai_socktype = SOCK_STREAM;
+		hints->ai_protocol = IPPROTO_TCP;
+		hints->ai_flags	   = AI_PASSIVE;
+		if (getaddrinfo(options.bindAddress.data(), jsonifier::toString(options.port).data(), hints, address) != 0 || !address.operator addrinfo*()) {
+			message_printer::printError<print_message_type::general>(discord_core_internal::reportError("rest_proxy::rest_proxy()::getaddrinfo(), to: " + options.bindAddress));
+			return;
+		}
+		listeningSocket = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+		int32_t reuseAddress{ 1 };
+		if (!isValidSocket(listeningSocket.operator SOCKET()) ||
+			setsockopt(listeningSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuseAddress), sizeof(reuseAddress)) == SOCKET_ERROR ||
+			bind(listeningSocket, address->ai_addr, static_cast<int32_t>(address->ai_addrlen)) == SOCKET_ERROR || listen(listeningSocket, SOMAXCONN) == SOCKET_ERROR) {
+			message_printer::printError<print_message_type::general>(
+				discord_core_internal::reportError("rest_proxy::rest_proxy()::bind(), to: " + options.bindAddress + ":" + jsonifier::toString(options.port)));
+			listeningSocket = INVALID_SOCKET;
+			freeaddrinfo(address);
+			return;
+		}
+		freeaddrinfo(address);
+		for (uint64_t x = 0; x < std::max(options.workerCount, uint64_t{ 1 }); ++x) {
+			workers.emplace_back([this](std::stop_token token) {
+				runWorker(token);
+			});
+		}
+		message_printer::printSuccess<print_message_type::general>("rest_proxy listening on: " + options.bindAddress + ":" + jsonifier::toString(options.port));
+	}
+
+	bool rest_proxy::isItListening() {
+		return httpsClient && isValidSocket(listeningSocket.operator SOCKET());
+	}
+
+	void rest_proxy::run() {
+		while (!doWeQuit.load(std::memory_order_acquire) && isItListening()) {
+			pollfd fdEvent{};
+			fdEvent.fd	   = listeningSocket;
+			fdEvent.events = POLLIN;
+			if (auto result = poll(&fdEvent, 1, 100); result == SOCKET_ERROR) {
+				message_printer::printError<print_message_type::general>(discord_core_internal::reportError("rest_proxy::run()::poll()"));
+				break;
+			} else if (result == 0) {
+				continue;
+			}
+			SOCKET clientSocket = ::accept(listeningSocket, nullptr, nullptr);
+			if (!isValidSocket(clientSocket)) {
+				continue;
+			}
+			std::unique_lock lock{ pendingMutex };
+			if (pendingConnections.size() >= maxPendingConnections) {
+				lock.unlock();
+				discord_core_internal::socket_wrapper rejectedSocket{ clientSocket };
+				writeResponse(rejectedSocket, 503, unordered_map<jsonifier::string, jsonifier::string>{}, R"({"message":"the rest proxy is at capacity"})");
+				continue;
+			}
+			activeConnections.fetch_add(1, std::memory_order_acq_rel);
+			pendingConnections.emplace_back(clientSocket);
+			lock.unlock();
+			pendingCondition.notify_one();
+		}
+		while (activeConnections.load(std::memory_order_acquire) > 0) {
+			std::this_thread::sleep_for(1ms);
+		}
+	}
+
+	void rest_proxy::stop() {
+		doWeQuit.store(true, std::memory_order_release);
+	}
+
+	void rest_proxy::runWorker(std::stop_token token) {
+		while (!token.stop_requested()) {
+			SOCKET clientSocket{};
+			{
+				std::unique_lock lock{ pendingMutex };
+				if (!pendingCondition.wait(lock, token, [this] {
+						return pendingConnections.size() > 0;
+					})) {
+					return;
+				}
+				clientSocket = pendingConnections.front();
+				pendingConnections.pop_front();
+			}
+			serveConnection(clientSocket);
+			activeConnections.fetch_sub(1, std::memory_order_acq_rel);
+		}
+	}
+
+	void rest_proxy::serveConnection(SOCKET clientSocketNew) {
+		discord_core_internal::socket_wrapper clientSocket{ clientSocketNew };
+		jsonifier::string buffer{};
+		while (!doWeQuit.load(std::memory_order_acquire)) {
+			discord_core_internal::https_workload_data workload{};
+			if (!readRequest(clientSocket, buffer, workload)) {
+				return;
+			}
+			discord_core_internal::https_response_data returnData{};
+			try {
+				returnData = httpsClient->forwardWorkload(std::move(workload));
+			} catch (const std::exception& error) {
+				message_printer::printError<print_message_type::https>(error.what());
+			}
+			// a response code that was never set means that we couldn't reach discord at all, and the library's own codes (such as Decoding_Error) mean that
+			// its response was unusable - either way, it's the upstream that failed.
+			uint64_t responseCode{ returnData.responseCode.operator uint64_t() };
+			if (responseCode >= static_cast<uint64_t>(discord_core_internal::https_response_code::https_response_codes::Decoding_Error)) {
+				responseCode = 502;
+			}
+			if (!writeResponse(clientSocket, responseCode, returnData.responseHeaders, returnData.responseData)) {
+				return;
+			}
+		}
+	}
+
+	bool rest_proxy::readRequest(SOCKET clientSocket, jsonifier::string& buffer, discord_core_internal::https_workload_data& workload) {
+		// a connection that goes quiet - between requests, or halfway through one - is closed, so that it doesn't hold onto its worker.
+		auto lastActivity = hrclock::now();
+		auto receiveMore  = [&]() {
+			while (!doWeQuit.load(std::memory_order_acquire)) {
+				pollfd fdEvent{};
+				fdEvent.fd	   = clientSocket;
+				fdEvent.events = POLLIN;
+				if (auto result = poll(&fdEvent, 1, 100); result == SOCKET_ERROR) {
+					return false;
+				} else if (result == 0) {
+					if (hrclock::now() - lastActivity >= idleTimeout) {
+						return false;
+					}
+					continue;
+				}
+				std::array<char, 1024 * 16> readBuffer{};
+				auto readBytes = ::recv(clientSocket, readBuffer.data(), static_cast<int32_t>(readBuffer.size()), 0);
+				if (readBytes <= 0) {
+					return false;
+				}
+				buffer += jsonifier::string_view{ readBuffer.data(), static_cast<uint64_t>(readBytes) };
+				lastActivity = hrclock::now();
+				return true;
+			}
+			return false;
+		};
+		uint64_t headersEnd{};
+		while ((headersEnd = jsonifier::string_view{ buffer }.find("\r\n\r\n")) == jsonifier::string_view::npos) {
+			if (!receiveMore()) {
+				return false;
+			}
+		}
+		jsonifier::string_view headers{ buffer.data(), headersEnd + 2 };
+		auto lineEnd = headers.find("\r\n");
+		jsonifier::string_view requestLine{ headers.data(), lineEnd };
+		auto methodEnd = requestLine.find(' ');
+		auto urlEnd	   = requestLine.find(' ', methodEnd + 1);
+		if (methodEnd == jsonifier::string_view::npos || urlEnd == jsonifier::string_view::npos) {
+			message_printer::printError<print_message_type::https>("rest_proxy::readRequest() error: Malformed request line: " + static_cast<jsonifier::string>(requestLine));
+			return false;
+		}
+		jsonifier::string_view method{ requestLine.substr(0, methodEnd) };
+		jsonifier::string_view url{ requestLine.substr(methodEnd + 1, urlEnd - methodEnd - 1) };
+		// requests arrive in absolute form - and only those to discord's api are relayed, as every request goes out authorized with the proxy's token.
+		constexpr jsonifier::string_view discordBaseUrl{ "https://discord.com/api/v10" };
+		if (url.substr(0, discordBaseUrl.size()) != discordBaseUrl || (url.size() > discordBaseUrl.size() && url[discordBaseUrl.size()] != '/')) {
+			message_printer::printError<print_message_type::https>("rest_proxy::readRequest() error: Refusing to relay a request to: " + static_cast<jsonifier::string>(url));
+			writeResponse(clientSocket, 403, unordered_map<jsonifier::string, jsonifier::string>{},
+				R"({"message":"the rest proxy only relays requests to https://discord.com/api/v10"})");
+			return false;
+		}
+		uint64_t pathStart{ discordBaseUrl.size() };
+		workload = discord_core_internal::https_workload_type::Unset;
+		if (method == "GET") {
+			workload.workloadClass = discord_core_internal::https_workload_class::Get;
+		} else if (method == "POST") {
+			workload.workloadClass = discord_core_internal::https_workload_class::Post;
+		} else if (method == "PATCH") {
+			workload.workloadClass = discord_core_internal::https_workload_class::Patch;
+		} else if (method == "PUT") {
+			workload.workloadClass = discord_core_internal::https_workload_class::Put;
+		} else if (method == "DELETE") {
+			workload.workloadClass = discord_core_internal::https_workload_class::Delete;
+		} else {
+			message_printer::printError<print_message_type::https>("rest_proxy::readRequest() error: Unsupported method: " + static_cast<jsonifier::string>(method));
+			return false;
+		}
+		workload.baseUrl	  = static_cast<jsonifier::string>(url.substr(0, pathStart));
+		workload.relativePath = static_cast<jsonifier::string>(url.substr(pathStart));
+		workload.callStack	  = "rest_proxy::readRequest()";
+		uint64_t contentLength{};
+		for (uint64_t pos = lineEnd + 2; pos < headers.size(); pos = lineEnd + 2) {
+			lineEnd = headers.find("\r\n", pos);
+			if (lineEnd == jsonifier::string_view::npos) {
+				break;
+			}
+			jsonifier::string_view line{ headers.data() + pos, lineEnd - pos };
+			auto colon = line.find(':');
+			if (colon == jsonifier::string_view::npos) {
+				continue;
+			}
+			jsonifier::string_view key{ line.substr(0, colon) };
+			jsonifier::string_view value{ line.substr(colon + 1) };
+			while (value.size() > 0 && value[0] == ' ') {
+				value = value.substr(1);
+			}
+			if (isItEqualIgnoringCase(key, discord_core_internal::workloadTypeHeader)) {
+				// the workload type selects the rate-limit bucket, exactly as it would have in the sending process.
+				if (auto workloadType = jsonifier::strToUint64(static_cast<jsonifier::string>(value).data());
+					workloadType < static_cast<uint64_t>(discord_core_internal::https_workload_type::Last)) {
+					workload = static_cast<discord_core_internal::https_workload_type>(workloadType);
+				}
+			} else if (isItEqualIgnoringCase(key, "content-length")) {
+				contentLength = jsonifier::strToUint64(static_cast<jsonifier::string>(value).data());
+			} else if (!isItAHopByHopHeader(key)) {
+				if (value.substr(0, jsonifier::string_view{ "multipart/form-data" }.size()) == "multipart/form-data") {
+					workload.payloadType = discord_core_internal::payload_type::Multipart_Form;
+				}
+				workload.headersToInsert.emplace(static_cast<jsonifier::string>(key), static_cast<jsonifier::string>(value));
+			}
+		}
+		while (buffer.size() < headersEnd + 4 + contentLength) {
+			if (!receiveMore()) {
+				return false;
+			}
+		}
+		workload.content = static_cast<jsonifier::string>(jsonifier::string_view{ buffer.data() + headersEnd + 4, contentLength });
+		buffer.erase(buffer.begin() + static_cast<int64_t>(headersEnd + 4 + contentLength));
+		return true;
+	}
+
+	bool rest_proxy::writeResponse(SOCKET clientSocket, uint64_t responseCode, const unordered_map<jsonifier::string, jsonifier::string>& responseHeaders,
+		jsonifier::string_view responseData) {
+		jsonifier::string response{ "HTTP/1.1 " + jsonifier::toString(responseCode) + " " + static_cast<jsonifier::string>(getReasonPhrase(responseCode)) + "\r\n" };
+		// the upstream response only keeps the headers that https_rnr_builder records - of those, location is the one worth passing on.
+		for (auto& [key, value]: responseHeaders) {
+			if (!isItAnUnrelayedResponseHeader(key)) {
+				response += key + ": " + value + "\r\n";
+			}
+		}
+		if (!responseHeaders.contains("content-type")) {
+			response += "Content-Type: application/json\r\n";
+		}
+		response += "Content-Length: " + jsonifier::toString(responseData.size()) + "\r\n";
+		response += "Connection: keep-alive\r\n\r\n";
+		response += responseData;
+		uint64_t writtenBytes{};
+		while (writtenBytes < response.size()) {
+			auto result = ::send(clientSocket, response.data() + writtenBytes, static_cast<int32_t>(response.size() - writtenBytes), 0);
+			if (result == SOCKET_ERROR) {
+				return false;
+			}
+			writtenBytes += static_cast<uint64_t>(result);
+		}
+		return true;
+	}
+
+	rest_proxy::~rest_proxy() {
+		stop();
+		// the workers notice the stop between connections, and their current ones close on their own once doWeQuit is seen.
+		workers.clear();
+		for (auto& value: pendingConnections) {
+			discord_core_internal::socket_wrapper closedSocket{ value };
+		}
+	}
+
+}
@@ -144,6 +144,7 @@ namespace discord_core_api {
 	void roles::initialize(discord_core_internal::https_client* client, config_manager* configManagerNew) {
 		roles::doWeCacheRolesBool = configManagerNew->doWeCacheRoles();
 		roles::httpsClient		  = client;
+		roles::cache.setEvictionPolicy(configManagerNew->getCacheOptions().rolePolicy);
 	}
 
 	co_routine<void> roles::addGuildMemberRoleAsync(const add_guild_member_role_data dataPackage) {
@@ -262,8 +263,8 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		role_data data{ dataPackage.roleId };
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
+		if (auto cachedData = cache.find(data.id)) {
+			data = *cachedData;
 		}
 		roles::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
 		if (doWeCacheRolesBool) {
@@ -306,8 +307,8 @@ namespace discord_core_api {
 			throw dca_exception{ "roles::getRoleAsync() error: sorry, but you forgot to set the guildId!" };
 		}
 		role_data data{ dataPackage.roleId };
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
+		if (auto cachedData = cache.find(data.id)) {
+			data = *cachedData;
 		}
 		for (auto& value: roles) {
 			if (value.id == dataPackage.roleId) {
@@ -321,14 +322,28 @@ namespace discord_core_api {
 	}
 
 	role_cache_data roles::getCachedRole(const get_role_data dataPackage) {
-		if (cache.contains(dataPackage.roleId)) {
-			return cache[dataPackage.roleId];
+		if (auto cachedData = cache.find(dataPackage.roleId)) {
+			return *cachedData;
+		} else if (auto snapshotData = cache_snapshot::take<role_cache_data>(dataPackage.roleId)) {
+			insertRole(*snapshotData);
+			return *snapshotData;
 		} else {
 			return getRoleAsync({ .guildId = dataPackage.guildId, .roleId = dataPackage.roleId }).get();
 		}
 	}
 
+	cache_view<role_cache_data> roles::getCachedRoleView(const get_role_data dataPackage) {
+		if (auto cachedData = cache.view(dataPackage.roleId)) {
+			return cachedData;
+		}
+		if (auto snapshotData = cache_snapshot::take<role_cache_data>(dataPackage.roleId)) {
+			insertRole(std::move(*snapshotData));
+		}
+		return cache.view(dataPackage.roleId);
+	}
+
 	void roles::removeRole(const role_cache_data& roleId) {
+		cache_snapshot::discard<role_cache_data>(roleId.id);
 		cache.erase(roleId);
 	};
 
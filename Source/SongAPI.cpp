@@ -41,7 +41,7 @@ namespace discord_core_api {
 	}
 
 	void song_api::onSongCompletion(std::function<co_routine<void, false>(song_completion_event_data)> handler) {
-		onSongCompletionEvent.functions.clear();
+		onSongCompletionEvent.clear();
 		eventToken = onSongCompletionEvent.add(handler);
 	}
 
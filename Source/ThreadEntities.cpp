@@ -205,6 +205,20 @@ namespace discord_core_api {
 		co_return returnData;
 	}
 
+	paginator<archived_threads_data, get_public_archived_threads_data> threads::getPublicArchivedThreadsPaginated(get_public_archived_threads_data dataPackage,
+		uint64_t prefetchWindow) {
+		return paginator<archived_threads_data, get_public_archived_threads_data>{ dataPackage, &threads::getPublicArchivedThreadsAsync,
+			[](get_public_archived_threads_data& dataPackageNew, const archived_threads_data& page) {
+				// threads come back newest-archived first, so the last one of a page is where the next page starts.
+				if (!page.hasMore || page.threads.size() == 0) {
+					return false;
+				}
+				dataPackageNew.before = page.threads.back().threadMetadata.archiveTimestamp;
+				return true;
+			},
+			prefetchWindow };
+	}
+
 	co_routine<archived_threads_data> threads::getPrivateArchivedThreadsAsync(const get_private_archived_threads_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Get_Private_Archived_Threads };
 		co_await newThreadAwaitable<archived_threads_data>();
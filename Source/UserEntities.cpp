@@ -96,9 +96,12 @@ namespace discord_core_api {
 	}
 
 	user_cache_data& user_cache_data::operator=(const user_data& other) {
-		premiumType = static_cast<premium_type>(other.premiumType);
+		using projection = cache_projection<user_cache_data>;
+		if (projection::keeps(user_cache_fields::premium_type)) {
+			premiumType = static_cast<premium_type>(other.premiumType);
+		}
 		setFlagValue(user_flags::Verified, other.verified);
-		if (other.avatarDecoration != "") {
+		if (projection::keeps(user_cache_fields::avatar_decoration) && other.avatarDecoration != "") {
 			avatarDecoration = other.avatarDecoration;
 		}
 		if (static_cast<int64_t>(other.flags) != 0) {
@@ -106,22 +109,22 @@ namespace discord_core_api {
 		}
 		setFlagValue(user_flags::System, other.system);
 		setFlagValue(user_flags::Bot, other.bot);
-		if (other.discriminator != "") {
+		if (projection::keeps(user_cache_fields::discriminator) && other.discriminator != "") {
 			discriminator = other.discriminator;
 		}
-		if (other.accentColor != 0) {
+		if (projection::keeps(user_cache_fields::accent_color) && other.accentColor != 0) {
 			accentColor = other.accentColor;
 		}
-		if (other.globalName != "") {
+		if (projection::keeps(user_cache_fields::global_name) && other.globalName != "") {
 			globalName = other.globalName;
 		}
-		if (other.userName != "") {
+		if (projection::keeps(user_cache_fields::user_name) && other.userName != "") {
 			userName = other.userName;
 		}
-		if (other.banner != "") {
+		if (projection::keeps(user_cache_fields::banner) && other.banner != "") {
 			banner = other.banner;
 		}
-		if (other.avatar != "") {
+		if (projection::keeps(user_cache_fields::avatar) && other.avatar != "") {
 			avatar = other.avatar;
 		}
 		if (other.id != 0) {
@@ -135,32 +138,35 @@ namespace discord_core_api {
 	}
 
 	user_cache_data& user_cache_data::operator=(user_data&& other) noexcept {
-		premiumType = static_cast<premium_type>(other.premiumType);
-		if (other.avatarDecoration != "") {
+		using projection = cache_projection<user_cache_data>;
+		if (projection::keeps(user_cache_fields::premium_type)) {
+			premiumType = static_cast<premium_type>(other.premiumType);
+		}
+		if (projection::keeps(user_cache_fields::avatar_decoration) && other.avatarDecoration != "") {
 			avatarDecoration = std::move(other.avatarDecoration);
 		}
-		if (other.discriminator != "") {
+		if (projection::keeps(user_cache_fields::discriminator) && other.discriminator != "") {
 			discriminator = std::move(other.discriminator);
 		}
 		setFlagValue(user_flags::Verified, other.verified);
 		setFlagValue(user_flags::System, other.system);
-		if (other.globalName != "") {
+		if (projection::keeps(user_cache_fields::global_name) && other.globalName != "") {
 			globalName = std::move(other.globalName);
 		}
 		if (static_cast<int64_t>(other.flags) != 0) {
 			flags = other.flags;
 		}
 		setFlagValue(user_flags::Bot, other.bot);
-		if (other.userName != "") {
+		if (projection::keeps(user_cache_fields::user_name) && other.userName != "") {
 			userName = std::move(other.userName);
 		}
-		if (other.banner != "") {
+		if (projection::keeps(user_cache_fields::banner) && other.banner != "") {
 			banner = std::move(other.banner);
 		}
-		if (other.avatar != "") {
+		if (projection::keeps(user_cache_fields::avatar) && other.avatar != "") {
 			avatar = std::move(other.avatar);
 		}
-		if (other.accentColor != 0) {
+		if (projection::keeps(user_cache_fields::accent_color) && other.accentColor != 0) {
 			accentColor = other.accentColor;
 		}
 		if (other.id != 0) {
@@ -269,6 +275,7 @@ namespace discord_core_api {
 	void users::initialize(discord_core_internal::https_client* client, config_manager* configManagerNew) {
 		users::doWeCacheUsersBool = configManagerNew->doWeCacheUsers();
 		users::httpsClient		  = client;
+		users::cache.setEvictionPolicy(configManagerNew->getCacheOptions().userPolicy);
 	}
 
 	co_routine<void> users::addRecipientToGroupDMAsync(const add_recipient_to_group_dmdata dataPackage) {
@@ -320,19 +327,31 @@ namespace discord_core_api {
 		workload.callStack	   = "users::getCurrentUserAsync()";
 		user_data returnData{};
 		users::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
-		auto newId = returnData.id;
 		insertUser(static_cast<user_cache_data>(returnData));
-		co_return cache[newId];
+		co_return returnData;
 	}
 
 	user_cache_data users::getCachedUser(const get_user_data dataPackage) {
-		if (cache.contains(dataPackage.userId)) {
-			return cache[dataPackage.userId];
+		if (auto cachedData = cache.find(dataPackage.userId)) {
+			return *cachedData;
+		} else if (auto snapshotData = cache_snapshot::take<user_cache_data>(dataPackage.userId)) {
+			insertUser(*snapshotData);
+			return *snapshotData;
 		} else {
 			return getUserAsync({ .userId = dataPackage.userId }).get();
 		}
 	}
 
+	cache_view<user_cache_data> users::getCachedUserView(const get_user_data dataPackage) {
+		if (auto cachedData = cache.view(dataPackage.userId)) {
+			return cachedData;
+		}
+		if (auto snapshotData = cache_snapshot::take<user_cache_data>(dataPackage.userId)) {
+			insertUser(std::move(*snapshotData));
+		}
+		return cache.view(dataPackage.userId);
+	}
+
 	co_routine<user_data> users::getUserAsync(const get_user_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Get_User };
 		co_await newThreadAwaitable<user_data>();
@@ -340,8 +359,8 @@ namespace discord_core_api {
 		workload.relativePath  = "/users/" + dataPackage.userId;
 		workload.callStack	   = "users::getUserAsync()";
 		user_data data{ dataPackage.userId };
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
+		if (auto cachedData = cache.find(data.id)) {
+			data = *cachedData;
 		}
 		users::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
 		if (doWeCacheUsersBool) {
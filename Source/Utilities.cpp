@@ -39,6 +39,7 @@
 #include <discordcoreapi/ChannelEntities.hpp>
 #include <discordcoreapi/CoRoutine.hpp>
 #include <discordcoreapi/InputEvents.hpp>
+#include <discordcoreapi/PermissionEngine.hpp>
 #include <discordcoreapi/Utilities.hpp>
 #include <fstream>
 #include <time.h>
@@ -128,6 +129,22 @@ namespace discord_core_api {
 		return config.cacheOptions.cacheRoles;
 	}
 
+	bool config_manager::doWeUseCompactGuildMembers() const {
+		return config.cacheOptions.compactGuildMembers;
+	}
+
+	const cache_options& config_manager::getCacheOptions() const {
+		return config.cacheOptions;
+	}
+
+	const https_options& config_manager::getHttpsOptions() const {
+		return config.httpsOptions;
+	}
+
+	bool config_manager::doWeUseKernelTls() const {
+		return config.tlsOptions.enableKernelTls;
+	}
+
 	update_presence_data config_manager::getPresenceData() const {
 		return config.presenceData;
 	}
@@ -308,15 +325,12 @@ namespace discord_core_api {
 				break;
 			}
 		}
-		jsonifier::vector<role_data> guildMemberRoles{};
-		for (auto& value: guildMember.roles) {
-			guildMemberRoles.emplace_back(roles::getCachedRole({ .guildId = guildMember.guildId, .roleId = value }));
-		}
 		uint64_t allow{};
 		uint64_t deny{};
-		for (auto& value: guildMemberRoles) {
+		// only the ids of the member's roles matter here, so there's no need to look the roles themselves up.
+		for (auto& value: guildMember.roles) {
 			for (uint64_t x = 0; x < channel.permissionOverwrites.size(); ++x) {
-				if (value.id == channel.permissionOverwrites.at(x).id) {
+				if (value == channel.permissionOverwrites.at(x).id) {
 					allow |= channel.permissionOverwrites.at(x).allow;
 					deny |= channel.permissionOverwrites.at(x).deny;
 				}
@@ -334,8 +348,24 @@ namespace discord_core_api {
 		return jsonifier::toString(permissions);
 	}
 
+	template<> uint64_t permissions_base<permissions>::computePermissionBits(const guild_member_data& guildMember, const channel_data& channel) {
+		if (auto basePermissions = permission_engine::computeBase(guildMember)) {
+			return permission_engine::applyOverwrites(*basePermissions, guildMember, channel.permissionOverwrites);
+		}
+		return jsonifier::strToUint64(computeOverwrites(computeBasePermissions(guildMember), guildMember, channel).data());
+	}
+
 	template<> jsonifier::string permissions_base<permissions>::computeBasePermissions(const guild_member_data& guildMember) {
-		const guild_cache_data guild = guilds::getCachedGuild({ .guildId = guildMember.guildId });
+		if (auto basePermissions = permission_engine::computeBase(guildMember)) {
+			return jsonifier::toString(*basePermissions);
+		}
+		// viewing the cached guild in place avoids copying it, which is only ever needed when it isn't cached.
+		auto guildView = guilds::getCachedGuildView({ .guildId = guildMember.guildId });
+		guild_cache_data guildCopy{};
+		if (!guildView) {
+			guildCopy = guilds::getCachedGuild({ .guildId = guildMember.guildId });
+		}
+		const guild_cache_data& guild = guildView ? *guildView : guildCopy;
 		if (guild.ownerId == guildMember.user.id) {
 			return getAllPermissions();
 		}
@@ -392,19 +422,12 @@ namespace discord_core_api {
 				break;
 			}
 		}
-		jsonifier::vector<role_data> guildMemberRoles{};
-		if (roles::doWeCacheRoles()) {
-			for (auto& value: guildMember.roles) {
-				guildMemberRoles.emplace_back(roles::getCachedRole({ .roleId = value }));
-			}
-		} else {
-			guildMemberRoles = roles::getGuildMemberRolesAsync({ .guildMember = guildMember, .guildId = guildMember.guildId }).get();
-		}
 		uint64_t allow{};
 		uint64_t deny{};
-		for (auto& value: guildMemberRoles) {
+		// only the ids of the member's roles matter here, so there's no need to look the roles themselves up.
+		for (auto& value: guildMember.roles) {
 			for (uint64_t x = 0; x < channel.permissionOverwrites.size(); ++x) {
-				if (value.id == channel.permissionOverwrites.at(x).id) {
+				if (value == channel.permissionOverwrites.at(x).id) {
 					allow |= channel.permissionOverwrites.at(x).allow;
 					deny |= channel.permissionOverwrites.at(x).deny;
 				}
@@ -422,7 +445,17 @@ namespace discord_core_api {
 		return jsonifier::toString(permissions);
 	}
 
+	template<> uint64_t permissions_base<permissions_parse>::computePermissionBits(const guild_member_data& guildMember, const channel_data& channel) {
+		if (auto basePermissions = permission_engine::computeBase(guildMember)) {
+			return permission_engine::applyOverwrites(*basePermissions, guildMember, channel.permissionOverwrites);
+		}
+		return jsonifier::strToUint64(computeOverwrites(computeBasePermissions(guildMember), guildMember, channel).data());
+	}
+
 	template<> jsonifier::string permissions_base<permissions_parse>::computeBasePermissions(const guild_member_data& guildMember) {
+		if (auto basePermissions = permission_engine::computeBase(guildMember)) {
+			return jsonifier::toString(*basePermissions);
+		}
 		const guild_data guild = guilds::getCachedGuild({ .guildId = guildMember.guildId });
 		if (guild.ownerId == guildMember.user.id) {
 			return getAllPermissions();
@@ -459,26 +492,59 @@ namespace discord_core_api {
 		return jsonifier::toString(permissions);
 	}
 
-	jsonifier::string constructMultiPartData(jsonifier::string_view data, const jsonifier::vector<file>& files) {
+	multipart_body::multipart_body(jsonifier::string&& payloadJsonNew, const jsonifier::vector<file>& files) {
 		const jsonifier::string boundary("boundary25");
-		const jsonifier::string partStart("--" + boundary + "\r\nContent-type: application/octet-stream\r\nContent-disposition: form-data; ");
-
-		jsonifier::string content("--" + boundary);
-
-		content += "\r\nContent-type: application/json\r\nContent-disposition: form-data; "
-				   "name=\"payload_json\"\r\n\r\n";
-		content += data + "\r\n";
-		if (files.size() == 1) {
-			content += partStart + "name=\"file\"; filename=\"" + files.at(0).fileName + "\"" + "\r\n\r\n";
-			content += files.at(0).data;
-		} else {
-			for (uint64_t x = 0; x < files.size(); ++x) {
-				content += partStart + "name=\"files[" + jsonifier::toString(x) + "]\"; filename=\"" + files.at(x).fileName + "\"\r\n\r\n";
-				content += files.at(x).data;
-				content += "\r\n";
+		const jsonifier::string partStart("\r\n--" + boundary + "\r\nContent-type: application/octet-stream\r\nContent-disposition: form-data; ");
+		parts.reserve(files.size());
+		payloadHeader = "--" + boundary +
+			"\r\nContent-type: application/json\r\nContent-disposition: form-data; "
+			"name=\"payload_json\"\r\n\r\n";
+		payloadJson = std::move(payloadJsonNew);
+		for (uint64_t x = 0; x < files.size(); ++x) {
+			auto& newPart = parts.emplace_back();
+			jsonifier::string fileName{ files.at(x).fileName };
+			if (fileName.empty() && !files.at(x).filePath.empty()) {
+				jsonifier::string_view filePath{ files.at(x).filePath };
+				uint64_t nameStart{ filePath.size() };
+				while (nameStart > 0 && filePath[nameStart - 1] != '/' && filePath[nameStart - 1] != '\\') {
+					--nameStart;
+				}
+				fileName = static_cast<jsonifier::string>(filePath.substr(nameStart));
+			}
+			newPart.header = partStart + (files.size() == 1 ? jsonifier::string{ "name=\"file\"" } : "name=\"files[" + jsonifier::toString(x) + "]\"") + "; filename=\"" +
+				fileName + "\"\r\n\r\n";
+			if (files.at(x).data.empty() && !files.at(x).filePath.empty()) {
+				newPart.mapping = mapped_file{ files.at(x).filePath };
+			} else {
+				newPart.data = files.at(x).data;
 			}
 		}
-		content += "\r\n--" + boundary + "--";
+		trailer = "\r\n--" + boundary + "--";
+	}
+
+	uint64_t multipart_body::size() const {
+		uint64_t returnValue{};
+		forEachSegment([&](jsonifier::string_view segment, const mapped_file*) {
+			returnValue += segment.size();
+		});
+		return returnValue;
+	}
+
+	bool multipart_body::empty() const {
+		return payloadHeader.empty();
+	}
+
+	jsonifier::string_view multipart_body::getPayloadJson() const {
+		return payloadJson;
+	}
+
+	jsonifier::string constructMultiPartData(jsonifier::string_view data, const jsonifier::vector<file>& files) {
+		multipart_body body{ static_cast<jsonifier::string>(data), files };
+		jsonifier::string content{};
+		content.reserve(body.size());
+		body.forEachSegment([&](jsonifier::string_view segment, const mapped_file*) {
+			content += segment;
+		});
 		return content;
 	}
 
@@ -159,7 +159,7 @@ namespace discord_core_api {
 		}
 	}
 
-	voice_connection_bridge::voice_connection_bridge(unordered_map<uint64_t, unique_ptr<voice_user>>* voiceUsersPtrNew, jsonifier::string_base<uint8_t>& encryptionKeyNew,
+	voice_connection_bridge::voice_connection_bridge(dense_map<uint64_t, unique_ptr<voice_user>>* voiceUsersPtrNew, jsonifier::string_base<uint8_t>& encryptionKeyNew,
 		stream_type streamType, const jsonifier::string& baseUrlNew, const uint16_t portNew, snowflake guildIdNew,
 		std::coroutine_handle<discord_core_api::co_routine<void, false>::promise_type>* tokenNew)
 		: udp_connection{ baseUrlNew, portNew, streamType, tokenNew } {
@@ -853,8 +853,8 @@ namespace discord_core_api {
 		completionEventData.guildMemberId = currentUserId;
 		try {
 			xferAudioData.clearData();
-			if (discord_core_client::getInstance()->getSongAPI(voiceConnectInitData.guildId).onSongCompletionEvent.functions.size() > 0) {
-				discord_core_client::getInstance()->getSongAPI(voiceConnectInitData.guildId).onSongCompletionEvent(completionEventData);
+			if (discord_core_client::getInstance()->getSongAPI(voiceConnectInitData.guildId).onSongCompletionEvent.size() > 0) {
+				discord_core_client::getInstance()->getSongAPI(voiceConnectInitData.guildId).onSongCompletionEvent.dispatch(completionEventData).get();
 			} else {
 				stop();
 			}
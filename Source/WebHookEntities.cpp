@@ -355,12 +355,10 @@ namespace discord_core_api {
 		if (dataPackage.threadId != 0) {
 			workload.relativePath += "?thread_id=" + dataPackage.threadId;
 		}
+		parser.serializeJson(dataPackage, workload.content);
 		if (dataPackage.files.size() > 0) {
-			workload.payloadType = discord_core_internal::payload_type::Multipart_Form;
-			parser.serializeJson(dataPackage, workload.content);
-			workload.content = constructMultiPartData(workload.content, dataPackage.files);
-		} else {
-			parser.serializeJson(dataPackage, workload.content);
+			workload.payloadType	  = discord_core_internal::payload_type::Multipart_Form;
+			workload.multipartContent = multipart_body{ std::move(workload.content), dataPackage.files };
 		}
 		message_data returnData{};
 		discord_core_api::web_hooks::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
@@ -389,12 +387,10 @@ namespace discord_core_api {
 		if (dataPackage.threadId != 0) {
 			workload.relativePath += "?thread_id=" + dataPackage.threadId;
 		}
+		parser.serializeJson(dataPackage, workload.content);
 		if (dataPackage.files.size() > 0) {
-			workload.payloadType = discord_core_internal::payload_type::Multipart_Form;
-			parser.serializeJson(dataPackage, workload.content);
-			workload.content = constructMultiPartData(workload.content, dataPackage.files);
-		} else {
-			parser.serializeJson(dataPackage, workload.content);
+			workload.payloadType	  = discord_core_internal::payload_type::Multipart_Form;
+			workload.multipartContent = multipart_body{ std::move(workload.content), dataPackage.files };
 		}
 		workload.callStack = "discord_core_api::web_hooks::editWebHookMessageAsync()";
 		message_data returnData{};
@@ -225,7 +225,8 @@ namespace discord_core_api {
 			return true;
 		}
 
-		websocket_tcpconnection::websocket_tcpconnection(const jsonifier::string& baseUrlNew, uint16_t portNew, websocket_core* ptrNew) : tcp_connection{ baseUrlNew, portNew } {
+		websocket_tcpconnection::websocket_tcpconnection(const jsonifier::string& baseUrlNew, uint16_t portNew, websocket_core* ptrNew)
+			: tcp_connection{ baseUrlNew, portNew, true, milliseconds{ 10000 } } {
 			ptr = ptrNew;
 		}
 
@@ -565,7 +566,7 @@ namespace discord_core_api {
 					switch (static_cast<websocket_op_codes>(message.op)) {
 						case websocket_op_codes::dispatch: {
 							if (message.t != "") {
-								switch (event_converter{ message.t }) {
+								switch (uint64_t eventType{ event_converter{ message.t } }; eventType) {
 									case 1: {
 										websocket_message_data<ready_data> data{};
 										if (dataOpCode == websocket_op_code::Op_Text) {
@@ -596,413 +597,43 @@ namespace discord_core_api {
 										currentReconnectTries = 0;
 										break;
 									}
-									case 3: {
-										if (discord_core_client::getInstance()->eventManager.onApplicationCommandPermissionsUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_application_command_permissions_update_data> dataPackage{ makeUnique<on_application_command_permissions_update_data>(
-												parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onApplicationCommandPermissionsUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 4: {
-										if (discord_core_client::getInstance()->eventManager.onAutoModerationRuleCreationEvent.functions.size() > 0) {
-											unique_ptr<on_auto_moderation_rule_creation_data> dataPackage{ makeUnique<on_auto_moderation_rule_creation_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onAutoModerationRuleCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 5: {
-										if (discord_core_client::getInstance()->eventManager.onAutoModerationRuleUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_auto_moderation_rule_update_data> dataPackage{ makeUnique<on_auto_moderation_rule_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onAutoModerationRuleUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 6: {
-										if (discord_core_client::getInstance()->eventManager.onAutoModerationRuleDeletionEvent.functions.size() > 0) {
-											unique_ptr<on_auto_moderation_rule_deletion_data> dataPackage{ makeUnique<on_auto_moderation_rule_deletion_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onAutoModerationRuleDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 7: {
-										if (discord_core_client::getInstance()->eventManager.onAutoModerationActionExecutionEvent.functions.size() > 0) {
-											unique_ptr<on_auto_moderation_action_execution_data> dataPackage{ makeUnique<on_auto_moderation_action_execution_data>(parser,
-												dataNew) };
-											discord_core_client::getInstance()->eventManager.onAutoModerationActionExecutionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 8: {
-										unique_ptr<on_channel_creation_data> dataPackage{ makeUnique<on_channel_creation_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onChannelCreationEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onChannelCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 9: {
-										unique_ptr<on_channel_update_data> dataPackage{ makeUnique<on_channel_update_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onChannelUpdateEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onChannelUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 10: {
-										unique_ptr<on_channel_deletion_data> dataPackage{ makeUnique<on_channel_deletion_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onChannelDeletionEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onChannelDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 11: {
-										if (discord_core_client::getInstance()->eventManager.onChannelPinsUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_channel_pins_update_data> dataPackage{ makeUnique<on_channel_pins_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onChannelPinsUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 12: {
-										if (discord_core_client::getInstance()->eventManager.onThreadCreationEvent.functions.size() > 0) {
-											unique_ptr<on_thread_creation_data> dataPackage{ makeUnique<on_thread_creation_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onThreadCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 13: {
-										if (discord_core_client::getInstance()->eventManager.onThreadUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_thread_update_data> dataPackage{ makeUnique<on_thread_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onThreadUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 14: {
-										if (discord_core_client::getInstance()->eventManager.onThreadDeletionEvent.functions.size() > 0) {
-											unique_ptr<on_thread_deletion_data> dataPackage{ makeUnique<on_thread_deletion_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onThreadDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 15: {
-										if (discord_core_client::getInstance()->eventManager.onThreadListSyncEvent.functions.size() > 0) {
-											unique_ptr<on_thread_list_sync_data> dataPackage{ makeUnique<on_thread_list_sync_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onThreadListSyncEvent(*dataPackage);
-										}
-										break;
-									}
-									case 16: {
-										if (discord_core_client::getInstance()->eventManager.onThreadMemberUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_thread_member_update_data> dataPackage{ makeUnique<on_thread_member_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onThreadMemberUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 17: {
-										if (discord_core_client::getInstance()->eventManager.onThreadMembersUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_thread_members_update_data> dataPackage{ makeUnique<on_thread_members_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onThreadMembersUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 18: {
-										unique_ptr<on_guild_creation_data> dataPackage{ makeUnique<on_guild_creation_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onGuildCreationEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onGuildCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 19: {
-										unique_ptr<on_guild_update_data> dataPackage{ makeUnique<on_guild_update_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onGuildUpdateEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onGuildUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 20: {
-										unique_ptr<on_guild_deletion_data> dataPackage{ makeUnique<on_guild_deletion_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onGuildDeletionEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onGuildDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 21: {
-										if (discord_core_client::getInstance()->eventManager.onGuildBanAddEvent.functions.size() > 0) {
-											unique_ptr<on_guild_ban_add_data> dataPackage{ makeUnique<on_guild_ban_add_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildBanAddEvent(*dataPackage);
-										}
-										break;
-									}
-									case 22: {
-										if (discord_core_client::getInstance()->eventManager.onGuildBanRemoveEvent.functions.size() > 0) {
-											unique_ptr<on_guild_ban_remove_data> dataPackage{ makeUnique<on_guild_ban_remove_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildBanRemoveEvent(*dataPackage);
-										}
-										break;
-									}
-									case 23: {
-										if (discord_core_client::getInstance()->eventManager.onGuildEmojisUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_guild_emojis_update_data> dataPackage{ makeUnique<on_guild_emojis_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildEmojisUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 24: {
-										if (discord_core_client::getInstance()->eventManager.onGuildStickersUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_guild_stickers_update_data> dataPackage{ makeUnique<on_guild_stickers_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildStickersUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 25: {
-										if (discord_core_client::getInstance()->eventManager.onGuildIntegrationsUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_guild_integrations_update_data> dataPackage{ makeUnique<on_guild_integrations_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildIntegrationsUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 26: {
-										unique_ptr<on_guild_member_add_data> dataPackage{ makeUnique<on_guild_member_add_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onGuildMemberAddEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onGuildMemberAddEvent(*dataPackage);
-										}
-										break;
-									}
-									case 27: {
-										unique_ptr<on_guild_member_remove_data> dataPackage{ makeUnique<on_guild_member_remove_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onGuildMemberRemoveEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onGuildMemberRemoveEvent(*dataPackage);
-										}
-										break;
-									}
-									case 28: {
-										unique_ptr<on_guild_member_update_data> dataPackage{ makeUnique<on_guild_member_update_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onGuildMemberUpdateEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onGuildMemberUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 29: {
-										if (discord_core_client::getInstance()->eventManager.onGuildMembersChunkEvent.functions.size() > 0) {
-											unique_ptr<on_guild_members_chunk_data> dataPackage{ makeUnique<on_guild_members_chunk_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildMembersChunkEvent(*dataPackage);
-										}
-										break;
-									}
-									case 30: {
-										unique_ptr<on_role_creation_data> dataPackage{ makeUnique<on_role_creation_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onRoleCreationEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onRoleCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 31: {
-										unique_ptr<on_role_update_data> dataPackage{ makeUnique<on_role_update_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onRoleUpdateEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onRoleUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 32: {
-										unique_ptr<on_role_deletion_data> dataPackage{ makeUnique<on_role_deletion_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onRoleDeletionEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onRoleDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 33: {
-										if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventCreationEvent.functions.size() > 0) {
-											unique_ptr<on_guild_scheduled_event_creation_data> dataPackage{ makeUnique<on_guild_scheduled_event_creation_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildScheduledEventCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 34: {
-										if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_guild_scheduled_event_update_data> dataPackage{ makeUnique<on_guild_scheduled_event_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildScheduledEventUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 35: {
-										if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventDeletionEvent.functions.size() > 0) {
-											unique_ptr<on_guild_scheduled_event_deletion_data> dataPackage{ makeUnique<on_guild_scheduled_event_deletion_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildScheduledEventDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 36: {
-										if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserAddEvent.functions.size() > 0) {
-											unique_ptr<on_guild_scheduled_event_user_add_data> dataPackage{ makeUnique<on_guild_scheduled_event_user_add_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserAddEvent(*dataPackage);
-										}
-										break;
-									}
-									case 37: {
-										if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserRemoveEvent.functions.size() > 0) {
-											unique_ptr<on_guild_scheduled_event_user_remove_data> dataPackage{ makeUnique<on_guild_scheduled_event_user_remove_data>(parser,
-												dataNew) };
-											discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserRemoveEvent(*dataPackage);
-										}
-										break;
-									}
-									case 38: {
-										if (discord_core_client::getInstance()->eventManager.onIntegrationCreationEvent.functions.size() > 0) {
-											unique_ptr<on_integration_creation_data> dataPackage{ makeUnique<on_integration_creation_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onIntegrationCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 39: {
-										if (discord_core_client::getInstance()->eventManager.onIntegrationUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_integration_update_data> dataPackage{ makeUnique<on_integration_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onIntegrationUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 40: {
-										if (discord_core_client::getInstance()->eventManager.onIntegrationDeletionEvent.functions.size() > 0) {
-											unique_ptr<on_integration_deletion_data> dataPackage{ makeUnique<on_integration_deletion_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onIntegrationDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 41: {
-										unique_ptr<on_interaction_creation_data> dataPackage{ makeUnique<on_interaction_creation_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onInteractionCreationEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onInteractionCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 42: {
-										if (discord_core_client::getInstance()->eventManager.onInviteCreationEvent.functions.size() > 0) {
-											unique_ptr<on_invite_creation_data> dataPackage{ makeUnique<on_invite_creation_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onInviteCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 43: {
-										if (discord_core_client::getInstance()->eventManager.onInviteDeletionEvent.functions.size() > 0) {
-											unique_ptr<on_invite_deletion_data> dataPackage{ makeUnique<on_invite_deletion_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onInviteDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 44: {
-										unique_ptr<on_message_creation_data> dataPackage{ makeUnique<on_message_creation_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onMessageCreationEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onMessageCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 45: {
-										unique_ptr<on_message_update_data> dataPackage{ makeUnique<on_message_update_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onMessageUpdateEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onMessageUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 46: {
-										if (discord_core_client::getInstance()->eventManager.onMessageDeletionEvent.functions.size() > 0) {
-											unique_ptr<on_message_deletion_data> dataPackage{ makeUnique<on_message_deletion_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onMessageDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 47: {
-										if (discord_core_client::getInstance()->eventManager.onMessageDeleteBulkEvent.functions.size() > 0) {
-											unique_ptr<on_message_delete_bulk_data> dataPackage{ makeUnique<on_message_delete_bulk_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onMessageDeleteBulkEvent(*dataPackage);
-										}
-										break;
-									}
-									case 48: {
-										if (discord_core_client::getInstance()->eventManager.onReactionAddEvent.functions.size() > 0) {
-											unique_ptr<on_reaction_add_data> dataPackage{ makeUnique<on_reaction_add_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onReactionAddEvent(*dataPackage);
-										}
-										break;
-									}
-									case 49: {
-										if (discord_core_client::getInstance()->eventManager.onReactionRemoveEvent.functions.size() > 0) {
-											unique_ptr<on_reaction_remove_data> dataPackage{ makeUnique<on_reaction_remove_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onReactionRemoveEvent(*dataPackage);
-										}
-										break;
-									}
-									case 50: {
-										if (discord_core_client::getInstance()->eventManager.onReactionRemoveAllEvent.functions.size() > 0) {
-											unique_ptr<on_reaction_remove_all_data> dataPackage{ makeUnique<on_reaction_remove_all_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onReactionRemoveAllEvent(*dataPackage);
-										}
-										break;
-									}
-									case 51: {
-										if (discord_core_client::getInstance()->eventManager.onReactionRemoveEmojiEvent.functions.size() > 0) {
-											unique_ptr<on_reaction_remove_emoji_data> dataPackage{ makeUnique<on_reaction_remove_emoji_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onReactionRemoveEmojiEvent(*dataPackage);
-										}
-										break;
-									}
-									case 52: {
-										unique_ptr<on_presence_update_data> dataPackage{ makeUnique<on_presence_update_data>(parser, dataNew) };
-										if (discord_core_client::getInstance()->eventManager.onPresenceUpdateEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onPresenceUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 53: {
-										if (discord_core_client::getInstance()->eventManager.onStageInstanceCreationEvent.functions.size() > 0) {
-											unique_ptr<on_stage_instance_creation_data> dataPackage{ makeUnique<on_stage_instance_creation_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onStageInstanceCreationEvent(*dataPackage);
-										}
-										break;
-									}
-									case 54: {
-										if (discord_core_client::getInstance()->eventManager.onStageInstanceUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_stage_instance_update_data> dataPackage{ makeUnique<on_stage_instance_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onStageInstanceUpdateEvent(*dataPackage);
-										}
-										break;
-									}
-									case 55: {
-										if (discord_core_client::getInstance()->eventManager.onStageInstanceDeletionEvent.functions.size() > 0) {
-											unique_ptr<on_stage_instance_deletion_data> dataPackage{ makeUnique<on_stage_instance_deletion_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onStageInstanceDeletionEvent(*dataPackage);
-										}
-										break;
-									}
-									case 56: {
-										if (discord_core_client::getInstance()->eventManager.onTypingStartEvent.functions.size() > 0) {
-											unique_ptr<on_typing_start_data> dataPackage{ makeUnique<on_typing_start_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onTypingStartEvent(*dataPackage);
-										}
-										break;
-									}
-									case 57: {
-										if (discord_core_client::getInstance()->eventManager.onUserUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_user_update_data> dataPackage{ makeUnique<on_user_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onUserUpdateEvent(*dataPackage);
-										}
-										break;
-									}
+									// the voice events' data packages are built here, on the shard's own thread, as they fill in the voice connection data that it owns -
+									// only their delegates are dispatched on the guild's queue.
 									case 58: {
-										unique_ptr<on_voice_state_update_data> dataPackage{ makeUnique<on_voice_state_update_data>(parser, dataNew, this) };
-										if (discord_core_client::getInstance()->eventManager.onVoiceStateUpdateEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onVoiceStateUpdateEvent(*dataPackage);
-										}
+										auto dataPackage{ std::make_shared<const on_voice_state_update_data>(parser, dataNew, this) };
+										discord_core_client::getInstance()->eventQueue.enqueue(dataPackage->value.guildId.operator const uint64_t&(),
+											[dataPackage](ordered_event_queue::completion_type onComplete) {
+												auto& event{ discord_core_client::getInstance()->eventManager.onVoiceStateUpdateEvent };
+												if (event.size() > 0) {
+													event.dispatch(std::move(onComplete), dataPackage);
+												} else {
+													onComplete();
+												}
+											});
 										break;
 									}
 									case 59: {
-										unique_ptr<on_voice_server_update_data> dataPackage{ makeUnique<on_voice_server_update_data>(parser, dataNew, this) };
-										if (discord_core_client::getInstance()->eventManager.onVoiceServerUpdateEvent.functions.size() > 0) {
-											discord_core_client::getInstance()->eventManager.onVoiceServerUpdateEvent(*dataPackage);
-										}
+										auto dataPackage{ std::make_shared<const on_voice_server_update_data>(parser, dataNew, this) };
+										discord_core_client::getInstance()->eventQueue.enqueue(dataPackage->value.guildId.operator const uint64_t&(),
+											[dataPackage](ordered_event_queue::completion_type onComplete) {
+												auto& event{ discord_core_client::getInstance()->eventManager.onVoiceServerUpdateEvent };
+												if (event.size() > 0) {
+													event.dispatch(std::move(onComplete), dataPackage);
+												} else {
+													onComplete();
+												}
+											});
 										break;
 									}
-									case 60: {
-										if (discord_core_client::getInstance()->eventManager.onWebhookUpdateEvent.functions.size() > 0) {
-											unique_ptr<on_webhook_update_data> dataPackage{ makeUnique<on_webhook_update_data>(parser, dataNew) };
-											discord_core_client::getInstance()->eventManager.onWebhookUpdateEvent(*dataPackage);
-										}
+									default: {
+										websocket_message_data<event_routing_data> routingData{};
+										parser.parseJson(routingData, dataNew);
+										// copied out of the connection's buffer, to be parsed into its data package - cache updates and all - on its guild's queue.
+										jsonifier::string_base<uint8_t> dataNewer{ dataNew };
+										discord_core_client::getInstance()->eventQueue.enqueue(routingData.d.getQueueKey(),
+											[eventType, dataNewer = std::move(dataNewer)](ordered_event_queue::completion_type onComplete) {
+												dispatchEvent(eventType, dataNewer, std::move(onComplete));
+											});
 										break;
 									}
 								}
@@ -1138,6 +769,460 @@ namespace discord_core_api {
 			return false;
 		}
 
+		void websocket_client::dispatchEvent(uint64_t eventType, jsonifier::string_view_base<uint8_t> dataNew, ordered_event_queue::completion_type onComplete) {
+			switch (eventType) {
+				case 3: {
+					if (discord_core_client::getInstance()->eventManager.onApplicationCommandPermissionsUpdateEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_application_command_permissions_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onApplicationCommandPermissionsUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 4: {
+					if (discord_core_client::getInstance()->eventManager.onAutoModerationRuleCreationEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_auto_moderation_rule_creation_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onAutoModerationRuleCreationEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 5: {
+					if (discord_core_client::getInstance()->eventManager.onAutoModerationRuleUpdateEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_auto_moderation_rule_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onAutoModerationRuleUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 6: {
+					if (discord_core_client::getInstance()->eventManager.onAutoModerationRuleDeletionEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_auto_moderation_rule_deletion_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onAutoModerationRuleDeletionEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 7: {
+					if (discord_core_client::getInstance()->eventManager.onAutoModerationActionExecutionEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_auto_moderation_action_execution_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onAutoModerationActionExecutionEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 8: {
+					auto dataPackage{ std::make_shared<const on_channel_creation_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onChannelCreationEvent.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onChannelCreationEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 9: {
+					auto dataPackage{ std::make_shared<const on_channel_update_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onChannelUpdateEvent.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onChannelUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 10: {
+					auto dataPackage{ std::make_shared<const on_channel_deletion_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onChannelDeletionEvent.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onChannelDeletionEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 11: {
+					if (discord_core_client::getInstance()->eventManager.onChannelPinsUpdateEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_channel_pins_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onChannelPinsUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 12: {
+					if (discord_core_client::getInstance()->eventManager.onThreadCreationEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_thread_creation_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onThreadCreationEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 13: {
+					if (discord_core_client::getInstance()->eventManager.onThreadUpdateEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_thread_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onThreadUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 14: {
+					if (discord_core_client::getInstance()->eventManager.onThreadDeletionEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_thread_deletion_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onThreadDeletionEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 15: {
+					if (discord_core_client::getInstance()->eventManager.onThreadListSyncEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_thread_list_sync_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onThreadListSyncEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 16: {
+					if (discord_core_client::getInstance()->eventManager.onThreadMemberUpdateEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_thread_member_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onThreadMemberUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 17: {
+					if (discord_core_client::getInstance()->eventManager.onThreadMembersUpdateEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_thread_members_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onThreadMembersUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 18: {
+					auto dataPackage{ std::make_shared<const on_guild_creation_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onGuildCreationEvent.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onGuildCreationEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 19: {
+					auto dataPackage{ std::make_shared<const on_guild_update_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onGuildUpdateEvent.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onGuildUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 20: {
+					auto dataPackage{ std::make_shared<const on_guild_deletion_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onGuildDeletionEvent.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onGuildDeletionEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 21: {
+					if (discord_core_client::getInstance()->eventManager.onGuildBanAddEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_guild_ban_add_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildBanAddEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 22: {
+					if (discord_core_client::getInstance()->eventManager.onGuildBanRemoveEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_guild_ban_remove_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildBanRemoveEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 23: {
+					if (discord_core_client::getInstance()->eventManager.onGuildEmojisUpdateEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_guild_emojis_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildEmojisUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 24: {
+					if (discord_core_client::getInstance()->eventManager.onGuildStickersUpdateEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_guild_stickers_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildStickersUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 25: {
+					if (discord_core_client::getInstance()->eventManager.onGuildIntegrationsUpdateEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_guild_integrations_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildIntegrationsUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 26: {
+					auto dataPackage{ std::make_shared<const on_guild_member_add_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onGuildMemberAddEvent.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onGuildMemberAddEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 27: {
+					auto dataPackage{ std::make_shared<const on_guild_member_remove_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onGuildMemberRemoveEvent.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onGuildMemberRemoveEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 28: {
+					auto dataPackage{ std::make_shared<const on_guild_member_update_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onGuildMemberUpdateEvent.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onGuildMemberUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 29: {
+					if (discord_core_client::getInstance()->eventManager.onGuildMembersChunkEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_guild_members_chunk_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildMembersChunkEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 30: {
+					auto dataPackage{ std::make_shared<const on_role_creation_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onRoleCreationEvent.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onRoleCreationEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 31: {
+					auto dataPackage{ std::make_shared<const on_role_update_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onRoleUpdateEvent.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onRoleUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 32: {
+					auto dataPackage{ std::make_shared<const on_role_deletion_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onRoleDeletionEvent.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onRoleDeletionEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 33: {
+					if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventCreationEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_guild_scheduled_event_creation_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildScheduledEventCreationEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 34: {
+					if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventUpdateEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_guild_scheduled_event_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildScheduledEventUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 35: {
+					if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventDeletionEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_guild_scheduled_event_deletion_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildScheduledEventDeletionEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 36: {
+					if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserAddEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_guild_scheduled_event_user_add_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserAddEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 37: {
+					if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserRemoveEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_guild_scheduled_event_user_remove_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserRemoveEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 38: {
+					if (discord_core_client::getInstance()->eventManager.onIntegrationCreationEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_integration_creation_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onIntegrationCreationEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 39: {
+					if (discord_core_client::getInstance()->eventManager.onIntegrationUpdateEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_integration_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onIntegrationUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 40: {
+					if (discord_core_client::getInstance()->eventManager.onIntegrationDeletionEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_integration_deletion_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onIntegrationDeletionEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 41: {
+					auto dataPackage{ std::make_shared<const on_interaction_creation_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onInteractionCreationEvent.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onInteractionCreationEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 42: {
+					if (discord_core_client::getInstance()->eventManager.onInviteCreationEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_invite_creation_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onInviteCreationEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 43: {
+					if (discord_core_client::getInstance()->eventManager.onInviteDeletionEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_invite_deletion_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onInviteDeletionEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 44: {
+					auto dataPackage{ std::make_shared<const on_message_creation_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onMessageCreationEvent.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onMessageCreationEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 45: {
+					auto dataPackage{ std::make_shared<const on_message_update_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onMessageUpdateEvent.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onMessageUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 46: {
+					if (discord_core_client::getInstance()->eventManager.onMessageDeletionEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_message_deletion_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onMessageDeletionEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 47: {
+					if (discord_core_client::getInstance()->eventManager.onMessageDeleteBulkEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_message_delete_bulk_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onMessageDeleteBulkEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 48: {
+					if (discord_core_client::getInstance()->eventManager.onReactionAddEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_reaction_add_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onReactionAddEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 49: {
+					if (discord_core_client::getInstance()->eventManager.onReactionRemoveEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_reaction_remove_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onReactionRemoveEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 50: {
+					if (discord_core_client::getInstance()->eventManager.onReactionRemoveAllEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_reaction_remove_all_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onReactionRemoveAllEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 51: {
+					if (discord_core_client::getInstance()->eventManager.onReactionRemoveEmojiEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_reaction_remove_emoji_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onReactionRemoveEmojiEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 52: {
+					auto dataPackage{ std::make_shared<const on_presence_update_data>(parser, dataNew) };
+					if (discord_core_client::getInstance()->eventManager.onPresenceUpdateEvent.size() > 0) {
+						discord_core_client::getInstance()->eventManager.onPresenceUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 53: {
+					if (discord_core_client::getInstance()->eventManager.onStageInstanceCreationEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_stage_instance_creation_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onStageInstanceCreationEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 54: {
+					if (discord_core_client::getInstance()->eventManager.onStageInstanceUpdateEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_stage_instance_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onStageInstanceUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 55: {
+					if (discord_core_client::getInstance()->eventManager.onStageInstanceDeletionEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_stage_instance_deletion_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onStageInstanceDeletionEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 56: {
+					if (discord_core_client::getInstance()->eventManager.onTypingStartEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_typing_start_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onTypingStartEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 57: {
+					if (discord_core_client::getInstance()->eventManager.onUserUpdateEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_user_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onUserUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+				case 60: {
+					if (discord_core_client::getInstance()->eventManager.onWebhookUpdateEvent.size() > 0) {
+						auto dataPackage{ std::make_shared<const on_webhook_update_data>(parser, dataNew) };
+						discord_core_client::getInstance()->eventManager.onWebhookUpdateEvent.dispatch(std::move(onComplete), std::move(dataPackage));
+						return;
+					}
+					break;
+				}
+			}
+			onComplete();
+		}
+
 		void websocket_core::disconnect() {
 			if (areWeConnected()) {
 				jsonifier::string dataNew{ "\x03\xE8" };
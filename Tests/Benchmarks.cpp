@@ -0,0 +1,827 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// Benchmarks.cpp - Standalone timings for the containers and hot paths that the caches and the event pipeline depend on, which don't need a bot token or a
+/// connection - run by hand, rather than by ctest, as their results are numbers to compare rather than pass/fail.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file Benchmarks.cpp
+
+#include <discordcoreapi/Index.hpp>
+#include <discordcoreapi/Utilities/ZlibDecoder.hpp>
+#include <unordered_map>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <chrono>
+#include <atomic>
+#include <thread>
+#include <cstdlib>
+#include <cstdio>
+#include <new>
+
+#if defined(__linux__)
+	#include <openssl/x509.h>
+	#include <sys/resource.h>
+#endif
+
+namespace dca = discord_core_api;
+
+/// @brief Keeps the optimizer from discarding a benchmark's results.
+static volatile uint64_t benchmarkSink{};
+
+/// @brief The bytes currently allocated through the global operator new, which is replaced below so that the memory benchmarks can read real footprints.
+static std::atomic_int64_t liveHeapBytes{};
+
+/// @brief The number of allocations made through the global operator new, so far.
+static std::atomic_uint64_t heapAllocationCount{};
+
+// each allocation carries its size in a header, as the unsized operator delete doesn't get told it - over-aligned allocations aren't counted.
+static constexpr uint64_t heapHeaderSize{ alignof(std::max_align_t) };
+
+void* operator new(std::size_t size) {
+	void* allocation{ std::malloc(size + heapHeaderSize) };
+	if (!allocation) {
+		throw std::bad_alloc{};
+	}
+	*static_cast<std::size_t*>(allocation) = size;
+	liveHeapBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+	heapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+	return static_cast<char*>(allocation) + heapHeaderSize;
+}
+
+void operator delete(void* allocation) noexcept {
+	if (allocation) {
+		void* header{ static_cast<char*>(allocation) - heapHeaderSize };
+		liveHeapBytes.fetch_sub(static_cast<int64_t>(*static_cast<std::size_t*>(header)), std::memory_order_relaxed);
+		std::free(header);
+	}
+}
+
+void operator delete(void* allocation, std::size_t) noexcept {
+	operator delete(allocation);
+}
+
+/// @brief Times a benchmark over several passes, after an untimed one that warms the caches and the allocator, and prints its fastest pass.
+/// @param name the benchmark's name.
+/// @param operationCount the number of operations that one pass performs.
+/// @param function the pass itself - it is run in full each time.
+template<typename function_type> static void runBenchmark(std::string_view name, uint64_t operationCount, function_type&& function) {
+	static constexpr uint64_t passCount{ 5 };
+	function();
+	double bestNanoseconds{ std::numeric_limits<double>::max() };
+	for (uint64_t x = 0; x < passCount; ++x) {
+		auto startTime = std::chrono::steady_clock::now();
+		function();
+		bestNanoseconds = std::min(bestNanoseconds, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count());
+	}
+	std::cout << std::left << std::setw(72) << name << std::right << std::setw(12) << std::fixed << std::setprecision(2)
+			  << bestNanoseconds / static_cast<double>(operationCount) << " ns/op" << std::endl;
+}
+
+/// @brief Collects a set of distinct, snowflake-like keys, in random order.
+static std::vector<uint64_t> makeKeys(uint64_t count, uint64_t seed) {
+	std::mt19937_64 generator{ seed };
+	std::vector<uint64_t> keys{};
+	keys.reserve(count);
+	dca::unordered_set<uint64_t> seen{};
+	while (keys.size() < count) {
+		// real snowflakes only vary in their low ~42 bits, with the timestamp in the high ones.
+		uint64_t key{ (uint64_t{ 1000000000000000000ull } + generator() % (uint64_t{ 1 } << 42)) };
+		if (!seen.contains(key)) {
+			seen.emplace(key);
+			keys.emplace_back(key);
+		}
+	}
+	return keys;
+}
+
+/// @brief Inserts, finds, misses, iterates and erases over one map type.
+/// @tparam map_type the map, keyed by key_type.
+/// @tparam key_type the key - int64_t selects dca::unordered_map's old, linearly probed table, and uint64_t its swiss_table.
+template<typename map_type, typename key_type> static void benchmarkHashMap(std::string_view name, const std::vector<uint64_t>& keys, const std::vector<uint64_t>& misses) {
+	std::string prefix{ name };
+	runBenchmark(prefix + ": insert", keys.size(), [&] {
+		map_type map{};
+		for (auto& value: keys) {
+			map.emplace(static_cast<key_type>(value), value);
+		}
+		benchmarkSink = benchmarkSink + map.size();
+	});
+	map_type map{};
+	for (auto& value: keys) {
+		map.emplace(static_cast<key_type>(value), value);
+	}
+	runBenchmark(prefix + ": successful find", keys.size(), [&] {
+		uint64_t sum{};
+		for (auto& value: keys) {
+			sum += map.find(static_cast<key_type>(value))->second;
+		}
+		benchmarkSink = benchmarkSink + sum;
+	});
+	runBenchmark(prefix + ": failed find", misses.size(), [&] {
+		uint64_t found{};
+		for (auto& value: misses) {
+			found += map.find(static_cast<key_type>(value)) != map.end();
+		}
+		benchmarkSink = benchmarkSink + found;
+	});
+	runBenchmark(prefix + ": iterate", keys.size(), [&] {
+		uint64_t sum{};
+		for (auto& [key, value]: std::as_const(map)) {
+			sum += value;
+		}
+		benchmarkSink = benchmarkSink + sum;
+	});
+	runBenchmark(prefix + ": erase then reinsert half", keys.size(), [&] {
+		for (uint64_t x = 0; x < keys.size(); x += 2) {
+			map.erase(static_cast<key_type>(keys[x]));
+		}
+		for (uint64_t x = 0; x < keys.size(); x += 2) {
+			map.emplace(static_cast<key_type>(keys[x]), keys[x]);
+		}
+	});
+}
+
+static void benchmarkSwissTable() {
+	for (uint64_t count: { uint64_t{ 1000 }, uint64_t{ 100000 } }) {
+		auto keys	= makeKeys(count, 1);
+		auto misses = makeKeys(count, 2);
+		std::string suffix{ " (" + std::to_string(count) + " keys)" };
+		benchmarkHashMap<dca::unordered_map<uint64_t, uint64_t>, uint64_t>("swiss_table" + suffix, keys, misses);
+		benchmarkHashMap<dca::unordered_map<int64_t, uint64_t>, int64_t>("old unordered_map table" + suffix, keys, misses);
+		benchmarkHashMap<std::unordered_map<uint64_t, uint64_t>, uint64_t>("std::unordered_map" + suffix, keys, misses);
+	}
+}
+
+/// @brief Collects a response body shaped like the api's larger ones - a page of guild members.
+static std::string makeResponseBody(uint64_t memberCount) {
+	auto keys = makeKeys(memberCount * 2, 3);
+	std::string body{ "[" };
+	for (uint64_t x = 0; x < memberCount; ++x) {
+		body += std::string{ x > 0 ? "," : "" } + "{\"user\":{\"id\":\"" + std::to_string(keys[x]) + "\",\"username\":\"member" + std::to_string(x) +
+			"\",\"global_name\":null,\"avatar\":null,\"discriminator\":\"0\",\"public_flags\":0},\"roles\":[\"" + std::to_string(keys[memberCount + x]) +
+			"\"],\"nick\":null,\"avatar\":null,\"joined_at\":\"2023-06-14T17:24:39.512000+00:00\",\"premium_since\":null,\"deaf\":false,\"mute\":false,"
+			"\"flags\":0,\"pending\":false}";
+	}
+	return body + "]";
+}
+
+/// @brief Gzips a body, as a server would before sending it.
+static std::string gzipBody(const std::string& body) {
+	z_stream stream{};
+	deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+	std::string returnValue(deflateBound(&stream, static_cast<uLong>(body.size())), '\0');
+	stream.next_in	 = reinterpret_cast<Bytef*>(const_cast<char*>(body.data()));
+	stream.avail_in	 = static_cast<uInt>(body.size());
+	stream.next_out	 = reinterpret_cast<Bytef*>(returnValue.data());
+	stream.avail_out = static_cast<uInt>(returnValue.size());
+	deflate(&stream, Z_FINISH);
+	returnValue.resize(stream.total_out);
+	deflateEnd(&stream);
+	return returnValue;
+}
+
+/// @brief Reads a body the way https_rnr_builder::appendBody() does, in the pieces that the socket hands over - appended as-is, or inflated on the way in.
+static void benchmarkResponseDecoding() {
+	static constexpr uint64_t bodyCount{ 100 };
+	static constexpr uint64_t readSize{ 16384 };
+	auto body	 = makeResponseBody(1000);
+	auto encoded = gzipBody(body);
+	std::cout << "response body: " << body.size() << " bytes, " << encoded.size() << " bytes gzipped" << std::endl;
+	runBenchmark("response body: identity, per body", bodyCount, [&] {
+		uint64_t sum{};
+		for (uint64_t x = 0; x < bodyCount; ++x) {
+			jsonifier::string responseData{};
+			for (uint64_t y = 0; y < body.size(); y += readSize) {
+				responseData += jsonifier::string_view{ body.data() + y, std::min(readSize, body.size() - y) };
+			}
+			sum += responseData.size();
+		}
+		benchmarkSink = benchmarkSink + sum;
+	});
+	dca::discord_core_internal::zlib_decoder_wrapper decoder{};
+	runBenchmark("response body: gzip, per body", bodyCount, [&] {
+		uint64_t sum{};
+		for (uint64_t x = 0; x < bodyCount; ++x) {
+			jsonifier::string responseData{};
+			decoder.begin(dca::discord_core_internal::content_encoding::gzip);
+			for (uint64_t y = 0; y < encoded.size(); y += readSize) {
+				decoder.decodeData(jsonifier::string_view{ encoded.data() + y, std::min(readSize, encoded.size() - y) }, responseData);
+			}
+			sum += responseData.size();
+		}
+		benchmarkSink = benchmarkSink + sum;
+	});
+}
+
+/// @brief A synthetic guild, shaped like a large community one - fifty roles, a channel that overwrites about a quarter of them, and members with a few roles each.
+struct permission_benchmark_guild {
+	jsonifier::vector<dca::guild_member_data> sampleMembers{};///< The first of the members, as full guild_member_data, for the copying path.
+	std::vector<uint64_t> userIds{};
+	dca::channel_data channel{};
+	dca::guild_data guild{};
+};
+
+/// @brief Builds a synthetic guild and hands it, and its members, to the permission_engine.
+static permission_benchmark_guild makePermissionGuild(uint64_t memberCount, uint64_t sampleCount) {
+	static constexpr uint64_t roleCount{ 50 };
+	std::mt19937_64 generator{ 4 };
+	auto roleIds = makeKeys(roleCount + 2, 5);
+	permission_benchmark_guild returnValue{};
+	returnValue.userIds	 = makeKeys(memberCount, 6);
+	returnValue.guild.id = roleIds[roleCount];
+	// the owner is left out of the members, so that every member's permissions are actually computed.
+	returnValue.guild.ownerId = roleIds[roleCount] + 1;
+	returnValue.channel.id	  = roleIds[roleCount + 1];
+	static constexpr uint64_t nonAdministrator{ dca::permission_engine::allPermissions & ~static_cast<uint64_t>(dca::permission::administrator) };
+	for (uint64_t x = 0; x <= roleCount; ++x) {
+		dca::role_data role{};
+		role.id			 = roleIds[x];
+		role.permissions = generator() & generator() & nonAdministrator;
+		returnValue.guild.roles.emplace_back(std::move(role));
+	}
+	dca::over_write_data overwrite{};
+	overwrite.type	= dca::permission_overwrites_type::role_data;
+	overwrite.id	= returnValue.guild.id;
+	overwrite.deny	= generator() & generator() & nonAdministrator;
+	overwrite.allow = uint64_t{ 0 };
+	returnValue.channel.permissionOverwrites.emplace_back(overwrite);
+	for (uint64_t x = 0; x < roleCount; x += 4) {
+		overwrite.id	= roleIds[x];
+		overwrite.allow = generator() & generator() & nonAdministrator;
+		overwrite.deny	= generator() & generator() & nonAdministrator;
+		returnValue.channel.permissionOverwrites.emplace_back(overwrite);
+	}
+	overwrite.type = dca::permission_overwrites_type::user_data;
+	for (uint64_t x = 0; x < 2; ++x) {
+		overwrite.id	= returnValue.userIds[x * memberCount / 2];
+		overwrite.allow = generator() & generator() & nonAdministrator;
+		overwrite.deny	= generator() & generator() & nonAdministrator;
+		returnValue.channel.permissionOverwrites.emplace_back(overwrite);
+	}
+	returnValue.guild.channels.emplace_back(returnValue.channel);
+	dca::permission_engine::insertGuild(returnValue.guild);
+	dca::guild_member_data guildMember{};
+	guildMember.guildId = returnValue.guild.id;
+	for (uint64_t x = 0; x < memberCount; ++x) {
+		guildMember.user.id = returnValue.userIds[x];
+		guildMember.roles.clear();
+		for (uint64_t y = generator() % 5; y > 0; --y) {
+			guildMember.roles.emplace_back(roleIds[generator() % roleCount]);
+		}
+		dca::permission_engine::insertGuildMember(returnValue.guild.id, guildMember);
+		if (x < sampleCount) {
+			returnValue.sampleMembers.emplace_back(guildMember);
+		}
+	}
+	return returnValue;
+}
+
+/// @brief Computes a guild_member's permissions in a channel the way permissions_base::computeBasePermissions() and computeOverwrites() used to - copying the
+/// guild's roles, and then the member's, and passing the result between the two as a decimal string. the guild copy, the cache locks and the per-role cache
+/// lookups that they also paid for are left out, so this is a lower bound on their cost.
+static uint64_t computeByCopying(const dca::guild_data& guild, const dca::guild_member_data& guildMember, const dca::channel_data& channel) {
+	if (guild.ownerId == guildMember.user.id) {
+		return dca::permission_engine::allPermissions;
+	}
+	jsonifier::vector<dca::role_data> guildRoles{};
+	for (auto& value: guild.roles) {
+		guildRoles.emplace_back(value);
+	}
+	dca::role_data roleEveryone{};
+	for (auto& value: guildRoles) {
+		if (value.id == guild.id) {
+			roleEveryone = value;
+		}
+	}
+	uint64_t permissions{ roleEveryone.permissions.operator uint64_t() };
+	jsonifier::vector<dca::role_data> guildMemberRoles{};
+	for (auto& value: guildMember.roles) {
+		for (auto& valueNew: guildRoles) {
+			if (valueNew.id == value) {
+				guildMemberRoles.emplace_back(valueNew);
+			}
+		}
+	}
+	for (auto& value: guildMemberRoles) {
+		permissions |= value.permissions.operator uint64_t();
+	}
+	if (permissions & static_cast<uint64_t>(dca::permission::administrator)) {
+		return dca::permission_engine::allPermissions;
+	}
+	jsonifier::string basePermissions{ jsonifier::toString(permissions) };
+
+	permissions = jsonifier::strToUint64(basePermissions.data());
+	for (auto& value: channel.permissionOverwrites) {
+		if (value.id == guildMember.guildId) {
+			permissions &= ~value.deny.operator uint64_t();
+			permissions |= value.allow.operator uint64_t();
+			break;
+		}
+	}
+	guildMemberRoles.clear();
+	for (auto& value: guildMember.roles) {
+		for (auto& valueNew: guild.roles) {
+			if (valueNew.id == value) {
+				guildMemberRoles.emplace_back(valueNew);
+			}
+		}
+	}
+	uint64_t allow{};
+	uint64_t deny{};
+	for (auto& value: guildMemberRoles) {
+		for (auto& valueNew: channel.permissionOverwrites) {
+			if (value.id == valueNew.id) {
+				allow |= valueNew.allow.operator uint64_t();
+				deny |= valueNew.deny.operator uint64_t();
+			}
+		}
+	}
+	permissions &= ~deny;
+	permissions |= allow;
+	for (auto& value: channel.permissionOverwrites) {
+		if (value.id == guildMember.user.id) {
+			permissions &= ~value.deny.operator uint64_t();
+			permissions |= value.allow.operator uint64_t();
+			break;
+		}
+	}
+	return jsonifier::strToUint64(jsonifier::toString(permissions).data());
+}
+
+/// @brief Computes a channel's permissions for every member of a synthetic guild - one member at a time and all at once through the permission_engine, and one
+/// member at a time by copying, on a sample of them.
+static void benchmarkPermissions() {
+	static constexpr uint64_t sampleCount{ 10000 };
+	dca::config_manager configManager{ dca::discord_core_client_config{} };
+	dca::permission_engine::initialize(&configManager);
+	for (uint64_t memberCount: { uint64_t{ 10000 }, uint64_t{ 500000 } }) {
+		auto guild = makePermissionGuild(memberCount, sampleCount);
+		std::string suffix{ " (" + std::to_string(memberCount) + " members)" };
+		uint64_t mismatches{};
+		auto batch = dca::permission_engine::computeBatch(guild.guild.id, guild.channel.id);
+		for (uint64_t x = 0; x < batch->userIds.size(); ++x) {
+			mismatches += dca::permission_engine::compute(guild.guild.id, batch->userIds[x], guild.channel.id) != batch->permissions[x];
+		}
+		for (auto& value: guild.sampleMembers) {
+			mismatches += computeByCopying(guild.guild, value, guild.channel) != dca::permission_engine::compute(guild.guild.id, value.user.id, guild.channel.id);
+		}
+		if (mismatches > 0) {
+			std::cout << "permissions" << suffix << ": " << mismatches << " results disagree" << std::endl;
+		}
+		runBenchmark("permissions: copying, as permissions_base did" + suffix, guild.sampleMembers.size(), [&] {
+			uint64_t sum{};
+			for (auto& value: guild.sampleMembers) {
+				sum += computeByCopying(guild.guild, value, guild.channel);
+			}
+			benchmarkSink = benchmarkSink + sum;
+		});
+		runBenchmark("permissions: permission_engine::compute()" + suffix, memberCount, [&] {
+			uint64_t sum{};
+			for (auto& value: guild.userIds) {
+				sum += dca::permission_engine::compute(guild.guild.id, value, guild.channel.id).value_or(0);
+			}
+			benchmarkSink = benchmarkSink + sum;
+		});
+		runBenchmark("permissions: permission_engine::computeBatch()" + suffix, memberCount, [&] {
+			benchmarkSink = benchmarkSink + dca::permission_engine::computeBatch(guild.guild.id, guild.channel.id)->permissions.size();
+		});
+		jsonifier::vector<dca::snowflake> subset{};
+		for (uint64_t x = 0; x < sampleCount; ++x) {
+			subset.emplace_back(guild.userIds[x]);
+		}
+		runBenchmark("permissions: computeBatch() of " + std::to_string(sampleCount) + suffix, sampleCount, [&] {
+			benchmarkSink = benchmarkSink + dca::permission_engine::computeBatch(guild.guild.id, guild.channel.id, subset)->permissions.size();
+		});
+		dca::permission_engine::removeGuild(guild.guild.id);
+	}
+}
+
+/// @brief Collects the members of a synthetic guild - most with one to three roles, a tenth with a nick, a few with more roles or a guild avatar.
+static std::vector<dca::guild_member_cache_data> makeGuildMembers(uint64_t guildId, uint64_t memberCount) {
+	std::mt19937_64 generator{ 7 };
+	auto roleIds = makeKeys(50, 8);
+	auto userIds = makeKeys(memberCount, 9);
+	std::vector<dca::guild_member_cache_data> returnValue(memberCount);
+	for (uint64_t x = 0; x < memberCount; ++x) {
+		auto& member		  = returnValue[x];
+		member.user.id		  = userIds[x];
+		member.guildId		  = guildId;
+		member.permissionsVal = generator() & dca::permission_engine::allPermissions;
+		member.joinedAt		  = dca::time_stamp{ (uint64_t{ 1600000000 } + generator() % 100000000) * 1000 };
+		for (uint64_t y = x % 20 == 0 ? 5 : 1 + generator() % 3; y > 0; --y) {
+			member.roles.emplace_back(roleIds[generator() % roleIds.size()]);
+		}
+		if (x % 10 == 0) {
+			member.nick = "member nickname " + std::to_string(x);
+		}
+		if (x % 100 == 0) {
+			member.avatar = "a_1269e74af4df7417b13759eae50c83dc";
+		}
+	}
+	return returnValue;
+}
+
+/// @brief Stores one large guild's members in an object_cache<guild_member_cache_data>, as guild_members does by default, and in the guild_member_store that it
+/// switches to with compactGuildMembers - comparing their heap footprints, and the time taken to fill them and to find each member in them.
+static void benchmarkGuildMemberStorage() {
+	static constexpr uint64_t memberCount{ 100000 };
+	static constexpr uint64_t guildId{ 1000000000000000001ull };
+	auto members = makeGuildMembers(guildId, memberCount);
+	{
+		int64_t startBytes{ liveHeapBytes.load() };
+		auto cache = dca::makeUnique<dca::object_cache<dca::guild_member_cache_data>>();
+		for (auto& value: members) {
+			cache->emplace(dca::guild_member_cache_data{ value });
+		}
+		std::cout << "guild members: object_cache<guild_member_cache_data>, heap bytes per member: " << (liveHeapBytes.load() - startBytes) / memberCount << std::endl;
+	}
+	{
+		int64_t startBytes{ liveHeapBytes.load() };
+		auto store = dca::makeUnique<dca::guild_member_store<>>();
+		for (auto& value: members) {
+			store->emplace(value);
+		}
+		std::cout << "guild members: guild_member_store, heap bytes per member: " << (liveHeapBytes.load() - startBytes) / memberCount
+				  << " (getMemoryUsage(): " << store->getMemoryUsage() / memberCount << ")" << std::endl;
+	}
+	runBenchmark("guild members: object_cache<guild_member_cache_data>, emplace", memberCount, [&] {
+		auto cache = dca::makeUnique<dca::object_cache<dca::guild_member_cache_data>>();
+		for (auto& value: members) {
+			cache->emplace(dca::guild_member_cache_data{ value });
+		}
+		benchmarkSink = benchmarkSink + cache->count();
+	});
+	runBenchmark("guild members: guild_member_store, emplace", memberCount, [&] {
+		auto store = dca::makeUnique<dca::guild_member_store<>>();
+		for (auto& value: members) {
+			store->emplace(value);
+		}
+		benchmarkSink = benchmarkSink + store->count();
+	});
+	auto cache = dca::makeUnique<dca::object_cache<dca::guild_member_cache_data>>();
+	auto store = dca::makeUnique<dca::guild_member_store<>>();
+	for (auto& value: members) {
+		cache->emplace(dca::guild_member_cache_data{ value });
+		store->emplace(value);
+	}
+	runBenchmark("guild members: object_cache<guild_member_cache_data>, find", memberCount, [&] {
+		uint64_t sum{};
+		for (auto& value: members) {
+			sum += cache->find(dca::two_id_key{ value })->roles.size();
+		}
+		benchmarkSink = benchmarkSink + sum;
+	});
+	runBenchmark("guild members: guild_member_store, find", memberCount, [&] {
+		uint64_t sum{};
+		for (auto& value: members) {
+			sum += store->find(value.guildId, value.user.id)->roles.size();
+		}
+		benchmarkSink = benchmarkSink + sum;
+	});
+}
+
+/// @brief A minimal cached object, keyed by its id like the cached entities are.
+struct benchmark_cached_object {
+	dca::snowflake id{};
+	uint64_t value{};
+};
+
+/// @brief Has a number of threads hit one object_cache at once - each finds a key nine times for every one that it emplaces, as the event handlers and the
+/// entity getters do between them.
+/// @tparam shardCount the cache's shard count - 1 puts every key behind a single lock, as object_cache was before it was sharded.
+template<uint64_t shardCount> static void benchmarkCacheContention(std::string_view name, const std::vector<uint64_t>& keys, uint64_t threadCount) {
+	static constexpr uint64_t operationsPerThread{ 100000 };
+	dca::object_cache<benchmark_cached_object, shardCount> cache{};
+	for (auto& value: keys) {
+		cache.emplace(benchmark_cached_object{ value, value });
+	}
+	runBenchmark(std::string{ name } + " (" + std::to_string(threadCount) + " threads)", operationsPerThread * threadCount, [&] {
+		std::vector<std::jthread> threads{};
+		for (uint64_t x = 0; x < threadCount; ++x) {
+			threads.emplace_back([&, x] {
+				uint64_t sum{};
+				for (uint64_t y = 0; y < operationsPerThread; ++y) {
+					auto& key = keys[(x * operationsPerThread + y * 7919) % keys.size()];
+					if (y % 10 == 0) {
+						cache.emplace(benchmark_cached_object{ key, y });
+					} else if (auto object = cache.find(dca::snowflake{ key })) {
+						sum += object->value;
+					}
+				}
+				benchmarkSink = benchmarkSink + sum;
+			});
+		}
+	});
+}
+
+static void benchmarkCacheLocking() {
+	auto keys = makeKeys(100000, 10);
+	std::cout << "object_cache contention, on " << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+	for (uint64_t threadCount: { uint64_t{ 1 }, uint64_t{ 4 }, uint64_t{ 32 } }) {
+		benchmarkCacheContention<1>("object_cache, one lock, 90% find", keys, threadCount);
+		benchmarkCacheContention<32>("object_cache, 32 shards, 90% find", keys, threadCount);
+	}
+}
+
+/// @brief A stand-in for a large guild_cache_data - its lists of role, channel and emoji ids are what make a copy of it expensive.
+struct benchmark_cached_guild {
+	jsonifier::vector<dca::snowflake> channels{};
+	jsonifier::vector<dca::snowflake> roles{};
+	jsonifier::vector<dca::snowflake> emoji{};
+	jsonifier::string name{};
+	dca::snowflake id{};
+};
+
+/// @brief Reads objects out of an object_cache - as copies through find(), and in place through epoch-protected view()s - first large guilds' worth, and then
+/// members of a large guild.
+static void benchmarkCacheViews() {
+	static constexpr uint64_t guildCount{ 1000 };
+	auto guildIds = makeKeys(guildCount, 11);
+	dca::object_cache<benchmark_cached_guild> guildCache{};
+	for (auto& value: guildIds) {
+		benchmark_cached_guild guild{};
+		guild.id   = value;
+		guild.name = "a large guild with a longer name";
+		guild.channels.resize(500, dca::snowflake{ value });
+		guild.roles.resize(250, dca::snowflake{ value });
+		guild.emoji.resize(100, dca::snowflake{ value });
+		guildCache.emplace(std::move(guild));
+	}
+	runBenchmark("object_cache, large guild, find() copy", guildCount, [&] {
+		uint64_t sum{};
+		for (auto& value: guildIds) {
+			sum += guildCache.find(dca::snowflake{ value })->roles.size();
+		}
+		benchmarkSink = benchmarkSink + sum;
+	});
+	runBenchmark("object_cache, large guild, view()", guildCount, [&] {
+		uint64_t sum{};
+		for (auto& value: guildIds) {
+			sum += guildCache.view(dca::snowflake{ value })->roles.size();
+		}
+		benchmarkSink = benchmarkSink + sum;
+	});
+
+	static constexpr uint64_t memberCount{ 100000 };
+	auto members = makeGuildMembers(1000000000000000001ull, memberCount);
+	auto cache	 = dca::makeUnique<dca::object_cache<dca::guild_member_cache_data>>();
+	for (auto& value: members) {
+		cache->emplace(dca::guild_member_cache_data{ value });
+	}
+	runBenchmark("object_cache, guild_member_cache_data, find() copy", memberCount, [&] {
+		uint64_t sum{};
+		for (auto& value: members) {
+			sum += cache->find(dca::two_id_key{ value })->roles.size();
+		}
+		benchmarkSink = benchmarkSink + sum;
+	});
+	runBenchmark("object_cache, guild_member_cache_data, view()", memberCount, [&] {
+		uint64_t sum{};
+		for (auto& value: members) {
+			sum += cache->view(dca::two_id_key{ value })->roles.size();
+		}
+		benchmarkSink = benchmarkSink + sum;
+	});
+}
+
+/// @brief An embed, as carried by a message.
+struct benchmark_embed {
+	jsonifier::string description{};
+	jsonifier::string title{};
+	jsonifier::string url{};
+};
+
+/// @brief A stand-in for a message creation event's data - a few strings and lists, each of which is its own allocation.
+struct benchmark_event_payload {
+	jsonifier::vector<dca::snowflake> mentionRoles{};
+	jsonifier::vector<benchmark_embed> embeds{};
+	jsonifier::vector<dca::snowflake> mentions{};
+	jsonifier::string authorName{};
+	jsonifier::string content{};
+	jsonifier::string nonce{};
+	dca::snowflake channelId{};
+	dca::snowflake guildId{};
+	dca::snowflake id{};
+};
+
+/// @brief Hands events to eight handlers in the two ways that event::dispatch() has - the old one, which copied the parsed data into the dispatch's snapshot and
+/// then again into each by-value handler, and the current one, which shares a single immutable copy with handlers that take it by const reference. the handlers
+/// are called inline, leaving out the thread pool, so that only the payloads' allocations and copies are measured.
+static void benchmarkEventPayloads() {
+	static constexpr uint64_t handlerCount{ 8 };
+	static constexpr uint64_t eventCount{ 10000 };
+	benchmark_event_payload frame{};
+	frame.content	 = jsonifier::string(200, 'x');
+	frame.authorName = "a message author";
+	frame.nonce		 = "1187654321098765432";
+	frame.mentions.resize(3, dca::snowflake{ 1000000000000000001ull });
+	frame.mentionRoles.resize(2, dca::snowflake{ 1000000000000000002ull });
+	frame.embeds.resize(2, benchmark_embed{ jsonifier::string(300, 'y'), "an embed's title", "https://discordcoreapi.com/an/embed/url" });
+	std::vector<std::function<void(benchmark_event_payload)>> copyingHandlers{};
+	std::vector<std::function<void(const benchmark_event_payload&)>> sharingHandlers{};
+	for (uint64_t x = 0; x < handlerCount; ++x) {
+		copyingHandlers.emplace_back([](benchmark_event_payload value) {
+			benchmarkSink = benchmarkSink + value.content.size();
+		});
+		sharingHandlers.emplace_back([](const benchmark_event_payload& value) {
+			benchmarkSink = benchmarkSink + value.content.size();
+		});
+	}
+	// the parse that produces each event is stood in for by a copy of the same frame.
+	auto dispatchByCopying = [&] {
+		auto parsed	  = dca::makeUnique<benchmark_event_payload>(frame);
+		auto snapshot = std::make_shared<benchmark_event_payload>(*parsed);
+		for (auto& value: copyingHandlers) {
+			value(*snapshot);
+		}
+	};
+	auto dispatchBySharing = [&] {
+		auto parsed = std::make_shared<const benchmark_event_payload>(frame);
+		for (auto& value: sharingHandlers) {
+			value(*parsed);
+		}
+	};
+	uint64_t startCount{ heapAllocationCount.load() };
+	dispatchByCopying();
+	std::cout << "event payloads, " << handlerCount << " handlers: allocations per event, copied: " << heapAllocationCount.load() - startCount;
+	startCount = heapAllocationCount.load();
+	dispatchBySharing();
+	std::cout << ", shared: " << heapAllocationCount.load() - startCount << std::endl;
+	runBenchmark("event payloads, " + std::to_string(handlerCount) + " handlers, copied per handler", eventCount, [&] {
+		for (uint64_t x = 0; x < eventCount; ++x) {
+			dispatchByCopying();
+		}
+	});
+	runBenchmark("event payloads, " + std::to_string(handlerCount) + " handlers, shared and immutable", eventCount, [&] {
+		for (uint64_t x = 0; x < eventCount; ++x) {
+			dispatchBySharing();
+		}
+	});
+}
+
+#if defined(__linux__) && defined(SSL_OP_ENABLE_KTLS)
+
+/// @brief Collects the cpu time that the calling thread has used so far - in user space, and in the kernel, where kernel tls does its encryption.
+static double getThreadCpuSeconds() {
+	rusage usage{};
+	getrusage(RUSAGE_THREAD, &usage);
+	return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) + static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000000.0;
+}
+
+/// @brief Creates a server context with a throwaway, self-signed certificate, for a tls server on the loopback interface.
+static SSL_CTX* makeLoopbackServerContext() {
+	SSL_CTX* context{ SSL_CTX_new(TLS_server_method()) };
+	EVP_PKEY* key{ EVP_EC_gen("P-256") };
+	X509* certificate{ X509_new() };
+	ASN1_INTEGER_set(X509_get_serialNumber(certificate), 1);
+	X509_gmtime_adj(X509_getm_notBefore(certificate), 0);
+	X509_gmtime_adj(X509_getm_notAfter(certificate), 3600);
+	X509_set_pubkey(certificate, key);
+	X509_NAME_add_entry_by_txt(X509_get_subject_name(certificate), "CN", MBSTRING_ASC, reinterpret_cast<const unsigned char*>("localhost"), -1, -1, 0);
+	X509_set_issuer_name(certificate, X509_get_subject_name(certificate));
+	X509_sign(certificate, key, EVP_sha256());
+	SSL_CTX_use_certificate(context, certificate);
+	SSL_CTX_use_PrivateKey(context, key);
+	X509_free(certificate);
+	EVP_PKEY_free(key);
+	return context;
+}
+
+enum class tls_send_mode { user_space, kernel, kernel_sendfile };
+
+/// @brief Sends bytes over tls to a server on the loopback interface, which reads and discards them, the way tcp_connection writes them - as buffers, or, once
+/// the kernel has taken over the record layer, optionally straight from a file with SSL_sendfile, as tcp_connection::streamFile() does.
+/// @param serverContext the server's context.
+/// @param mode how the bytes are encrypted and written.
+/// @param file the file to send from, in kernel_sendfile mode - its contents are sent repeatedly.
+/// @param fileSize the size of the file.
+/// @param byteCount the number of bytes to send.
+/// @return the sending thread's cpu seconds, or a negative value if the kernel declined to take over the connection.
+static double measureTlsSend(SSL_CTX* serverContext, tls_send_mode mode, int32_t file, uint64_t fileSize, uint64_t byteCount) {
+	SOCKET listenSocket{ ::socket(AF_INET, SOCK_STREAM, 0) };
+	sockaddr_in address{};
+	address.sin_family		= AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	socklen_t addressLength{ sizeof(address) };
+	::bind(listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+	::listen(listenSocket, 1);
+	::getsockname(listenSocket, reinterpret_cast<sockaddr*>(&address), &addressLength);
+	std::jthread server{ [&] {
+		SOCKET serverSocket{ ::accept(listenSocket, nullptr, nullptr) };
+		SSL* ssl{ SSL_new(serverContext) };
+		SSL_set_fd(ssl, serverSocket);
+		if (SSL_accept(ssl) == 1) {
+			std::vector<char> buffer(65536);
+			while (SSL_read(ssl, buffer.data(), static_cast<int32_t>(buffer.size())) > 0) {
+			}
+		}
+		SSL_free(ssl);
+		::close(serverSocket);
+	} };
+
+	SSL_CTX* clientContext{ SSL_CTX_new(TLS_client_method()) };
+	if (mode != tls_send_mode::user_space) {
+		SSL_CTX_set_options(clientContext, SSL_OP_ENABLE_KTLS);
+	}
+	SOCKET clientSocket{ ::socket(AF_INET, SOCK_STREAM, 0) };
+	::connect(clientSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+	SSL* ssl{ SSL_new(clientContext) };
+	SSL_set_fd(ssl, clientSocket);
+	double returnValue{ -1.0 };
+	if (SSL_connect(ssl) == 1 && (mode == tls_send_mode::user_space || BIO_get_ktls_send(SSL_get_wbio(ssl)))) {
+		std::vector<char> buffer(65536, 'x');
+		double startSeconds{ getThreadCpuSeconds() };
+		uint64_t writtenBytes{};
+		while (writtenBytes < byteCount) {
+			int64_t result{};
+			if (mode == tls_send_mode::kernel_sendfile) {
+				uint64_t offset{ writtenBytes % fileSize };
+				result = SSL_sendfile(ssl, file, static_cast<off_t>(offset), std::min(fileSize - offset, byteCount - writtenBytes), 0);
+			} else {
+				result = SSL_write(ssl, buffer.data(), static_cast<int32_t>(std::min<uint64_t>(buffer.size(), byteCount - writtenBytes)));
+			}
+			if (result <= 0) {
+				break;
+			}
+			writtenBytes += static_cast<uint64_t>(result);
+		}
+		returnValue = writtenBytes == byteCount ? getThreadCpuSeconds() - startSeconds : -1.0;
+		SSL_shutdown(ssl);
+	}
+	SSL_free(ssl);
+	::close(clientSocket);
+	SSL_CTX_free(clientContext);
+	server.join();
+	::close(listenSocket);
+	return returnValue;
+}
+
+/// @brief Compares the sending cpu cost of user-space tls against kernel tls, when the running kernel offers it, per GB sent to a local tls server.
+static void benchmarkKernelTls() {
+	static constexpr uint64_t byteCount{ uint64_t{ 1 } << 30 };
+	static constexpr uint64_t fileSize{ uint64_t{ 64 } << 20 };
+	SSL_CTX* serverContext{ makeLoopbackServerContext() };
+	auto printResult = [](std::string_view name, double cpuSeconds) {
+		std::cout << std::left << std::setw(72) << name << std::right << std::setw(12) << std::fixed << std::setprecision(3) << cpuSeconds / (byteCount / 1e9)
+				  << " cpu s/GB" << std::endl;
+	};
+	printResult("tls send, user space", measureTlsSend(serverContext, tls_send_mode::user_space, -1, 0, byteCount));
+	if (!dca::discord_core_internal::ssl_context_holder::isKernelTlsAvailable()) {
+		std::cout << "tls send, kernel tls: unavailable - the running kernel doesn't provide the tls upper-layer protocol." << std::endl;
+		SSL_CTX_free(serverContext);
+		return;
+	}
+	std::FILE* file{ std::tmpfile() };
+	std::vector<char> contents(fileSize, 'x');
+	std::fwrite(contents.data(), 1, contents.size(), file);
+	std::fflush(file);
+	for (auto [name, mode]: { std::pair{ "tls send, kernel tls", tls_send_mode::kernel }, std::pair{ "tls send, kernel tls, SSL_sendfile", tls_send_mode::kernel_sendfile } }) {
+		if (double cpuSeconds = measureTlsSend(serverContext, mode, fileno(file), fileSize, byteCount); cpuSeconds >= 0.0) {
+			printResult(name, cpuSeconds);
+		} else {
+			std::cout << name << ": unavailable - OpenSSL didn't hand the connection to the kernel." << std::endl;
+		}
+	}
+	std::fclose(file);
+	SSL_CTX_free(serverContext);
+}
+
+#endif
+
+int32_t main() {
+	benchmarkSwissTable();
+	benchmarkResponseDecoding();
+	benchmarkPermissions();
+	benchmarkGuildMemberStorage();
+	benchmarkCacheLocking();
+	benchmarkCacheViews();
+	benchmarkEventPayloads();
+#if defined(__linux__) && defined(SSL_OP_ENABLE_KTLS)
+	benchmarkKernelTls();
+#endif
+	return 0;
+}
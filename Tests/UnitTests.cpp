@@ -0,0 +1,313 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// UnitTests.cpp - Standalone checks for the cache containers and the snapshot codec, which don't need a bot token or a connection.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file UnitTests.cpp
+
+#include <discordcoreapi/Index.hpp>
+#include <discordcoreapi/CacheSnapshot.hpp>
+#include <discordcoreapi/Utilities/DenseMap.hpp>
+#include <discordcoreapi/Utilities/Epoch.hpp>
+#include <discordcoreapi/Utilities/GuildMemberStore.hpp>
+#include <discordcoreapi/Utilities/SecondaryIndex.hpp>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <map>
+
+namespace dca = discord_core_api;
+
+static uint64_t failureCount{};
+
+static void check(bool condition, std::string_view description) {
+	if (!condition) {
+		std::cerr << "FAILED: " << description << std::endl;
+		++failureCount;
+	}
+}
+
+static void testSwissTable() {
+	// mirror every operation into a std::map, so that probing, tombstones and rehashing are all checked against a reference.
+	dca::unordered_map<uint64_t, uint64_t> table{};
+	std::map<uint64_t, uint64_t> reference{};
+	std::mt19937_64 generator{ 42 };
+	for (uint64_t x = 0; x < 200000; ++x) {
+		uint64_t key{ generator() % 20000 };
+		if (generator() % 3 == 0) {
+			table.erase(key);
+			reference.erase(key);
+		} else {
+			table.emplace(key, x);
+			reference[key] = x;
+		}
+	}
+	check(table.size() == reference.size(), "swiss_table: size matches the reference after mixed inserts and erases.");
+	bool allFound{ true };
+	for (auto& [key, value]: reference) {
+		auto iter = table.find(key);
+		allFound &= iter != table.end() && iter->second == value;
+	}
+	check(allFound, "swiss_table: every reference key is found, with its latest value.");
+	uint64_t iteratedCount{};
+	bool allPresent{ true };
+	for (auto& value: table) {
+		++iteratedCount;
+		allPresent &= reference.contains(value.first);
+	}
+	check(iteratedCount == reference.size() && allPresent, "swiss_table: iteration visits each stored key exactly once.");
+	check(!table.contains(uint64_t{ 20001 }), "swiss_table: absent keys aren't found.");
+
+	static_assert(std::same_as<decltype(*std::as_const(table).begin()), const std::pair<uint64_t, uint64_t>&>, "swiss_table: a const_iterator yields const references.");
+
+	dca::unordered_map<uint64_t, uint64_t> copied{ table };
+	check(copied == table, "swiss_table: copies compare equal.");
+	table.clear();
+	check(table.empty() && table.begin() == table.end(), "swiss_table: clear() empties the table.");
+	check(copied.size() == reference.size(), "swiss_table: copies are independent of the original.");
+
+	dca::unordered_map<dca::snowflake, jsonifier::string> byId{};
+	byId[dca::snowflake{ uint64_t{ 1 } }] = "one";
+	byId.emplace(dca::snowflake{ uint64_t{ 1 } }, "uno");
+	check(byId.size() == 1 && byId.at(dca::snowflake{ uint64_t{ 1 } }) == "uno", "swiss_table: emplacing an existing snowflake overwrites its value.");
+}
+
+static void testDenseMap() {
+	dca::dense_map<uint64_t, jsonifier::string> map{};
+	for (uint64_t x = 0; x < 8; ++x) {
+		map.emplace(x, jsonifier::toString(x));
+	}
+	check(map.size() == 8 && map.begin()->first == 0, "dense_map: pairs are packed in insertion order.");
+	map.erase(uint64_t{ 2 });
+	check(map.size() == 7 && !map.contains(uint64_t{ 2 }), "dense_map: erase() removes the key.");
+	check(map.at(uint64_t{ 7 }) == "7" && (map.begin() + 2)->first == 7, "dense_map: the last pair is moved into the erased pair's place, and is still found.");
+	map[uint64_t{ 3 }] = "three";
+	check(map.at(uint64_t{ 3 }) == "three" && map.size() == 7, "dense_map: operator[] overwrites in place.");
+	bool threw{};
+	try {
+		map.at(uint64_t{ 2 });
+	} catch (const std::runtime_error&) {
+		threw = true;
+	}
+	check(threw, "dense_map: at() throws for absent keys.");
+}
+
+static void testEventDelegates() {
+	using delegate_type = dca::discord_core_internal::event_delegate<void, std::string>;
+	auto byMutableReference = [](std::string& value) {
+		value += "!";
+	};
+	auto byRvalueReference = [](std::string&& value) {
+		std::string valueNew{ std::move(value) };
+	};
+	static_assert(std::is_constructible_v<delegate_type, decltype(byMutableReference)>, "event_delegate: accepts handlers taking T&.");
+	static_assert(std::is_constructible_v<delegate_type, decltype(byRvalueReference)>, "event_delegate: accepts handlers taking T&&.");
+	std::string argument{ "event" }, seen{};
+	auto wrapped = dca::discord_core_internal::wrapMutableArgCallable<void, std::string>([&](std::string& value) {
+		value += "!";
+		seen = value;
+	});
+	wrapped(argument);
+	check(seen == "event!" && argument == "event", "event_delegate: a handler taking T& modifies its own copy, not the shared argument.");
+}
+
+static void testSecondaryIndex() {
+	dca::secondary_index<dca::snowflake, 4> index{};
+	dca::snowflake guildOne{ uint64_t{ 100 } };
+	dca::snowflake guildTwo{ uint64_t{ 200 } };
+	for (uint64_t x = 1; x <= 10; ++x) {
+		index.insert(guildOne, dca::snowflake{ x });
+	}
+	index.insert(guildTwo, dca::snowflake{ uint64_t{ 1 } });
+	index.insert(guildOne, dca::snowflake{ uint64_t{ 1 } });
+	check(index.count(guildOne) == 10 && index.count(guildTwo) == 1, "secondary_index: ids are counted per key, and duplicates aren't added twice.");
+	index.erase(guildOne, dca::snowflake{ uint64_t{ 5 } });
+	auto ids = index.collect(guildOne);
+	check(ids.size() == 9 && std::find(ids.begin(), ids.end(), dca::snowflake{ uint64_t{ 5 } }) == ids.end(), "secondary_index: erase() removes a single id.");
+	check(index.extract(guildOne).size() == 9 && index.count(guildOne) == 0, "secondary_index: extract() collects and removes a key's ids.");
+	index.erase(guildTwo, dca::snowflake{ uint64_t{ 1 } });
+	check(index.collect(guildTwo).empty(), "secondary_index: a key is dropped once its last id is erased.");
+}
+
+struct retire_tracker {
+	inline static std::atomic_uint64_t destroyedCount{};
+
+	inline ~retire_tracker() {
+		destroyedCount.fetch_add(1, std::memory_order_release);
+	}
+};
+
+static void retireFillers(uint64_t count) {
+	for (uint64_t x = 0; x < count; ++x) {
+		dca::discord_core_internal::epoch_manager::retire(new uint64_t{ x });
+	}
+}
+
+static void testEpochManager() {
+	using dca::discord_core_internal::epoch_manager;
+	auto* tracked = new retire_tracker{};
+	{
+		dca::discord_core_internal::epoch_guard guard{};
+		epoch_manager::retire(tracked);
+		retireFillers(epoch_manager::reclaimThreshold * 4);
+		check(retire_tracker::destroyedCount.load(std::memory_order_acquire) == 0, "epoch_manager: nothing a reader might still see is deleted while it is active.");
+	}
+	retireFillers(epoch_manager::reclaimThreshold * 4);
+	check(retire_tracker::destroyedCount.load(std::memory_order_acquire) == 1, "epoch_manager: retired objects are deleted once their readers have left.");
+	check(epoch_manager::getRetiredCount() < epoch_manager::reclaimThreshold * 2, "epoch_manager: reclamation keeps up without any readers.");
+}
+
+static dca::guild_member_cache_data makeMember(uint64_t guildId, uint64_t userId, jsonifier::string_view nick, uint64_t roleCount) {
+	dca::guild_member_cache_data returnData{};
+	returnData.guildId		  = guildId;
+	returnData.user.id		  = userId;
+	returnData.nick			  = static_cast<jsonifier::string>(nick);
+	returnData.permissionsVal = uint64_t{ 0x8 };
+	returnData.joinedAt		  = (dca::guild_member_columns::discordEpochSeconds + userId) * 1000ULL;
+	for (uint64_t x = 0; x < roleCount; ++x) {
+		returnData.roles.emplace_back(dca::snowflake{ 1000 + x });
+	}
+	return returnData;
+}
+
+static bool sameMember(const dca::guild_member_cache_data& lhs, const dca::guild_member_cache_data& rhs) {
+	return lhs.guildId == rhs.guildId && lhs.user.id == rhs.user.id && lhs.nick == rhs.nick && std::equal(lhs.roles.begin(), lhs.roles.end(), rhs.roles.begin(), rhs.roles.end()) &&
+		lhs.permissionsVal.operator uint64_t() == rhs.permissionsVal.operator uint64_t() && static_cast<uint64_t>(lhs.joinedAt) == static_cast<uint64_t>(rhs.joinedAt) &&
+		lhs.avatar == rhs.avatar;
+}
+
+static void testGuildMemberStore() {
+	dca::guild_member_store<4> store{};
+	auto first	= makeMember(1, 10, "shared", 2);
+	auto second = makeMember(1, 11, "shared", 5);
+	second.avatar = jsonifier::string_view{ "0123456789abcdef0123456789abcdef" };
+	auto third	= makeMember(2, 10, "", 0);
+	store.emplace(first);
+	store.emplace(second);
+	store.emplace(third);
+	check(store.count() == 3, "guild_member_store: members are counted across guilds.");
+	auto found = store.find(dca::snowflake{ uint64_t{ 1 } }, dca::snowflake{ uint64_t{ 11 } });
+	check(found && sameMember(*found, second), "guild_member_store: a member with overflowing roles and an avatar round-trips.");
+	store.erase(dca::snowflake{ uint64_t{ 1 } }, dca::snowflake{ uint64_t{ 10 } });
+	found = store.find(dca::snowflake{ uint64_t{ 1 } }, dca::snowflake{ uint64_t{ 11 } });
+	check(found && sameMember(*found, second), "guild_member_store: the row moved into an erased row's place keeps its nick, roles and avatar.");
+	check(!store.contains(dca::snowflake{ uint64_t{ 1 } }, dca::snowflake{ uint64_t{ 10 } }) && store.contains(dca::snowflake{ uint64_t{ 2 } }, dca::snowflake{ uint64_t{ 10 } }),
+		"guild_member_store: erasing a member leaves the same user in other guilds alone.");
+	second.nick = "renamed";
+	store.emplace(second);
+	found = store.find(dca::snowflake{ uint64_t{ 1 } }, dca::snowflake{ uint64_t{ 11 } });
+	check(found && found->nick == "renamed" && store.count() == 2, "guild_member_store: emplacing an existing member overwrites it.");
+	uint64_t visitedCount{};
+	store.visit([&](const dca::guild_member_cache_data&) {
+		++visitedCount;
+	});
+	check(visitedCount == 2, "guild_member_store: visit() expands every stored member.");
+	store.eraseGuild(dca::snowflake{ uint64_t{ 1 } });
+	check(store.count() == 1, "guild_member_store: eraseGuild() drops a whole guild.");
+}
+
+static void testSnapshotCodec() {
+	auto filePath = (std::filesystem::temp_directory_path() / "DiscordCoreAPIUnitTests.snapshot").string();
+	dca::guild_cache_data guild{};
+	guild.id	  = uint64_t{ 1 };
+	guild.name	  = "test guild";
+	guild.ownerId = uint64_t{ 10 };
+	guild.channels.emplace_back(dca::snowflake{ uint64_t{ 20 } });
+	guild.roles.emplace_back(dca::snowflake{ uint64_t{ 30 } });
+	dca::channel_cache_data channel{};
+	channel.id		= uint64_t{ 20 };
+	channel.guildId = uint64_t{ 1 };
+	channel.name	= "general";
+	dca::over_write_data overwrite{};
+	overwrite.id	= uint64_t{ 30 };
+	overwrite.allow = uint64_t{ 0x400 };
+	channel.permissionOverwrites.emplace_back(overwrite);
+	dca::role_cache_data role{};
+	role.id				= uint64_t{ 30 };
+	role.guildId		= uint64_t{ 1 };
+	role.name			= "role";
+	role.permissionsVal = uint64_t{ 0x8 };
+	dca::role_cache_data untakenRole{ role };
+	untakenRole.id = uint64_t{ 32 };
+	dca::user_cache_data user{};
+	user.id		  = uint64_t{ 10 };
+	user.userName = "user";
+	auto member	  = makeMember(1, 10, "nick", 4);
+
+	dca::cache_snapshot_writer writer{};
+	writer.add(guild);
+	writer.add(channel);
+	writer.add(role);
+	writer.add(untakenRole);
+	writer.add(user);
+	writer.add(member);
+	check(writer.write(filePath), "cache_snapshot: the snapshot is written.");
+	check(dca::cache_snapshot::open(filePath), "cache_snapshot: the snapshot is mapped back in.");
+
+	auto guildNew = dca::cache_snapshot::take<dca::guild_cache_data>(guild.id);
+	check(guildNew && guildNew->name == guild.name && guildNew->ownerId == guild.ownerId && guildNew->channels.size() == 1 && guildNew->roles.at(0) == guild.roles.at(0),
+		"cache_snapshot: a guild round-trips.");
+	auto channelNew = dca::cache_snapshot::take<dca::channel_cache_data>(channel.id);
+	check(channelNew && channelNew->name == channel.name && channelNew->permissionOverwrites.size() == 1 &&
+			channelNew->permissionOverwrites.at(0).allow.operator uint64_t() == 0x400,
+		"cache_snapshot: a channel and its permission overwrites round-trip.");
+	auto roleNew = dca::cache_snapshot::take<dca::role_cache_data>(role.id);
+	check(roleNew && roleNew->name == role.name && roleNew->permissionsVal.operator uint64_t() == 0x8, "cache_snapshot: a role round-trips.");
+	auto memberNew = dca::cache_snapshot::take<dca::guild_member_cache_data>(member.guildId, member.user.id);
+	check(memberNew && sameMember(*memberNew, member), "cache_snapshot: a guild member round-trips.");
+	dca::cache_snapshot::discard<dca::user_cache_data>(user.id);
+	check(!dca::cache_snapshot::take<dca::user_cache_data>(user.id), "cache_snapshot: a discarded object can't be taken.");
+	check(!dca::cache_snapshot::take<dca::role_cache_data>(role.id), "cache_snapshot: an object is only handed out once.");
+	check(!dca::cache_snapshot::take<dca::role_cache_data>(dca::snowflake{ uint64_t{ 31 } }), "cache_snapshot: absent objects aren't found.");
+
+	dca::cache_snapshot_writer writerNew{};
+	writerNew.add(guild);
+	dca::cache_snapshot::carryForward(writerNew);
+	check(writerNew.write(filePath) && dca::cache_snapshot::open(filePath), "cache_snapshot: a snapshot with carried-forward records is written and mapped back in.");
+	auto untakenRoleNew = dca::cache_snapshot::take<dca::role_cache_data>(untakenRole.id);
+	check(untakenRoleNew && untakenRoleNew->name == untakenRole.name, "cache_snapshot: records that were never taken carry forward.");
+	check(!dca::cache_snapshot::take<dca::user_cache_data>(user.id) && !dca::cache_snapshot::take<dca::role_cache_data>(role.id),
+		"cache_snapshot: taken and discarded records don't carry forward.");
+	check(dca::cache_snapshot::take<dca::guild_cache_data>(guild.id).has_value(), "cache_snapshot: the caches' own objects are still written alongside them.");
+	dca::cache_snapshot::close();
+	std::filesystem::remove(filePath);
+}
+
+int32_t main() {
+	testSwissTable();
+	testDenseMap();
+	testEventDelegates();
+	testSecondaryIndex();
+	testEpochManager();
+	testGuildMemberStore();
+	testSnapshotCodec();
+	if (failureCount > 0) {
+		std::cerr << failureCount << " check(s) failed." << std::endl;
+		return 1;
+	}
+	std::cout << "All checks passed." << std::endl;
+	return 0;
+}